@@ -0,0 +1,1200 @@
+/*
+ * Content addressed blob store
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* Required for the declaration of copy_file_range
+ */
+#if !defined( _GNU_SOURCE )
+#define _GNU_SOURCE
+#endif
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_SYS_SENDFILE_H )
+#include <sys/sendfile.h>
+#endif
+
+#include "blob_store.h"
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libcfile.h"
+#include "esedbtools_libcpath.h"
+#include "esedbtools_libesedb.h"
+#include "esedbtools_libhmac.h"
+
+/* Creates a blob store
+ * Make sure the value blob_store is referencing, is set to NULL
+ * The directory referenced by path must exist
+ * Returns 1 if successful or -1 on error
+ */
+int blob_store_initialize(
+     blob_store_t **blob_store,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	static char *function = "blob_store_initialize";
+
+	if( blob_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid blob store.",
+		 function );
+
+		return( -1 );
+	}
+	if( *blob_store != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid blob store value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length == 0 )
+	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*blob_store = memory_allocate_structure(
+	               blob_store_t );
+
+	if( *blob_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create blob store.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *blob_store,
+	     0,
+	     sizeof( blob_store_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear blob store.",
+		 function );
+
+		memory_free(
+		 *blob_store );
+
+		*blob_store = NULL;
+
+		return( -1 );
+	}
+	( *blob_store )->source_file_descriptor = -1;
+	( *blob_store )->use_copy_file_range    = 1;
+	( *blob_store )->use_sendfile           = 1;
+	( *blob_store )->path_size              = path_length + 1;
+
+	( *blob_store )->path = system_string_allocate(
+	                         ( *blob_store )->path_size );
+
+	if( ( *blob_store )->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     ( *blob_store )->path,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		goto on_error;
+	}
+	( *blob_store )->path[ path_length ] = 0;
+
+	( *blob_store )->buffer = (uint8_t *) memory_allocate(
+	                                       sizeof( uint8_t ) * BLOB_STORE_BUFFER_SIZE );
+
+	if( ( *blob_store )->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *blob_store != NULL )
+	{
+		if( ( *blob_store )->buffer != NULL )
+		{
+			memory_free(
+			 ( *blob_store )->buffer );
+		}
+		if( ( *blob_store )->path != NULL )
+		{
+			memory_free(
+			 ( *blob_store )->path );
+		}
+		memory_free(
+		 *blob_store );
+
+		*blob_store = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a blob store
+ * Returns 1 if successful or -1 on error
+ */
+int blob_store_free(
+     blob_store_t **blob_store,
+     libcerror_error_t **error )
+{
+	static char *function = "blob_store_free";
+
+	if( blob_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid blob store.",
+		 function );
+
+		return( -1 );
+	}
+	if( *blob_store != NULL )
+	{
+		memory_free(
+		 ( *blob_store )->buffer );
+
+		memory_free(
+		 ( *blob_store )->path );
+
+		memory_free(
+		 *blob_store );
+
+		*blob_store = NULL;
+	}
+	return( 1 );
+}
+
+/* Calculates the SHA-256 of the data of a long value as a hexadecimal string
+ * The data is read in chunks, so the long value is never fully retained in memory
+ * Returns 1 if successful or -1 on error
+ */
+int blob_store_get_long_value_hash_string(
+     blob_store_t *blob_store,
+     libesedb_long_value_t *long_value,
+     system_character_t *hash_string,
+     size_t hash_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t hash[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	const system_character_t *hexadecimal_digits = _SYSTEM_STRING( "0123456789abcdef" );
+	libhmac_sha256_context_t *sha256_context     = NULL;
+	static char *function                        = "blob_store_get_long_value_hash_string";
+	ssize_t read_count                           = 0;
+	size_t hash_index                            = 0;
+
+	if( blob_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid blob store.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash string.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_string_size < BLOB_STORE_HASH_STRING_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_long_value_seek_offset(
+	     long_value,
+	     0,
+	     SEEK_SET,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek start of long value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhmac_sha256_initialize(
+	     &sha256_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create SHA-256 context.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		read_count = libesedb_long_value_read_buffer(
+		              long_value,
+		              blob_store->buffer,
+		              BLOB_STORE_BUFFER_SIZE,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read long value data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libhmac_sha256_update(
+		     sha256_context,
+		     blob_store->buffer,
+		     (size_t) read_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA-256 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( read_count > 0 );
+
+	if( libhmac_sha256_finalize(
+	     sha256_context,
+	     hash,
+	     LIBHMAC_SHA256_HASH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to finalize SHA-256 context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha256_free(
+	     &sha256_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free SHA-256 context.",
+		 function );
+
+		goto on_error;
+	}
+	for( hash_index = 0;
+	     hash_index < LIBHMAC_SHA256_HASH_SIZE;
+	     hash_index++ )
+	{
+		hash_string[ 2 * hash_index ]         = hexadecimal_digits[ hash[ hash_index ] >> 4 ];
+		hash_string[ ( 2 * hash_index ) + 1 ] = hexadecimal_digits[ hash[ hash_index ] & 0x0f ];
+	}
+	hash_string[ 2 * LIBHMAC_SHA256_HASH_SIZE ] = 0;
+
+	return( 1 );
+
+on_error:
+	if( sha256_context != NULL )
+	{
+		libhmac_sha256_free(
+		 &sha256_context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the source file descriptor
+ * The file descriptor is not managed by the blob store and must remain open
+ * for as long as long values are stored
+ * Returns 1 if successful or -1 on error
+ */
+int blob_store_set_source_file_descriptor(
+     blob_store_t *blob_store,
+     int source_file_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "blob_store_set_source_file_descriptor";
+
+	if( blob_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid blob store.",
+		 function );
+
+		return( -1 );
+	}
+	blob_store->source_file_descriptor = source_file_descriptor;
+
+	return( 1 );
+}
+
+#if defined( HAVE_BLOB_STORE_FILE_RANGE_COPY )
+
+/* Copies a range of the source file to the current offset of the destination file
+ * Uses copy_file_range or sendfile and falls back to a buffered copy if the
+ * file systems involved do not support them
+ * Returns 1 if successful or -1 on error
+ */
+int blob_store_copy_file_range(
+     blob_store_t *blob_store,
+     int destination_file_descriptor,
+     off64_t file_offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "blob_store_copy_file_range";
+	size_t copy_size      = 0;
+	ssize_t read_count    = 0;
+	ssize_t write_count   = 0;
+	size_t write_offset   = 0;
+
+#if defined( HAVE_SENDFILE )
+	off_t sendfile_offset = 0;
+#endif
+
+	if( blob_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid blob store.",
+		 function );
+
+		return( -1 );
+	}
+	if( blob_store->source_file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid blob store - missing source file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( size > 0 )
+	{
+		if( size > (size64_t) SSIZE_MAX )
+		{
+			copy_size = (size_t) SSIZE_MAX;
+		}
+		else
+		{
+			copy_size = (size_t) size;
+		}
+		read_count = -1;
+
+#if defined( HAVE_COPY_FILE_RANGE )
+		if( blob_store->use_copy_file_range != 0 )
+		{
+			read_count = copy_file_range(
+			              blob_store->source_file_descriptor,
+			              &file_offset,
+			              destination_file_descriptor,
+			              NULL,
+			              copy_size,
+			              0 );
+
+			if( read_count == -1 )
+			{
+				if( ( errno != EXDEV )
+				 && ( errno != EINVAL )
+				 && ( errno != ENOSYS )
+				 && ( errno != EOPNOTSUPP ) )
+				{
+					libcerror_system_set_error(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 errno,
+					 "%s: unable to copy file range.",
+					 function );
+
+					return( -1 );
+				}
+				blob_store->use_copy_file_range = 0;
+			}
+		}
+#endif /* defined( HAVE_COPY_FILE_RANGE ) */
+
+#if defined( HAVE_SENDFILE )
+		if( ( read_count == -1 )
+		 && ( blob_store->use_sendfile != 0 ) )
+		{
+			sendfile_offset = (off_t) file_offset;
+
+			read_count = sendfile(
+			              destination_file_descriptor,
+			              blob_store->source_file_descriptor,
+			              &sendfile_offset,
+			              copy_size );
+
+			if( read_count == -1 )
+			{
+				if( ( errno != EINVAL )
+				 && ( errno != ENOSYS ) )
+				{
+					libcerror_system_set_error(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 errno,
+					 "%s: unable to send file range.",
+					 function );
+
+					return( -1 );
+				}
+				blob_store->use_sendfile = 0;
+			}
+			else
+			{
+				file_offset = (off64_t) sendfile_offset;
+			}
+		}
+#endif /* defined( HAVE_SENDFILE ) */
+
+		if( read_count == -1 )
+		{
+			if( copy_size > BLOB_STORE_BUFFER_SIZE )
+			{
+				copy_size = BLOB_STORE_BUFFER_SIZE;
+			}
+			read_count = pread(
+			              blob_store->source_file_descriptor,
+			              blob_store->buffer,
+			              copy_size,
+			              (off_t) file_offset );
+
+			if( read_count == -1 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 errno,
+				 "%s: unable to read source file at offset: %" PRIi64 ".",
+				 function,
+				 file_offset );
+
+				return( -1 );
+			}
+			write_offset = 0;
+
+			while( write_offset < (size_t) read_count )
+			{
+				write_count = write(
+				               destination_file_descriptor,
+				               &( blob_store->buffer[ write_offset ] ),
+				               (size_t) read_count - write_offset );
+
+				if( write_count <= 0 )
+				{
+					libcerror_system_set_error(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 errno,
+					 "%s: unable to write blob data.",
+					 function );
+
+					return( -1 );
+				}
+				write_offset += (size_t) write_count;
+			}
+			file_offset += (off64_t) read_count;
+		}
+		if( read_count == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unexpected end of source file at offset: %" PRIi64 ".",
+			 function,
+			 file_offset );
+
+			return( -1 );
+		}
+		size -= (size64_t) read_count;
+	}
+	return( 1 );
+}
+
+/* Copies the data of a long value directly from the source file to a blob file
+ * This is only possible if all the data segments of the long value are stored uncompressed
+ * Returns 1 if successful, 0 if the data cannot be copied directly or -1 on error
+ */
+int blob_store_copy_long_value_file_ranges(
+     blob_store_t *blob_store,
+     libesedb_long_value_t *long_value,
+     FILE *blob_file_stream,
+     libcerror_error_t **error )
+{
+	static char *function       = "blob_store_copy_long_value_file_ranges";
+	size64_t segment_size       = 0;
+	off64_t segment_file_offset = 0;
+	int destination_descriptor  = 0;
+	int number_of_data_segments = 0;
+	int result                  = 0;
+	int segment_index           = 0;
+
+	if( blob_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid blob store.",
+		 function );
+
+		return( -1 );
+	}
+	if( blob_file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid blob file stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( blob_store->source_file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	if( libesedb_long_value_get_number_of_data_segments(
+	     long_value,
+	     &number_of_data_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data segments.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check all the data segments first, so that nothing is written when
+	 * the long value needs to be decompressed
+	 */
+	for( segment_index = 0;
+	     segment_index < number_of_data_segments;
+	     segment_index++ )
+	{
+		result = libesedb_long_value_get_data_segment_file_range(
+		          long_value,
+		          segment_index,
+		          &segment_file_offset,
+		          &segment_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data segment: %d file range.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( fflush(
+	     blob_file_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush blob file stream.",
+		 function );
+
+		return( -1 );
+	}
+	destination_descriptor = fileno(
+	                          blob_file_stream );
+
+	for( segment_index = 0;
+	     segment_index < number_of_data_segments;
+	     segment_index++ )
+	{
+		if( libesedb_long_value_get_data_segment_file_range(
+		     long_value,
+		     segment_index,
+		     &segment_file_offset,
+		     &segment_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data segment: %d file range.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		if( blob_store_copy_file_range(
+		     blob_store,
+		     destination_descriptor,
+		     segment_file_offset,
+		     segment_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to copy data segment: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+	}
+	blob_store->number_of_direct_copies += 1;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_BLOB_STORE_FILE_RANGE_COPY ) */
+
+/* Writes the data of a long value to a blob file
+ * The data is written to a temporary file that is renamed to the blob file
+ * once all the data was written, so that a partially written blob file never
+ * has the name of a stored blob
+ * Returns 1 if successful or -1 on error
+ */
+int blob_store_write_long_value(
+     blob_store_t *blob_store,
+     libesedb_long_value_t *long_value,
+     const system_character_t *blob_path,
+     libcerror_error_t **error )
+{
+	FILE *blob_file_stream             = NULL;
+	const system_character_t *mode     = NULL;
+	system_character_t *temporary_path = NULL;
+	static char *function              = "blob_store_write_long_value";
+	size_t blob_path_length            = 0;
+	size_t temporary_path_size         = 0;
+	ssize_t read_count                 = 0;
+	int result                         = 0;
+	int temporary_file_exists          = 0;
+
+	if( blob_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid blob store.",
+		 function );
+
+		return( -1 );
+	}
+	if( blob_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid blob path.",
+		 function );
+
+		return( -1 );
+	}
+	blob_path_length = system_string_length(
+	                    blob_path );
+
+	temporary_path_size = blob_path_length + 5;
+
+	temporary_path = system_string_allocate(
+	                  temporary_path_size );
+
+	if( temporary_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create temporary path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     temporary_path,
+	     blob_path,
+	     blob_path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy blob path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     &( temporary_path[ blob_path_length ] ),
+	     _SYSTEM_STRING( ".tmp" ),
+	     4 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy temporary path suffix.",
+		 function );
+
+		goto on_error;
+	}
+	temporary_path[ temporary_path_size - 1 ] = 0;
+
+	if( libesedb_long_value_seek_offset(
+	     long_value,
+	     0,
+	     SEEK_SET,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek start of long value.",
+		 function );
+
+		goto on_error;
+	}
+	mode = _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	blob_file_stream = file_stream_open_wide(
+	                    temporary_path,
+	                    mode );
+#else
+	blob_file_stream = file_stream_open(
+	                    temporary_path,
+	                    mode );
+#endif
+	if( blob_file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open: %" PRIs_SYSTEM ".",
+		 function,
+		 temporary_path );
+
+		goto on_error;
+	}
+	temporary_file_exists = 1;
+#if defined( HAVE_BLOB_STORE_FILE_RANGE_COPY )
+	result = blob_store_copy_long_value_file_ranges(
+	          blob_store,
+	          long_value,
+	          blob_file_stream,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to copy long value data to: %" PRIs_SYSTEM ".",
+		 function,
+		 temporary_path );
+
+		goto on_error;
+	}
+#endif
+	while( result == 0 )
+	{
+		read_count = libesedb_long_value_read_buffer(
+		              long_value,
+		              blob_store->buffer,
+		              BLOB_STORE_BUFFER_SIZE,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read long value data.",
+			 function );
+
+			goto on_error;
+		}
+		if( read_count > 0 )
+		{
+			if( file_stream_write(
+			     blob_file_stream,
+			     blob_store->buffer,
+			     (size_t) read_count ) != (size_t) read_count )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write: %" PRIs_SYSTEM ".",
+				 function,
+				 temporary_path );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			result = 1;
+		}
+	}
+	if( file_stream_close(
+	     blob_file_stream ) != 0 )
+	{
+		blob_file_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close: %" PRIs_SYSTEM ".",
+		 function,
+		 temporary_path );
+
+		goto on_error;
+	}
+	blob_file_stream = NULL;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = _wrename(
+	          temporary_path,
+	          blob_path );
+#else
+	result = rename(
+	          temporary_path,
+	          blob_path );
+#endif
+	if( result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to rename: %" PRIs_SYSTEM " to: %" PRIs_SYSTEM ".",
+		 function,
+		 temporary_path,
+		 blob_path );
+
+		goto on_error;
+	}
+	memory_free(
+	 temporary_path );
+
+	return( 1 );
+
+on_error:
+	if( blob_file_stream != NULL )
+	{
+		file_stream_close(
+		 blob_file_stream );
+	}
+	/* Remove the partially written file so that it is not mistaken for a stored blob
+	 */
+	if( temporary_file_exists != 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		libcfile_file_remove_wide(
+		 temporary_path,
+		 NULL );
+#else
+		libcfile_file_remove(
+		 temporary_path,
+		 NULL );
+#endif
+	}
+	if( temporary_path != NULL )
+	{
+		memory_free(
+		 temporary_path );
+	}
+	return( -1 );
+}
+
+/* Stores the data of a long value in the blob store
+ * The blob is named after the SHA-256 of the data and is only written if it
+ * is not already stored, the hexadecimal SHA-256 is returned in hash_string
+ * Returns 1 if successful or -1 on error
+ */
+int blob_store_store_long_value(
+     blob_store_t *blob_store,
+     libesedb_long_value_t *long_value,
+     system_character_t *hash_string,
+     size_t hash_string_size,
+     libcerror_error_t **error )
+{
+	system_character_t *blob_path = NULL;
+	static char *function         = "blob_store_store_long_value";
+	size_t blob_path_size         = 0;
+	int result                    = 0;
+
+	if( blob_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid blob store.",
+		 function );
+
+		return( -1 );
+	}
+	if( blob_store_get_long_value_hash_string(
+	     blob_store,
+	     long_value,
+	     hash_string,
+	     hash_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve long value hash string.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcpath_path_join_wide(
+	          &blob_path,
+	          &blob_path_size,
+	          blob_store->path,
+	          blob_store->path_size - 1,
+	          hash_string,
+	          2 * LIBHMAC_SHA256_HASH_SIZE,
+	          error );
+#else
+	result = libcpath_path_join(
+	          &blob_path,
+	          &blob_path_size,
+	          blob_store->path,
+	          blob_store->path_size - 1,
+	          hash_string,
+	          2 * LIBHMAC_SHA256_HASH_SIZE,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create blob path.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_exists_wide(
+	          blob_path,
+	          error );
+#else
+	result = libcfile_file_exists(
+	          blob_path,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if %" PRIs_SYSTEM " exists.",
+		 function,
+		 blob_path );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		blob_store->number_of_duplicates += 1;
+	}
+	else
+	{
+		if( blob_store_write_long_value(
+		     blob_store,
+		     long_value,
+		     blob_path,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write blob: %" PRIs_SYSTEM ".",
+			 function,
+			 blob_path );
+
+			goto on_error;
+		}
+		blob_store->number_of_blobs += 1;
+	}
+	memory_free(
+	 blob_path );
+
+	return( 1 );
+
+on_error:
+	if( blob_path != NULL )
+	{
+		memory_free(
+		 blob_path );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,148 @@
+/*
+ * Content addressed blob store
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _BLOB_STORE_H )
+#define _BLOB_STORE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libesedb.h"
+#include "esedbtools_libhmac.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define BLOB_STORE_BUFFER_SIZE		65536
+
+/* Uncompressed long value data can be copied directly from the source file
+ * when the operating system provides a file descriptor to file descriptor copy
+ */
+#if !defined( WINAPI ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && defined( HAVE_PREAD ) && ( defined( HAVE_COPY_FILE_RANGE ) || defined( HAVE_SENDFILE ) )
+#define HAVE_BLOB_STORE_FILE_RANGE_COPY	1
+#endif
+
+/* The size of the hash string, which contains the hexadecimal SHA-256 and the end-of-string character
+ */
+#define BLOB_STORE_HASH_STRING_SIZE	( 2 * LIBHMAC_SHA256_HASH_SIZE ) + 1
+
+typedef struct blob_store blob_store_t;
+
+struct blob_store
+{
+	/* The path of the blob store directory
+	 */
+	system_character_t *path;
+
+	/* The path size
+	 */
+	size_t path_size;
+
+	/* The read buffer
+	 */
+	uint8_t *buffer;
+
+	/* The source file descriptor or -1 if not available
+	 */
+	int source_file_descriptor;
+
+	/* Value to indicate copy_file_range should be used
+	 */
+	int use_copy_file_range;
+
+	/* Value to indicate sendfile should be used
+	 */
+	int use_sendfile;
+
+	/* The number of blobs copied directly from the source file
+	 */
+	int number_of_direct_copies;
+
+	/* The number of blobs stored
+	 */
+	int number_of_blobs;
+
+	/* The number of values that referenced an already stored blob
+	 */
+	int number_of_duplicates;
+};
+
+int blob_store_initialize(
+     blob_store_t **blob_store,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error );
+
+int blob_store_free(
+     blob_store_t **blob_store,
+     libcerror_error_t **error );
+
+int blob_store_get_long_value_hash_string(
+     blob_store_t *blob_store,
+     libesedb_long_value_t *long_value,
+     system_character_t *hash_string,
+     size_t hash_string_size,
+     libcerror_error_t **error );
+
+int blob_store_set_source_file_descriptor(
+     blob_store_t *blob_store,
+     int source_file_descriptor,
+     libcerror_error_t **error );
+
+#if defined( HAVE_BLOB_STORE_FILE_RANGE_COPY )
+
+int blob_store_copy_file_range(
+     blob_store_t *blob_store,
+     int destination_file_descriptor,
+     off64_t file_offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int blob_store_copy_long_value_file_ranges(
+     blob_store_t *blob_store,
+     libesedb_long_value_t *long_value,
+     FILE *blob_file_stream,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_BLOB_STORE_FILE_RANGE_COPY ) */
+
+int blob_store_write_long_value(
+     blob_store_t *blob_store,
+     libesedb_long_value_t *long_value,
+     const system_character_t *blob_path,
+     libcerror_error_t **error );
+
+int blob_store_store_long_value(
+     blob_store_t *blob_store,
+     libesedb_long_value_t *long_value,
+     system_character_t *hash_string,
+     size_t hash_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _BLOB_STORE_H ) */
+
@@ -113,6 +113,7 @@ int main( int argc, char * const argv[] )
 
 	esedbtools_option_t options[ ] = {
 		{ 'c', "codepage", "codepage of ASCII strings, options: ascii, windows-874, windows-932, windows-936, windows-949, windows-950, windows-1250, windows-1251, windows-1252 (default), windows-1253, windows-1254, windows-1255, windows-1256, windows-1257 or windows-1258" },
+		{ 'd', NULL, "deduplicate long binary values, every distinct value is stored once in the blobs sub directory under the name of its SHA-256 and the tables contain the SHA-256 instead of the value" },
 		{ 'h', NULL, "shows this help" },
 		{ 'l', "log_file", "logs information about the exported items" },
 		{ 'm', "mode", "export mode, option: all, tables (default). 'all' exports all the tables or a single specified table with indexes, 'tables' exports all the tables or a single specified table" },
@@ -138,6 +139,7 @@ int main( int argc, char * const argv[] )
 	size_t option_table_name_length           = 0;
 	system_integer_t option                   = 0;
 	int number_of_options                     = (int) ( sizeof( options ) / sizeof( esedbtools_option_t ) );
+	int deduplicate_long_values               = 0;
 	int result                                = 0;
 	int verbose                               = 0;
 
@@ -216,6 +218,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'd':
+				deduplicate_long_values = 1;
+
+				break;
+
 			case (system_integer_t) 'h':
 				esedbtools_getopt_usage_fprint(
 				 stdout,
@@ -331,6 +338,8 @@ int main( int argc, char * const argv[] )
 /* TODO
 	esedbexport_export_handle->print_status_information = print_status_information;
 */
+	esedbexport_export_handle->deduplicate_long_values = deduplicate_long_values;
+
 	if( option_export_mode != NULL )
 	{
 		result = export_handle_set_export_mode(
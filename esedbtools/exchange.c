@@ -2111,6 +2111,7 @@ on_error:
 int exchange_export_record_folders(
      libesedb_record_t *record,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -2449,6 +2450,7 @@ int exchange_export_record_folders(
 				  record,
 				  value_entry,
 				  record_file_stream,
+				  blob_store,
 				  log_handle,
 				  error );
 		}
@@ -2486,6 +2488,7 @@ int exchange_export_record_folders(
 int exchange_export_record_global(
      libesedb_record_t *record,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -2774,6 +2777,7 @@ int exchange_export_record_global(
 				  record,
 				  value_entry,
 				  record_file_stream,
+				  blob_store,
 				  log_handle,
 				  error );
 		}
@@ -2812,6 +2816,7 @@ int exchange_export_record_global(
 int exchange_export_record_mailbox(
      libesedb_record_t *record,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -3074,6 +3079,7 @@ int exchange_export_record_mailbox(
 				  record,
 				  value_entry,
 				  record_file_stream,
+				  blob_store,
 				  log_handle,
 				  error );
 		}
@@ -3111,6 +3117,7 @@ int exchange_export_record_mailbox(
 int exchange_export_record_msg(
      libesedb_record_t *record,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -3366,6 +3373,7 @@ int exchange_export_record_msg(
 				  record,
 				  value_entry,
 				  record_file_stream,
+				  blob_store,
 				  log_handle,
 				  error );
 		}
@@ -3403,6 +3411,7 @@ int exchange_export_record_msg(
 int exchange_export_record_per_user_read(
      libesedb_record_t *record,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -3624,6 +3633,7 @@ int exchange_export_record_per_user_read(
 				  record,
 				  value_entry,
 				  record_file_stream,
+				  blob_store,
 				  log_handle,
 				  error );
 		}
@@ -26,6 +26,7 @@
 #include <file_stream.h>
 #include <types.h>
 
+#include "blob_store.h"
 #include "esedbtools_libcerror.h"
 #include "esedbtools_libesedb.h"
 #include "log_handle.h"
@@ -95,30 +96,35 @@ int exchange_export_record_value_string(
 int exchange_export_record_folders(
      libesedb_record_t *record,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
 int exchange_export_record_global(
      libesedb_record_t *record,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
 int exchange_export_record_mailbox(
      libesedb_record_t *record,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
 int exchange_export_record_msg(
      libesedb_record_t *record,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
 int exchange_export_record_per_user_read(
      libesedb_record_t *record,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
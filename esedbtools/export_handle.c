@@ -27,6 +27,15 @@
 #include <types.h>
 #include <wide_string.h>
 
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "blob_store.h"
 #include "database_types.h"
 #include "esedbtools_libcdata.h"
 #include "esedbtools_libcerror.h"
@@ -122,8 +131,9 @@ int export_handle_initialize(
 		goto on_error;
 	}
 	( *export_handle )->export_mode    = EXPORT_MODE_TABLES;
-	( *export_handle )->ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
-	( *export_handle )->notify_stream  = EXPORT_HANDLE_NOTIFY_STREAM;
+	( *export_handle )->ascii_codepage        = LIBESEDB_CODEPAGE_WINDOWS_1252;
+	( *export_handle )->notify_stream         = EXPORT_HANDLE_NOTIFY_STREAM;
+	( *export_handle )->input_file_descriptor = -1;
 
 	return( 1 );
 
@@ -174,6 +184,19 @@ int export_handle_free(
 
 			result = -1;
 		}
+		if( blob_store_free(
+		     &( ( *export_handle )->blob_store ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free blob store.",
+			 function );
+
+			result = -1;
+		}
 		if( ( *export_handle )->target_path != NULL )
 		{
 			memory_free(
@@ -754,6 +777,17 @@ int export_handle_open(
 
 		return( -1 );
 	}
+#if defined( HAVE_BLOB_STORE_FILE_RANGE_COPY )
+	if( export_handle->deduplicate_long_values != 0 )
+	{
+		/* A failure to open the file descriptor is not fatal, the long value
+		 * data is then copied using buffers
+		 */
+		export_handle->input_file_descriptor = open(
+		                                        filename,
+		                                        O_RDONLY );
+	}
+#endif
 	return( 1 );
 }
 
@@ -790,9 +824,158 @@ int export_handle_close(
 
 		return( -1 );
 	}
+#if defined( HAVE_BLOB_STORE_FILE_RANGE_COPY )
+	if( export_handle->input_file_descriptor != -1 )
+	{
+		if( close(
+		     export_handle->input_file_descriptor ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input file descriptor.",
+			 function );
+
+			return( -1 );
+		}
+		export_handle->input_file_descriptor = -1;
+	}
+#endif
 	return( 0 );
 }
 
+/* Creates the blob store in the items export path
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_create_blob_store(
+     export_handle_t *export_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	system_character_t *blobs_path = NULL;
+	static char *function          = "export_handle_create_blob_store";
+	size_t blobs_path_size         = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->blob_store != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - blob store value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcpath_path_join_wide(
+	     &blobs_path,
+	     &blobs_path_size,
+	     export_handle->items_export_path,
+	     export_handle->items_export_path_size - 1,
+	     _SYSTEM_STRING( "blobs" ),
+	     5,
+	     error ) != 1 )
+#else
+	if( libcpath_path_join(
+	     &blobs_path,
+	     &blobs_path_size,
+	     export_handle->items_export_path,
+	     export_handle->items_export_path_size - 1,
+	     _SYSTEM_STRING( "blobs" ),
+	     5,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create blobs path.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcpath_path_make_directory_wide(
+	     blobs_path,
+	     error ) != 1 )
+#else
+	if( libcpath_path_make_directory(
+	     blobs_path,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to make directory: %" PRIs_SYSTEM ".",
+		 function,
+		 blobs_path );
+
+		goto on_error;
+	}
+	log_handle_printf(
+	 log_handle,
+	 "Created directory: %" PRIs_SYSTEM ".\n",
+	 blobs_path );
+
+	if( blob_store_initialize(
+	     &( export_handle->blob_store ),
+	     blobs_path,
+	     blobs_path_size - 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create blob store.",
+		 function );
+
+		goto on_error;
+	}
+	if( blob_store_set_source_file_descriptor(
+	     export_handle->blob_store,
+	     export_handle->input_file_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set source file descriptor of blob store.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 blobs_path );
+
+	return( 1 );
+
+on_error:
+	if( blobs_path != NULL )
+	{
+		memory_free(
+		 blobs_path );
+	}
+	return( -1 );
+}
+
 /* Database functions
  */
 
@@ -1364,6 +1547,23 @@ int export_handle_export_table(
 			 "\t" );
 		}
 	}
+	/* The records are exported in order hence their long values can be read
+	 * by following the long values leaf page chain
+	 */
+	if( libesedb_table_enable_sequential_long_values(
+	     table,
+	     64,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to enable sequential long values.",
+		 function );
+
+		goto on_error;
+	}
 	/* Write the record (row) values to the table file
 	 */
 	if( libesedb_table_get_number_of_records(
@@ -1418,6 +1618,7 @@ int export_handle_export_table(
 						result = exchange_export_record_msg(
 							  record,
 							  table_file_stream,
+							  export_handle->blob_store,
 							  log_handle,
 							  error );
 					}
@@ -1434,6 +1635,7 @@ int export_handle_export_table(
 						result = exchange_export_record_global(
 							  record,
 							  table_file_stream,
+							  export_handle->blob_store,
 							  log_handle,
 							  error );
 					}
@@ -1450,6 +1652,7 @@ int export_handle_export_table(
 						result = exchange_export_record_folders(
 							  record,
 							  table_file_stream,
+							  export_handle->blob_store,
 							  log_handle,
 							  error );
 					}
@@ -1463,6 +1666,7 @@ int export_handle_export_table(
 						result = exchange_export_record_mailbox(
 							  record,
 							  table_file_stream,
+							  export_handle->blob_store,
 							  log_handle,
 							  error );
 					}
@@ -1479,6 +1683,7 @@ int export_handle_export_table(
 						result = exchange_export_record_per_user_read(
 							  record,
 							  table_file_stream,
+							  export_handle->blob_store,
 							  log_handle,
 							  error );
 					}
@@ -1500,6 +1705,7 @@ int export_handle_export_table(
 						result = srumdb_export_record_guid(
 							  record,
 							  table_file_stream,
+							  export_handle->blob_store,
 							  log_handle,
 							  error );
 					}
@@ -1519,6 +1725,7 @@ int export_handle_export_table(
 						result = webcache_export_record_containers(
 							  record,
 							  table_file_stream,
+							  export_handle->blob_store,
 							  log_handle,
 							  error );
 					}
@@ -1535,6 +1742,7 @@ int export_handle_export_table(
 						result = webcache_export_record_container(
 							  record,
 							  table_file_stream,
+							  export_handle->blob_store,
 							  log_handle,
 							  error );
 					}
@@ -1555,6 +1763,7 @@ int export_handle_export_table(
 							  record,
 							  export_handle->ascii_codepage,
 							  table_file_stream,
+							  export_handle->blob_store,
 							  log_handle,
 							  error );
 					}
@@ -1571,6 +1780,7 @@ int export_handle_export_table(
 						result = windows_search_export_record_systemindex_gthr(
 							  record,
 							  table_file_stream,
+							  export_handle->blob_store,
 							  log_handle,
 							  error );
 					}
@@ -1590,6 +1800,7 @@ int export_handle_export_table(
 						result = windows_security_export_record_smtblsection(
 							  record,
 							  table_file_stream,
+							  export_handle->blob_store,
 							  log_handle,
 							  error );
 					}
@@ -1603,6 +1814,7 @@ int export_handle_export_table(
 						result = windows_security_export_record_smtblversion(
 							  record,
 							  table_file_stream,
+							  export_handle->blob_store,
 							  log_handle,
 							  error );
 					}
@@ -1618,6 +1830,7 @@ int export_handle_export_table(
 			result = export_handle_export_record(
 			          record,
 			          table_file_stream,
+			          export_handle->blob_store,
 			          log_handle,
 			          error );
 		}
@@ -2366,6 +2579,7 @@ int export_handle_export_index(
 			result = export_handle_export_record(
 			          record,
 			          index_file_stream,
+			          export_handle->blob_store,
 			          log_handle,
 			          error );
 		}
@@ -2451,6 +2665,7 @@ on_error:
 int export_handle_export_record(
      libesedb_record_t *record,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -2502,6 +2717,7 @@ int export_handle_export_record(
 		     record,
 		     value_iterator,
 		     record_file_stream,
+		     blob_store,
 		     log_handle,
 		     error ) != 1 )
 		{
@@ -2538,6 +2754,7 @@ int export_handle_export_record_value(
      libesedb_record_t *record,
      int record_value_entry,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -2844,6 +3061,7 @@ int export_handle_export_record_value(
 		          record,
 		          record_value_entry,
 		          record_file_stream,
+		          blob_store,
 		          log_handle,
 		          error );
 
@@ -3747,9 +3965,12 @@ int export_handle_export_long_record_value(
      libesedb_record_t *record,
      int record_value_entry,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
+	system_character_t hash_string[ BLOB_STORE_HASH_STRING_SIZE ];
+
 	system_character_t *value_string  = NULL;
         libesedb_long_value_t *long_value = NULL;
 	uint8_t *value_data               = NULL;
@@ -3982,6 +4203,32 @@ int export_handle_export_long_record_value(
 			break;
 
 		default:
+			if( blob_store != NULL )
+			{
+				if( blob_store_store_long_value(
+				     blob_store,
+				     long_value,
+				     hash_string,
+				     BLOB_STORE_HASH_STRING_SIZE,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to store value: %d in blob store.",
+					 function,
+					 record_value_entry );
+
+					goto on_error;
+				}
+				fprintf(
+				 record_file_stream,
+				 "%" PRIs_SYSTEM "",
+				 hash_string );
+
+				break;
+			}
 			if( libesedb_long_value_get_data_size(
 			     long_value,
 			     &value_data_size,
@@ -4411,6 +4658,25 @@ int export_handle_export_file(
 			 "Created directory: %" PRIs_SYSTEM ".\n",
 			 export_handle->items_export_path );
 
+			if( export_handle->deduplicate_long_values != 0 )
+			{
+				if( export_handle_create_blob_store(
+				     export_handle,
+				     log_handle,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create blob store.",
+					 function );
+
+					table_name = NULL;
+
+					goto on_error;
+				}
+			}
 			table_exported = 1;
 		}
 		fprintf(
@@ -4519,6 +4785,15 @@ int export_handle_export_file(
 
 		goto on_error;
 	}
+	if( export_handle->blob_store != NULL )
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "Long values: %d stored as blobs (%d copied directly), %d deduplicated.\n",
+		 export_handle->blob_store->number_of_blobs,
+		 export_handle->blob_store->number_of_direct_copies,
+		 export_handle->blob_store->number_of_duplicates );
+	}
 	return( table_exported );
 
 on_error:
@@ -26,6 +26,7 @@
 #include <file_stream.h>
 #include <types.h>
 
+#include "blob_store.h"
 #include "esedbtools_libcdata.h"
 #include "esedbtools_libcerror.h"
 #include "esedbtools_libesedb.h"
@@ -77,6 +78,18 @@ struct export_handle
 	 */
 	int ascii_codepage;
 
+	/* Value to indicate if long binary values should be stored in the blob store
+	 */
+	int deduplicate_long_values;
+
+	/* The blob store
+	 */
+	blob_store_t *blob_store;
+
+	/* The input file descriptor, used to copy uncompressed long value data directly
+	 */
+	int input_file_descriptor;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -132,6 +145,11 @@ int export_handle_close(
      export_handle_t *export_handle,
      libcerror_error_t **error );
 
+int export_handle_create_blob_store(
+     export_handle_t *export_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
 /* Database functions
  */
 int export_handle_free_table_name(
@@ -194,6 +212,7 @@ int export_handle_export_index(
 int export_handle_export_record(
      libesedb_record_t *record,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
@@ -201,6 +220,7 @@ int export_handle_export_record_value(
      libesedb_record_t *record,
      int record_value_entry,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
@@ -215,6 +235,7 @@ int export_handle_export_long_record_value(
      libesedb_record_t *record,
      int record_value_entry,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
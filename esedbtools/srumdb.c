@@ -50,6 +50,7 @@ enum SRUMDB_KNOWN_COLUMN_TYPES
 int srumdb_export_record_guid(
      libesedb_record_t *record,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -239,6 +240,7 @@ int srumdb_export_record_guid(
 				  record,
 				  value_iterator,
 				  record_file_stream,
+				  blob_store,
 				  log_handle,
 				  error );
 		}
@@ -26,6 +26,7 @@
 #include <file_stream.h>
 #include <types.h>
 
+#include "blob_store.h"
 #include "esedbtools_libcerror.h"
 #include "esedbtools_libesedb.h"
 #include "log_handle.h"
@@ -37,6 +38,7 @@ extern "C" {
 int srumdb_export_record_guid(
      libesedb_record_t *record,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
@@ -49,6 +49,7 @@ enum WEBCACHE_KNOWN_COLUMN_TYPES
 int webcache_export_record_container(
      libesedb_record_t *record,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -249,6 +250,7 @@ int webcache_export_record_container(
 				  record,
 				  value_iterator,
 				  record_file_stream,
+				  blob_store,
 				  log_handle,
 				  error );
 		}
@@ -286,6 +288,7 @@ int webcache_export_record_container(
 int webcache_export_record_containers(
      libesedb_record_t *record,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -481,6 +484,7 @@ int webcache_export_record_containers(
 				  record,
 				  value_iterator,
 				  record_file_stream,
+				  blob_store,
 				  log_handle,
 				  error );
 		}
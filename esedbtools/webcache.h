@@ -26,6 +26,7 @@
 #include <file_stream.h>
 #include <types.h>
 
+#include "blob_store.h"
 #include "esedbtools_libcerror.h"
 #include "esedbtools_libesedb.h"
 #include "log_handle.h"
@@ -37,12 +38,14 @@ extern "C" {
 int webcache_export_record_container(
      libesedb_record_t *record,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
 int webcache_export_record_containers(
      libesedb_record_t *record,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
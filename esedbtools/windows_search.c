@@ -2020,6 +2020,7 @@ int windows_search_export_record_systemindex_0a(
      libesedb_record_t *record,
      int ascii_codepage,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -2883,6 +2884,7 @@ int windows_search_export_record_systemindex_0a(
 				  record,
 				  value_iterator,
 				  record_file_stream,
+				  blob_store,
 				  log_handle,
 				  error );
 		}
@@ -2920,6 +2922,7 @@ int windows_search_export_record_systemindex_0a(
 int windows_search_export_record_systemindex_gthr(
      libesedb_record_t *record,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -3119,6 +3122,7 @@ int windows_search_export_record_systemindex_gthr(
 				  record,
 				  value_iterator,
 				  record_file_stream,
+				  blob_store,
 				  log_handle,
 				  error );
 		}
@@ -545,6 +545,7 @@ on_error:
 int windows_security_export_record_smtblversion(
      libesedb_record_t *record,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -745,6 +746,7 @@ int windows_security_export_record_smtblversion(
 				  record,
 				  value_iterator,
 				  record_file_stream,
+				  blob_store,
 				  log_handle,
 				  error );
 		}
@@ -782,6 +784,7 @@ int windows_security_export_record_smtblversion(
 int windows_security_export_record_smtblsection(
      libesedb_record_t *record,
      FILE *record_file_stream,
+     blob_store_t *blob_store,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -962,6 +965,7 @@ int windows_security_export_record_smtblsection(
 				  record,
 				  value_iterator,
 				  record_file_stream,
+				  blob_store,
 				  log_handle,
 				  error );
 		}
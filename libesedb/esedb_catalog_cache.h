@@ -0,0 +1,200 @@
+/*
+ * The catalog cache definition of an Extensible Storage Engine (ESE) Database File (EDB)
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ESEDB_CATALOG_CACHE_H )
+#define _ESEDB_CATALOG_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct esedb_catalog_cache_header esedb_catalog_cache_header_t;
+
+struct esedb_catalog_cache_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains: "ESEDBCC\0"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The number of table definitions
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_table_definitions[ 4 ];
+
+	/* The database file size
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_size[ 8 ];
+
+	/* The database file header checksum
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_header_checksum[ 4 ];
+
+	/* The database page size
+	 * Consists of 4 bytes
+	 */
+	uint8_t page_size[ 4 ];
+
+	/* The database time
+	 * Consists of 8 bytes
+	 */
+	uint8_t database_time[ 8 ];
+
+	/* The data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_size[ 4 ];
+
+	/* The data checksum
+	 * Consists of 4 bytes
+	 * Contains a XOR-32 checksum of the data
+	 */
+	uint8_t data_checksum[ 4 ];
+};
+
+/* The data consists of the table definitions, where every table definition is stored as:
+ * a 32-bit little-endian table definition data size followed by the table definition data
+ */
+
+typedef struct esedb_catalog_cache_table_definition esedb_catalog_cache_table_definition_t;
+
+struct esedb_catalog_cache_table_definition
+{
+	/* The flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t flags[ 4 ];
+
+	/* The number of column catalog definitions
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_column_catalog_definitions[ 4 ];
+
+	/* The number of index catalog definitions
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_index_catalog_definitions[ 4 ];
+
+	/* The number of leaf page descriptors
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_leaf_page_descriptors[ 4 ];
+};
+
+/* The table definition is followed by the table, long value, callback, column and index
+ * catalog definitions and the leaf page descriptors of the table page tree
+ */
+
+typedef struct esedb_catalog_cache_catalog_definition esedb_catalog_cache_catalog_definition_t;
+
+struct esedb_catalog_cache_catalog_definition
+{
+	/* The father data page (FDP) object identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t father_data_page_object_identifier[ 4 ];
+
+	/* The type
+	 * Consists of 2 bytes
+	 */
+	uint8_t type[ 2 ];
+
+	/* The identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t identifier[ 4 ];
+
+	/* The father data page (FDP) number or column type
+	 * Consists of 4 bytes
+	 */
+	uint8_t father_data_page_number[ 4 ];
+
+	/* The size (or space usage)
+	 * Consists of 4 bytes
+	 */
+	uint8_t size[ 4 ];
+
+	/* The flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t flags[ 4 ];
+
+	/* The codepage
+	 * Consists of 4 bytes
+	 */
+	uint8_t codepage[ 4 ];
+
+	/* The LCMAP flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t lcmap_flags[ 4 ];
+
+	/* The name size
+	 * Consists of 2 bytes
+	 */
+	uint8_t name_size[ 2 ];
+
+	/* The template name size
+	 * Consists of 2 bytes
+	 */
+	uint8_t template_name_size[ 2 ];
+
+	/* The default value size
+	 * Consists of 2 bytes
+	 */
+	uint8_t default_value_size[ 2 ];
+};
+
+/* The catalog definition is followed by the name, template name and default value data
+ */
+
+typedef struct esedb_catalog_cache_leaf_page_descriptor esedb_catalog_cache_leaf_page_descriptor_t;
+
+struct esedb_catalog_cache_leaf_page_descriptor
+{
+	/* The page number
+	 * Consists of 4 bytes
+	 */
+	uint8_t page_number[ 4 ];
+
+	/* The number of leaf values
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_leaf_values[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ESEDB_CATALOG_CACHE_H ) */
+
@@ -0,0 +1,1670 @@
+/*
+ * Apache Arrow C data interface functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include <errno.h>
+
+#include "libesedb_arrow.h"
+#include "libesedb_batch.h"
+#include "libesedb_catalog_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_table.h"
+#include "libesedb_types.h"
+
+/* Buffer used for empty variable size data, since consumers can expect a non NULL data buffer
+ */
+static uint8_t libesedb_arrow_empty_data[ 1 ] = { 0 };
+
+/* Retrieves the Arrow format string of a batch value format
+ * Returns a pointer to the format string or NULL if not supported
+ */
+const char *libesedb_arrow_get_format(
+             int value_format,
+             uint32_t column_type )
+{
+	if( column_type == LIBESEDB_COLUMN_TYPE_BOOLEAN )
+	{
+		return( "b" );
+	}
+	switch( value_format )
+	{
+		case LIBESEDB_BATCH_VALUE_FORMAT_INTEGER_64BIT:
+			return( "l" );
+
+		case LIBESEDB_BATCH_VALUE_FORMAT_FLOATING_POINT_64BIT:
+			return( "g" );
+
+		/* The FILETIME values are converted to micro seconds since the POSIX epoch
+		 */
+		case LIBESEDB_BATCH_VALUE_FORMAT_FILETIME:
+			return( "tsu:UTC" );
+
+		case LIBESEDB_BATCH_VALUE_FORMAT_GUID:
+			return( "w:16" );
+
+		case LIBESEDB_BATCH_VALUE_FORMAT_UTF8_STRING:
+			return( "u" );
+
+		case LIBESEDB_BATCH_VALUE_FORMAT_BINARY_DATA:
+			return( "z" );
+
+		default:
+			break;
+	}
+	return( NULL );
+}
+
+/* Retrieves the number of NULL values in a validity bitmap
+ * Returns the number of NULL values
+ */
+int64_t libesedb_arrow_get_null_count(
+         const uint8_t *validity_bitmap,
+         int number_of_values )
+{
+	int64_t null_count = 0;
+	int value_index    = 0;
+
+	if( ( validity_bitmap == NULL )
+	 || ( number_of_values <= 0 ) )
+	{
+		return( 0 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( ( validity_bitmap[ value_index / 8 ] & ( 1 << ( value_index % 8 ) ) ) == 0 )
+		{
+			null_count++;
+		}
+	}
+	return( null_count );
+}
+
+/* Releases an Arrow schema
+ */
+void libesedb_arrow_schema_release(
+      struct ArrowSchema *schema )
+{
+	int64_t child_index = 0;
+
+	if( schema == NULL )
+	{
+		return;
+	}
+	if( schema->release == NULL )
+	{
+		return;
+	}
+	if( schema->children != NULL )
+	{
+		for( child_index = 0;
+		     child_index < schema->n_children;
+		     child_index++ )
+		{
+			if( schema->children[ child_index ] != NULL )
+			{
+				if( schema->children[ child_index ]->release != NULL )
+				{
+					schema->children[ child_index ]->release(
+					 schema->children[ child_index ] );
+				}
+				memory_free(
+				 schema->children[ child_index ] );
+			}
+		}
+		memory_free(
+		 schema->children );
+
+		schema->children = NULL;
+	}
+	/* The format is a static string and not freed
+	 */
+	if( schema->name != NULL )
+	{
+		memory_free(
+		 (char *) schema->name );
+
+		schema->name = NULL;
+	}
+	schema->release = NULL;
+}
+
+/* Initializes an Arrow schema
+ * The name is copied and the format is expected to be a static string
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_arrow_schema_initialize(
+     struct ArrowSchema *schema,
+     const char *format,
+     const char *name,
+     size_t name_size,
+     int64_t flags,
+     int number_of_children,
+     libcerror_error_t **error )
+{
+	char *name_copy       = NULL;
+	static char *function = "libesedb_arrow_schema_initialize";
+	int child_index       = 0;
+
+	if( schema == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid schema.",
+		 function );
+
+		return( -1 );
+	}
+	if( format == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_size == 0 )
+	 || ( name_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_children < 0 )
+	 || ( (size_t) number_of_children > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( struct ArrowSchema * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of children value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     schema,
+	     0,
+	     sizeof( struct ArrowSchema ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear schema.",
+		 function );
+
+		return( -1 );
+	}
+	schema->format  = format;
+	schema->flags   = flags;
+	schema->release = &libesedb_arrow_schema_release;
+
+	name_copy = narrow_string_allocate(
+	             name_size );
+
+	if( name_copy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		goto on_error;
+	}
+	schema->name = name_copy;
+
+	if( name == NULL )
+	{
+		name_copy[ 0 ] = 0;
+	}
+	else
+	{
+		if( narrow_string_copy(
+		     name_copy,
+		     name,
+		     name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			goto on_error;
+		}
+		name_copy[ name_size - 1 ] = 0;
+	}
+	if( number_of_children > 0 )
+	{
+		schema->children = (struct ArrowSchema **) memory_allocate(
+		                                            sizeof( struct ArrowSchema * ) * number_of_children );
+
+		if( schema->children == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create children.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     schema->children,
+		     0,
+		     sizeof( struct ArrowSchema * ) * number_of_children ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear children.",
+			 function );
+
+			memory_free(
+			 schema->children );
+
+			schema->children = NULL;
+
+			goto on_error;
+		}
+		schema->n_children = (int64_t) number_of_children;
+
+		for( child_index = 0;
+		     child_index < number_of_children;
+		     child_index++ )
+		{
+			schema->children[ child_index ] = memory_allocate_structure(
+			                                   struct ArrowSchema );
+
+			if( schema->children[ child_index ] == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create child: %d.",
+				 function,
+				 child_index );
+
+				goto on_error;
+			}
+			/* Make sure an uninitialized child is not released
+			 */
+			schema->children[ child_index ]->release = NULL;
+		}
+	}
+	return( 1 );
+
+on_error:
+	libesedb_arrow_schema_release(
+	 schema );
+
+	return( -1 );
+}
+
+/* Sets an Arrow (struct) schema from the columns of a batch
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_arrow_schema_set_from_batch(
+     struct ArrowSchema *schema,
+     libesedb_internal_batch_t *internal_batch,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libesedb_batch_column_t *batch_column = NULL;
+	struct ArrowSchema *column_schema     = NULL;
+	uint8_t *name                         = NULL;
+	const char *format                    = NULL;
+	static char *function                 = "libesedb_arrow_schema_set_from_batch";
+	size_t name_size                      = 0;
+	int column_index                      = 0;
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_arrow_schema_initialize(
+	     schema,
+	     "+s",
+	     NULL,
+	     1,
+	     0,
+	     internal_batch->number_of_columns,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize schema.",
+		 function );
+
+		return( -1 );
+	}
+	for( column_index = 0;
+	     column_index < internal_batch->number_of_columns;
+	     column_index++ )
+	{
+		batch_column  = &( internal_batch->columns[ column_index ] );
+		column_schema = schema->children[ column_index ];
+
+		format = libesedb_arrow_get_format(
+		          batch_column->value_format,
+		          batch_column->column_type );
+
+		if( format == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value format: %d.",
+			 function,
+			 batch_column->value_format );
+
+			goto on_error;
+		}
+		if( libesedb_catalog_definition_get_utf8_name_size(
+		     batch_column->column_catalog_definition,
+		     &name_size,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column: %d name size.",
+			 function,
+			 column_index );
+
+			goto on_error;
+		}
+		if( ( name_size == 0 )
+		 || ( name_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid column: %d name size value out of bounds.",
+			 function,
+			 column_index );
+
+			goto on_error;
+		}
+		name = (uint8_t *) memory_allocate(
+		                    sizeof( uint8_t ) * name_size );
+
+		if( name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create name.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_catalog_definition_get_utf8_name(
+		     batch_column->column_catalog_definition,
+		     name,
+		     name_size,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column: %d name.",
+			 function,
+			 column_index );
+
+			goto on_error;
+		}
+		if( batch_column->is_multi_value != 0 )
+		{
+			if( libesedb_arrow_schema_initialize(
+			     column_schema,
+			     "+l",
+			     (char *) name,
+			     name_size,
+			     ARROW_FLAG_NULLABLE,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize column: %d schema.",
+				 function,
+				 column_index );
+
+				goto on_error;
+			}
+			if( libesedb_arrow_schema_initialize(
+			     column_schema->children[ 0 ],
+			     format,
+			     "item",
+			     5,
+			     0,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize column: %d item schema.",
+				 function,
+				 column_index );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( libesedb_arrow_schema_initialize(
+			     column_schema,
+			     format,
+			     (char *) name,
+			     name_size,
+			     ARROW_FLAG_NULLABLE,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize column: %d schema.",
+				 function,
+				 column_index );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 name );
+
+		name = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( name != NULL )
+	{
+		memory_free(
+		 name );
+	}
+	libesedb_arrow_schema_release(
+	 schema );
+
+	return( -1 );
+}
+
+/* Releases an Arrow array
+ * The batch that contains the buffers is freed when it is no longer referenced
+ */
+void libesedb_arrow_array_release(
+      struct ArrowArray *array )
+{
+	libesedb_arrow_array_private_t *array_private = NULL;
+	libesedb_arrow_shared_batch_t *shared_batch   = NULL;
+	int child_index                               = 0;
+
+	if( array == NULL )
+	{
+		return;
+	}
+	if( array->release == NULL )
+	{
+		return;
+	}
+	array_private = (libesedb_arrow_array_private_t *) array->private_data;
+
+	if( array_private != NULL )
+	{
+		if( array_private->children != NULL )
+		{
+			for( child_index = 0;
+			     child_index < array_private->number_of_children;
+			     child_index++ )
+			{
+				/* A child that was moved by the consumer has no release function
+				 */
+				if( array_private->children[ child_index ] != NULL )
+				{
+					if( array_private->children[ child_index ]->release != NULL )
+					{
+						array_private->children[ child_index ]->release(
+						 array_private->children[ child_index ] );
+					}
+					memory_free(
+					 array_private->children[ child_index ] );
+				}
+			}
+			memory_free(
+			 array_private->children );
+		}
+		if( array_private->boolean_values != NULL )
+		{
+			memory_free(
+			 array_private->boolean_values );
+		}
+		shared_batch = array_private->shared_batch;
+
+		if( shared_batch != NULL )
+		{
+			shared_batch->reference_count -= 1;
+
+			if( shared_batch->reference_count <= 0 )
+			{
+				libesedb_batch_free(
+				 &( shared_batch->batch ),
+				 NULL );
+
+				memory_free(
+				 shared_batch );
+			}
+		}
+		memory_free(
+		 array_private );
+	}
+	array->private_data = NULL;
+	array->release      = NULL;
+}
+
+/* Initializes an Arrow array that references a shared batch
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_arrow_array_initialize(
+     struct ArrowArray *array,
+     libesedb_arrow_shared_batch_t *shared_batch,
+     int64_t length,
+     int number_of_buffers,
+     int number_of_children,
+     libcerror_error_t **error )
+{
+	libesedb_arrow_array_private_t *array_private = NULL;
+	static char *function                         = "libesedb_arrow_array_initialize";
+	int child_index                               = 0;
+
+	if( array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid array.",
+		 function );
+
+		return( -1 );
+	}
+	if( shared_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buffers < 0 )
+	 || ( number_of_buffers > 3 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buffers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_children < 0 )
+	 || ( (size_t) number_of_children > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( struct ArrowArray * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of children value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     array,
+	     0,
+	     sizeof( struct ArrowArray ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear array.",
+		 function );
+
+		return( -1 );
+	}
+	array_private = memory_allocate_structure(
+	                 libesedb_arrow_array_private_t );
+
+	if( array_private == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create array private data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     array_private,
+	     0,
+	     sizeof( libesedb_arrow_array_private_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear array private data.",
+		 function );
+
+		memory_free(
+		 array_private );
+
+		return( -1 );
+	}
+	array_private->shared_batch = shared_batch;
+
+	shared_batch->reference_count += 1;
+
+	array->length       = length;
+	array->n_buffers    = (int64_t) number_of_buffers;
+	array->buffers      = array_private->buffers;
+	array->private_data = array_private;
+	array->release      = &libesedb_arrow_array_release;
+
+	if( number_of_children > 0 )
+	{
+		array_private->children = (struct ArrowArray **) memory_allocate(
+		                                                  sizeof( struct ArrowArray * ) * number_of_children );
+
+		if( array_private->children == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create children.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     array_private->children,
+		     0,
+		     sizeof( struct ArrowArray * ) * number_of_children ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear children.",
+			 function );
+
+			memory_free(
+			 array_private->children );
+
+			array_private->children = NULL;
+
+			goto on_error;
+		}
+		array_private->number_of_children = number_of_children;
+
+		for( child_index = 0;
+		     child_index < number_of_children;
+		     child_index++ )
+		{
+			array_private->children[ child_index ] = memory_allocate_structure(
+			                                          struct ArrowArray );
+
+			if( array_private->children[ child_index ] == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create child: %d.",
+				 function,
+				 child_index );
+
+				goto on_error;
+			}
+			/* Make sure an uninitialized child is not released
+			 */
+			array_private->children[ child_index ]->release = NULL;
+		}
+		array->n_children = (int64_t) number_of_children;
+		array->children   = array_private->children;
+	}
+	return( 1 );
+
+on_error:
+	libesedb_arrow_array_release(
+	 array );
+
+	return( -1 );
+}
+
+/* Sets an Arrow array from the (fixed or variable size) values of a batch column
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_arrow_array_set_values(
+     struct ArrowArray *array,
+     libesedb_arrow_shared_batch_t *shared_batch,
+     libesedb_batch_column_t *batch_column,
+     int number_of_values,
+     const uint8_t *validity_bitmap,
+     libcerror_error_t **error )
+{
+	libesedb_arrow_array_private_t *array_private = NULL;
+	uint8_t *boolean_values                       = NULL;
+	static char *function                         = "libesedb_arrow_array_set_values";
+	size_t boolean_values_size                    = 0;
+	int64_t null_count                            = 0;
+	int64_t value_64bit                           = 0;
+	int number_of_buffers                         = 2;
+	int value_index                               = 0;
+
+	if( batch_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch column.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_column->value_size == 0 )
+	{
+		number_of_buffers = 3;
+	}
+	if( libesedb_arrow_array_initialize(
+	     array,
+	     shared_batch,
+	     (int64_t) number_of_values,
+	     number_of_buffers,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize array.",
+		 function );
+
+		return( -1 );
+	}
+	array_private = (libesedb_arrow_array_private_t *) array->private_data;
+
+	null_count = libesedb_arrow_get_null_count(
+	              validity_bitmap,
+	              number_of_values );
+
+	/* The validity bitmap can be omitted if there are no NULL values
+	 */
+	if( null_count > 0 )
+	{
+		array_private->buffers[ 0 ] = validity_bitmap;
+	}
+	array->null_count = null_count;
+
+	if( batch_column->value_size == 0 )
+	{
+		array_private->buffers[ 1 ] = batch_column->offsets;
+
+		if( batch_column->data != NULL )
+		{
+			array_private->buffers[ 2 ] = batch_column->data;
+		}
+		else
+		{
+			array_private->buffers[ 2 ] = libesedb_arrow_empty_data;
+		}
+	}
+	else if( batch_column->column_type == LIBESEDB_COLUMN_TYPE_BOOLEAN )
+	{
+		/* Arrow stores boolean values bit packed
+		 */
+		boolean_values_size = ( (size_t) number_of_values + 7 ) / 8;
+
+		if( boolean_values_size == 0 )
+		{
+			boolean_values_size = 1;
+		}
+		boolean_values = (uint8_t *) memory_allocate(
+		                              boolean_values_size );
+
+		if( boolean_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create boolean values.",
+			 function );
+
+			goto on_error;
+		}
+		array_private->boolean_values = boolean_values;
+
+		if( memory_set(
+		     boolean_values,
+		     0,
+		     boolean_values_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear boolean values.",
+			 function );
+
+			goto on_error;
+		}
+		for( value_index = 0;
+		     value_index < number_of_values;
+		     value_index++ )
+		{
+			memory_copy(
+			 &value_64bit,
+			 &( batch_column->values[ (size_t) value_index * 8 ] ),
+			 sizeof( int64_t ) );
+
+			if( value_64bit != 0 )
+			{
+				boolean_values[ value_index / 8 ] |= (uint8_t) ( 1 << ( value_index % 8 ) );
+			}
+		}
+		array_private->buffers[ 1 ] = boolean_values;
+	}
+	else
+	{
+		if( batch_column->value_format == LIBESEDB_BATCH_VALUE_FORMAT_FILETIME )
+		{
+			/* The values are converted in place since the batch is owned by the arrays
+			 */
+			for( value_index = 0;
+			     value_index < number_of_values;
+			     value_index++ )
+			{
+				memory_copy(
+				 &value_64bit,
+				 &( batch_column->values[ (size_t) value_index * 8 ] ),
+				 sizeof( int64_t ) );
+
+				value_64bit = (int64_t) ( (uint64_t) value_64bit / 10 ) - ( LIBESEDB_ARROW_FILETIME_POSIX_EPOCH / 10 );
+
+				memory_copy(
+				 &( batch_column->values[ (size_t) value_index * 8 ] ),
+				 &value_64bit,
+				 sizeof( int64_t ) );
+			}
+		}
+		if( batch_column->values != NULL )
+		{
+			array_private->buffers[ 1 ] = batch_column->values;
+		}
+		else
+		{
+			array_private->buffers[ 1 ] = libesedb_arrow_empty_data;
+		}
+	}
+	return( 1 );
+
+on_error:
+	libesedb_arrow_array_release(
+	 array );
+
+	return( -1 );
+}
+
+/* Sets an Arrow array from a batch column
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_arrow_array_set_column(
+     struct ArrowArray *array,
+     libesedb_arrow_shared_batch_t *shared_batch,
+     libesedb_batch_column_t *batch_column,
+     int number_of_records,
+     libcerror_error_t **error )
+{
+	libesedb_arrow_array_private_t *array_private = NULL;
+	static char *function                         = "libesedb_arrow_array_set_column";
+	int64_t null_count                            = 0;
+
+	if( batch_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch column.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_column->is_multi_value == 0 )
+	{
+		if( libesedb_arrow_array_set_values(
+		     array,
+		     shared_batch,
+		     batch_column,
+		     number_of_records,
+		     batch_column->validity_bitmap,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set array values.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libesedb_arrow_array_initialize(
+	     array,
+	     shared_batch,
+	     (int64_t) number_of_records,
+	     2,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize array.",
+		 function );
+
+		return( -1 );
+	}
+	array_private = (libesedb_arrow_array_private_t *) array->private_data;
+
+	null_count = libesedb_arrow_get_null_count(
+	              batch_column->validity_bitmap,
+	              number_of_records );
+
+	if( null_count > 0 )
+	{
+		array_private->buffers[ 0 ] = batch_column->validity_bitmap;
+	}
+	array->null_count = null_count;
+
+	array_private->buffers[ 1 ] = batch_column->list_offsets;
+
+	/* The list values themselves cannot be NULL
+	 */
+	if( libesedb_arrow_array_set_values(
+	     array_private->children[ 0 ],
+	     shared_batch,
+	     batch_column,
+	     batch_column->number_of_elements,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set list values array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libesedb_arrow_array_release(
+	 array );
+
+	return( -1 );
+}
+
+/* Sets an Arrow (struct) array from a shared batch
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_arrow_array_set_from_batch(
+     struct ArrowArray *array,
+     libesedb_arrow_shared_batch_t *shared_batch,
+     libcerror_error_t **error )
+{
+	libesedb_arrow_array_private_t *array_private = NULL;
+	libesedb_internal_batch_t *internal_batch     = NULL;
+	static char *function                         = "libesedb_arrow_array_set_from_batch";
+	int column_index                              = 0;
+
+	if( shared_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( shared_batch->batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid shared batch - missing batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libesedb_internal_batch_t *) shared_batch->batch;
+
+	if( libesedb_arrow_array_initialize(
+	     array,
+	     shared_batch,
+	     (int64_t) internal_batch->number_of_records,
+	     1,
+	     internal_batch->number_of_columns,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize array.",
+		 function );
+
+		return( -1 );
+	}
+	array_private = (libesedb_arrow_array_private_t *) array->private_data;
+
+	for( column_index = 0;
+	     column_index < internal_batch->number_of_columns;
+	     column_index++ )
+	{
+		if( libesedb_arrow_array_set_column(
+		     array_private->children[ column_index ],
+		     shared_batch,
+		     &( internal_batch->columns[ column_index ] ),
+		     internal_batch->number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set column: %d array.",
+			 function,
+			 column_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	libesedb_arrow_array_release(
+	 array );
+
+	return( -1 );
+}
+
+/* Initializes an Arrow array stream of the records of a table
+ * The table must remain available until the stream is released
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_arrow_stream_initialize(
+     struct ArrowArrayStream *stream,
+     libesedb_table_t *table,
+     const int *column_entries,
+     int number_of_column_entries,
+     int maximum_number_of_records,
+     libcerror_error_t **error )
+{
+	libesedb_arrow_stream_private_t *stream_private = NULL;
+	static char *function                           = "libesedb_arrow_stream_initialize";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_entries != NULL )
+	{
+		if( ( number_of_column_entries <= 0 )
+		 || ( (size_t) number_of_column_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of column entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( maximum_number_of_records <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of records value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	stream_private = memory_allocate_structure(
+	                  libesedb_arrow_stream_private_t );
+
+	if( stream_private == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stream private data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     stream_private,
+	     0,
+	     sizeof( libesedb_arrow_stream_private_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stream private data.",
+		 function );
+
+		goto on_error;
+	}
+	if( column_entries != NULL )
+	{
+		stream_private->column_entries = (int *) memory_allocate(
+		                                          sizeof( int ) * number_of_column_entries );
+
+		if( stream_private->column_entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create column entries.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     stream_private->column_entries,
+		     column_entries,
+		     sizeof( int ) * number_of_column_entries ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy column entries.",
+			 function );
+
+			goto on_error;
+		}
+		stream_private->number_of_column_entries = number_of_column_entries;
+	}
+	stream_private->table                     = table;
+	stream_private->maximum_number_of_records = maximum_number_of_records;
+
+	stream->get_schema     = &libesedb_arrow_stream_get_schema;
+	stream->get_next       = &libesedb_arrow_stream_get_next;
+	stream->get_last_error = &libesedb_arrow_stream_get_last_error;
+	stream->release        = &libesedb_arrow_stream_release;
+	stream->private_data   = stream_private;
+
+	return( 1 );
+
+on_error:
+	if( stream_private != NULL )
+	{
+		if( stream_private->column_entries != NULL )
+		{
+			memory_free(
+			 stream_private->column_entries );
+		}
+		memory_free(
+		 stream_private );
+	}
+	return( -1 );
+}
+
+/* Retrieves the Arrow schema of an Arrow array stream
+ * Returns 0 if successful or an errno value on error
+ */
+int libesedb_arrow_stream_get_schema(
+     struct ArrowArrayStream *stream,
+     struct ArrowSchema *schema )
+{
+	libesedb_arrow_stream_private_t *stream_private = NULL;
+	libesedb_batch_t *batch                         = NULL;
+	libesedb_internal_table_t *internal_table       = NULL;
+	libcerror_error_t *error                        = NULL;
+	static char *function                           = "libesedb_arrow_stream_get_schema";
+
+	if( ( stream == NULL )
+	 || ( stream->private_data == NULL )
+	 || ( schema == NULL ) )
+	{
+		return( EINVAL );
+	}
+	stream_private = (libesedb_arrow_stream_private_t *) stream->private_data;
+	internal_table = (libesedb_internal_table_t *) stream_private->table;
+
+	stream_private->last_error[ 0 ] = 0;
+
+	if( libesedb_batch_initialize(
+	     &batch,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create batch.",
+		 function );
+
+		goto on_error;
+	}
+	/* The columns of the batch are used to determine the schema
+	 * no records are read
+	 */
+	if( libesedb_batch_set_columns(
+	     (libesedb_internal_batch_t *) batch,
+	     internal_table->table_definition,
+	     internal_table->template_table_definition,
+	     stream_private->column_entries,
+	     stream_private->number_of_column_entries,
+	     1,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set batch columns.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_arrow_schema_set_from_batch(
+	     schema,
+	     (libesedb_internal_batch_t *) batch,
+	     internal_table->io_handle->ascii_codepage,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set schema.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_batch_free(
+	     &batch,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free batch.",
+		 function );
+
+		goto on_error;
+	}
+	return( 0 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_sprint(
+		 error,
+		 stream_private->last_error,
+		 sizeof( stream_private->last_error ) );
+
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch != NULL )
+	{
+		libesedb_batch_free(
+		 &batch,
+		 NULL );
+	}
+	return( EIO );
+}
+
+/* Retrieves the next Arrow array of an Arrow array stream
+ * The end of the stream is indicated by an array without a release function
+ * Returns 0 if successful or an errno value on error
+ */
+int libesedb_arrow_stream_get_next(
+     struct ArrowArrayStream *stream,
+     struct ArrowArray *array )
+{
+	libesedb_arrow_shared_batch_t *shared_batch     = NULL;
+	libesedb_arrow_stream_private_t *stream_private = NULL;
+	libcerror_error_t *error                        = NULL;
+	static char *function                           = "libesedb_arrow_stream_get_next";
+	int number_of_records                           = 0;
+	int result                                      = 0;
+
+	if( ( stream == NULL )
+	 || ( stream->private_data == NULL )
+	 || ( array == NULL ) )
+	{
+		return( EINVAL );
+	}
+	stream_private = (libesedb_arrow_stream_private_t *) stream->private_data;
+
+	stream_private->last_error[ 0 ] = 0;
+
+	if( memory_set(
+	     array,
+	     0,
+	     sizeof( struct ArrowArray ) ) == NULL )
+	{
+		return( ENOMEM );
+	}
+	shared_batch = memory_allocate_structure(
+	                libesedb_arrow_shared_batch_t );
+
+	if( shared_batch == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create shared batch.",
+		 function );
+
+		goto on_error;
+	}
+	shared_batch->batch           = NULL;
+	shared_batch->reference_count = 0;
+
+	if( libesedb_batch_initialize(
+	     &( shared_batch->batch ),
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create batch.",
+		 function );
+
+		goto on_error;
+	}
+	result = libesedb_table_read_batch(
+	          stream_private->table,
+	          stream_private->next_record_entry,
+	          stream_private->maximum_number_of_records,
+	          stream_private->column_entries,
+	          stream_private->number_of_column_entries,
+	          shared_batch->batch,
+	          &error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read batch at record: %d.",
+		 function,
+		 stream_private->next_record_entry );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		/* The end of the stream was reached
+		 */
+		libesedb_batch_free(
+		 &( shared_batch->batch ),
+		 NULL );
+
+		memory_free(
+		 shared_batch );
+
+		return( 0 );
+	}
+	if( libesedb_batch_get_number_of_records(
+	     shared_batch->batch,
+	     &number_of_records,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records in batch.",
+		 function );
+
+		goto on_error;
+	}
+	/* The reference held by the stream is released after the arrays
+	 * have taken their own references to the shared batch
+	 */
+	shared_batch->reference_count = 1;
+
+	result = libesedb_arrow_array_set_from_batch(
+	          array,
+	          shared_batch,
+	          &error );
+
+	shared_batch->reference_count -= 1;
+
+	if( shared_batch->reference_count > 0 )
+	{
+		shared_batch = NULL;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set array.",
+		 function );
+
+		goto on_error;
+	}
+	stream_private->next_record_entry += number_of_records;
+
+	return( 0 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_sprint(
+		 error,
+		 stream_private->last_error,
+		 sizeof( stream_private->last_error ) );
+
+		libcerror_error_free(
+		 &error );
+	}
+	if( shared_batch != NULL )
+	{
+		if( shared_batch->batch != NULL )
+		{
+			libesedb_batch_free(
+			 &( shared_batch->batch ),
+			 NULL );
+		}
+		memory_free(
+		 shared_batch );
+	}
+	return( EIO );
+}
+
+/* Retrieves a description of the last error of an Arrow array stream
+ * Returns a pointer to the description or NULL if not available
+ */
+const char *libesedb_arrow_stream_get_last_error(
+             struct ArrowArrayStream *stream )
+{
+	libesedb_arrow_stream_private_t *stream_private = NULL;
+
+	if( ( stream == NULL )
+	 || ( stream->private_data == NULL ) )
+	{
+		return( NULL );
+	}
+	stream_private = (libesedb_arrow_stream_private_t *) stream->private_data;
+
+	if( stream_private->last_error[ 0 ] == 0 )
+	{
+		return( NULL );
+	}
+	return( stream_private->last_error );
+}
+
+/* Releases an Arrow array stream
+ */
+void libesedb_arrow_stream_release(
+      struct ArrowArrayStream *stream )
+{
+	libesedb_arrow_stream_private_t *stream_private = NULL;
+
+	if( stream == NULL )
+	{
+		return;
+	}
+	if( stream->release == NULL )
+	{
+		return;
+	}
+	stream_private = (libesedb_arrow_stream_private_t *) stream->private_data;
+
+	if( stream_private != NULL )
+	{
+		if( stream_private->column_entries != NULL )
+		{
+			memory_free(
+			 stream_private->column_entries );
+		}
+		memory_free(
+		 stream_private );
+	}
+	stream->private_data = NULL;
+	stream->release      = NULL;
+}
+
@@ -0,0 +1,251 @@
+/*
+ * Apache Arrow C data interface functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_ARROW_H )
+#define _LIBESEDB_ARROW_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_batch.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The structures below are defined by the Apache Arrow C data interface
+ * specification and are ABI stable, the guards allow them to coexist with
+ * the definitions provided by other Arrow aware code
+ */
+#if !defined( ARROW_C_DATA_INTERFACE )
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED	1
+#define ARROW_FLAG_NULLABLE		2
+#define ARROW_FLAG_MAP_KEYS_SORTED	4
+
+struct ArrowSchema
+{
+	const char *format;
+	const char *name;
+	const char *metadata;
+	int64_t flags;
+	int64_t n_children;
+	struct ArrowSchema **children;
+	struct ArrowSchema *dictionary;
+
+	void (*release)( struct ArrowSchema * );
+
+	void *private_data;
+};
+
+struct ArrowArray
+{
+	int64_t length;
+	int64_t null_count;
+	int64_t offset;
+	int64_t n_buffers;
+	int64_t n_children;
+	const void **buffers;
+	struct ArrowArray **children;
+	struct ArrowArray *dictionary;
+
+	void (*release)( struct ArrowArray * );
+
+	void *private_data;
+};
+
+#endif /* !defined( ARROW_C_DATA_INTERFACE ) */
+
+#if !defined( ARROW_C_STREAM_INTERFACE )
+#define ARROW_C_STREAM_INTERFACE
+
+struct ArrowArrayStream
+{
+	int (*get_schema)( struct ArrowArrayStream *, struct ArrowSchema *out );
+	int (*get_next)( struct ArrowArrayStream *, struct ArrowArray *out );
+	const char *(*get_last_error)( struct ArrowArrayStream * );
+
+	void (*release)( struct ArrowArrayStream * );
+
+	void *private_data;
+};
+
+#endif /* !defined( ARROW_C_STREAM_INTERFACE ) */
+
+/* The FILETIME of the POSIX epoch (1970-01-01 00:00:00) in 100th nano seconds
+ */
+#define LIBESEDB_ARROW_FILETIME_POSIX_EPOCH	(int64_t) 116444736000000000LL
+
+typedef struct libesedb_arrow_shared_batch libesedb_arrow_shared_batch_t;
+
+struct libesedb_arrow_shared_batch
+{
+	/* The batch
+	 */
+	libesedb_batch_t *batch;
+
+	/* The number of arrays referencing the batch
+	 */
+	int reference_count;
+};
+
+typedef struct libesedb_arrow_array_private libesedb_arrow_array_private_t;
+
+struct libesedb_arrow_array_private
+{
+	/* The shared batch that contains the buffers
+	 */
+	libesedb_arrow_shared_batch_t *shared_batch;
+
+	/* The buffers
+	 */
+	const void *buffers[ 3 ];
+
+	/* The children
+	 */
+	struct ArrowArray **children;
+
+	/* The number of children
+	 */
+	int number_of_children;
+
+	/* The (bit packed) boolean values
+	 */
+	uint8_t *boolean_values;
+};
+
+typedef struct libesedb_arrow_stream_private libesedb_arrow_stream_private_t;
+
+struct libesedb_arrow_stream_private
+{
+	/* The table
+	 */
+	libesedb_table_t *table;
+
+	/* The column entries or NULL for all columns
+	 */
+	int *column_entries;
+
+	/* The number of column entries
+	 */
+	int number_of_column_entries;
+
+	/* The maximum number of records per batch
+	 */
+	int maximum_number_of_records;
+
+	/* The next record entry
+	 */
+	int next_record_entry;
+
+	/* The last error string
+	 */
+	char last_error[ 512 ];
+};
+
+const char *libesedb_arrow_get_format(
+             int value_format,
+             uint32_t column_type );
+
+int64_t libesedb_arrow_get_null_count(
+         const uint8_t *validity_bitmap,
+         int number_of_values );
+
+void libesedb_arrow_schema_release(
+      struct ArrowSchema *schema );
+
+int libesedb_arrow_schema_initialize(
+     struct ArrowSchema *schema,
+     const char *format,
+     const char *name,
+     size_t name_size,
+     int64_t flags,
+     int number_of_children,
+     libcerror_error_t **error );
+
+int libesedb_arrow_schema_set_from_batch(
+     struct ArrowSchema *schema,
+     libesedb_internal_batch_t *internal_batch,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+void libesedb_arrow_array_release(
+      struct ArrowArray *array );
+
+int libesedb_arrow_array_initialize(
+     struct ArrowArray *array,
+     libesedb_arrow_shared_batch_t *shared_batch,
+     int64_t length,
+     int number_of_buffers,
+     int number_of_children,
+     libcerror_error_t **error );
+
+int libesedb_arrow_array_set_values(
+     struct ArrowArray *array,
+     libesedb_arrow_shared_batch_t *shared_batch,
+     libesedb_batch_column_t *batch_column,
+     int number_of_values,
+     const uint8_t *validity_bitmap,
+     libcerror_error_t **error );
+
+int libesedb_arrow_array_set_column(
+     struct ArrowArray *array,
+     libesedb_arrow_shared_batch_t *shared_batch,
+     libesedb_batch_column_t *batch_column,
+     int number_of_records,
+     libcerror_error_t **error );
+
+int libesedb_arrow_array_set_from_batch(
+     struct ArrowArray *array,
+     libesedb_arrow_shared_batch_t *shared_batch,
+     libcerror_error_t **error );
+
+int libesedb_arrow_stream_initialize(
+     struct ArrowArrayStream *stream,
+     libesedb_table_t *table,
+     const int *column_entries,
+     int number_of_column_entries,
+     int maximum_number_of_records,
+     libcerror_error_t **error );
+
+int libesedb_arrow_stream_get_schema(
+     struct ArrowArrayStream *stream,
+     struct ArrowSchema *schema );
+
+int libesedb_arrow_stream_get_next(
+     struct ArrowArrayStream *stream,
+     struct ArrowArray *array );
+
+const char *libesedb_arrow_stream_get_last_error(
+             struct ArrowArrayStream *stream );
+
+void libesedb_arrow_stream_release(
+      struct ArrowArrayStream *stream );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_ARROW_H ) */
+
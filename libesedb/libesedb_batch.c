@@ -0,0 +1,2725 @@
+/*
+ * Batch (columnar record set) functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_batch.h"
+#include "libesedb_catalog_definition.h"
+#include "libesedb_compression.h"
+#include "libesedb_data_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libfdata.h"
+#include "libesedb_libuna.h"
+#include "libesedb_long_value.h"
+#include "libesedb_record.h"
+#include "libesedb_table.h"
+#include "libesedb_table_definition.h"
+#include "libesedb_types.h"
+
+/* Creates a batch
+ * Make sure the value batch is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_batch_initialize(
+     libesedb_batch_t **batch,
+     libcerror_error_t **error )
+{
+	libesedb_internal_batch_t *internal_batch = NULL;
+	static char *function                     = "libesedb_batch_initialize";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = memory_allocate_structure(
+	                  libesedb_internal_batch_t );
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_batch,
+	     0,
+	     sizeof( libesedb_internal_batch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch.",
+		 function );
+
+		goto on_error;
+	}
+	*batch = (libesedb_batch_t *) internal_batch;
+
+	return( 1 );
+
+on_error:
+	if( internal_batch != NULL )
+	{
+		memory_free(
+		 internal_batch );
+	}
+	return( -1 );
+}
+
+/* Frees a batch
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_batch_free(
+     libesedb_batch_t **batch,
+     libcerror_error_t **error )
+{
+	libesedb_internal_batch_t *internal_batch = NULL;
+	static char *function                     = "libesedb_batch_free";
+	int result                                = 1;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch != NULL )
+	{
+		internal_batch = (libesedb_internal_batch_t *) *batch;
+		*batch         = NULL;
+
+		if( libesedb_batch_clear(
+		     internal_batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear batch.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_batch );
+	}
+	return( result );
+}
+
+/* Clears a batch
+ * Frees the column buffers
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_batch_clear(
+     libesedb_internal_batch_t *internal_batch,
+     libcerror_error_t **error )
+{
+	libesedb_batch_column_t *batch_column = NULL;
+	static char *function                 = "libesedb_batch_clear";
+	int column_index                      = 0;
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_batch->columns != NULL )
+	{
+		/* The column catalog definitions are freed elsewhere
+		 */
+		for( column_index = 0;
+		     column_index < internal_batch->number_of_columns;
+		     column_index++ )
+		{
+			batch_column = &( internal_batch->columns[ column_index ] );
+
+			if( batch_column->values != NULL )
+			{
+				memory_free(
+				 batch_column->values );
+			}
+			if( batch_column->offsets != NULL )
+			{
+				memory_free(
+				 batch_column->offsets );
+			}
+			if( batch_column->data != NULL )
+			{
+				memory_free(
+				 batch_column->data );
+			}
+			if( batch_column->validity_bitmap != NULL )
+			{
+				memory_free(
+				 batch_column->validity_bitmap );
+			}
+			if( batch_column->list_offsets != NULL )
+			{
+				memory_free(
+				 batch_column->list_offsets );
+			}
+		}
+		memory_free(
+		 internal_batch->columns );
+
+		internal_batch->columns = NULL;
+	}
+	internal_batch->table_definition          = NULL;
+	internal_batch->number_of_columns         = 0;
+	internal_batch->number_of_records         = 0;
+	internal_batch->maximum_number_of_records = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the value format and size of the values of a specific column type
+ * The value size is 0 for variable size values
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_batch_get_value_format(
+     uint32_t column_type,
+     int *value_format,
+     size_t *value_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_batch_get_value_format";
+
+	if( value_format == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value format.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value size.",
+		 function );
+
+		return( -1 );
+	}
+	switch( column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+			*value_format = LIBESEDB_BATCH_VALUE_FORMAT_INTEGER_64BIT;
+			*value_size   = 8;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			*value_format = LIBESEDB_BATCH_VALUE_FORMAT_FLOATING_POINT_64BIT;
+			*value_size   = 8;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			*value_format = LIBESEDB_BATCH_VALUE_FORMAT_FILETIME;
+			*value_size   = 8;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_GUID:
+			*value_format = LIBESEDB_BATCH_VALUE_FORMAT_GUID;
+			*value_size   = 16;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_TEXT:
+		case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+			*value_format = LIBESEDB_BATCH_VALUE_FORMAT_UTF8_STRING;
+			*value_size   = 0;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_NULL:
+		case LIBESEDB_COLUMN_TYPE_BINARY_DATA:
+		case LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA:
+		case LIBESEDB_COLUMN_TYPE_SUPER_LARGE_VALUE:
+			*value_format = LIBESEDB_BATCH_VALUE_FORMAT_BINARY_DATA;
+			*value_size   = 0;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column type: %" PRIu32 ".",
+			 function,
+			 column_type );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the columns of a batch
+ * If column entries is NULL all the columns of the table, including those
+ * of the template table, are used.
+ * The column buffers are reused if the columns did not change and the buffers
+ * are large enough to contain the maximum number of records
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_batch_set_columns(
+     libesedb_internal_batch_t *internal_batch,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     const int *column_entries,
+     int number_of_column_entries,
+     int maximum_number_of_records,
+     libcerror_error_t **error )
+{
+	libesedb_batch_column_t *batch_column                    = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	static char *function                                    = "libesedb_batch_set_columns";
+	size_t bitmap_size                                       = 0;
+	size_t columns_size                                      = 0;
+	size_t offsets_size                                      = 0;
+	size_t values_size                                       = 0;
+	int column_entry                                         = 0;
+	int column_index                                         = 0;
+	int number_of_columns                                    = 0;
+	int reuse_columns                                        = 0;
+	int template_table_number_of_columns                     = 0;
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_records <= 0 )
+	 || ( (size_t) maximum_number_of_records > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 16 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_table_definition != NULL )
+	{
+		if( libesedb_table_definition_get_number_of_column_catalog_definitions(
+		     template_table_definition,
+		     &template_table_number_of_columns,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of columns from template table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libesedb_table_definition_get_number_of_column_catalog_definitions(
+	     table_definition,
+	     &number_of_columns,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of columns from table.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_columns += template_table_number_of_columns;
+
+	if( column_entries == NULL )
+	{
+		number_of_column_entries = number_of_columns;
+	}
+	if( ( number_of_column_entries <= 0 )
+	 || ( (size_t) number_of_column_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libesedb_batch_column_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of column entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_batch->columns != NULL )
+	 && ( internal_batch->table_definition == table_definition )
+	 && ( internal_batch->number_of_columns == number_of_column_entries )
+	 && ( internal_batch->maximum_number_of_records >= maximum_number_of_records ) )
+	{
+		reuse_columns = 1;
+
+		for( column_index = 0;
+		     column_index < number_of_column_entries;
+		     column_index++ )
+		{
+			if( column_entries == NULL )
+			{
+				column_entry = column_index;
+			}
+			else
+			{
+				column_entry = column_entries[ column_index ];
+			}
+			if( internal_batch->columns[ column_index ].column_entry != column_entry )
+			{
+				reuse_columns = 0;
+
+				break;
+			}
+		}
+	}
+	if( reuse_columns != 0 )
+	{
+		for( column_index = 0;
+		     column_index < number_of_column_entries;
+		     column_index++ )
+		{
+			batch_column = &( internal_batch->columns[ column_index ] );
+
+			batch_column->number_of_elements = 0;
+			batch_column->data_size          = 0;
+
+			if( batch_column->offsets != NULL )
+			{
+				batch_column->offsets[ 0 ] = 0;
+			}
+			if( batch_column->list_offsets != NULL )
+			{
+				batch_column->list_offsets[ 0 ] = 0;
+			}
+		}
+		internal_batch->number_of_records = 0;
+
+		return( 1 );
+	}
+	if( libesedb_batch_clear(
+	     internal_batch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear batch.",
+		 function );
+
+		return( -1 );
+	}
+	columns_size = sizeof( libesedb_batch_column_t ) * number_of_column_entries;
+
+	internal_batch->columns = (libesedb_batch_column_t *) memory_allocate(
+	                                                       columns_size );
+
+	if( internal_batch->columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create columns.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_batch->columns,
+	     0,
+	     columns_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear columns.",
+		 function );
+
+		memory_free(
+		 internal_batch->columns );
+
+		internal_batch->columns = NULL;
+
+		goto on_error;
+	}
+	internal_batch->number_of_columns = number_of_column_entries;
+
+	bitmap_size  = ( (size_t) maximum_number_of_records + 7 ) / 8;
+	offsets_size = sizeof( int32_t ) * ( (size_t) maximum_number_of_records + 1 );
+
+	for( column_index = 0;
+	     column_index < number_of_column_entries;
+	     column_index++ )
+	{
+		batch_column = &( internal_batch->columns[ column_index ] );
+
+		if( column_entries == NULL )
+		{
+			column_entry = column_index;
+		}
+		else
+		{
+			column_entry = column_entries[ column_index ];
+		}
+		if( ( column_entry < 0 )
+		 || ( column_entry >= number_of_columns ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid column entry: %d value out of bounds.",
+			 function,
+			 column_index );
+
+			goto on_error;
+		}
+		if( libesedb_data_definition_get_fixed_size_value_offset(
+		     table_definition,
+		     template_table_definition,
+		     column_entry,
+		     &column_catalog_definition,
+		     &( batch_column->fixed_size_value_offset ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve fixed size value offset of column: %d.",
+			 function,
+			 column_entry );
+
+			goto on_error;
+		}
+		if( libesedb_catalog_definition_get_column_type(
+		     column_catalog_definition,
+		     &( batch_column->column_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve catalog definition column type.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_batch_get_value_format(
+		     batch_column->column_type,
+		     &( batch_column->value_format ),
+		     &( batch_column->value_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value format of column: %d.",
+			 function,
+			 column_entry );
+
+			goto on_error;
+		}
+		batch_column->column_entry               = column_entry;
+		batch_column->column_catalog_definition  = column_catalog_definition;
+		batch_column->maximum_number_of_elements = maximum_number_of_records;
+
+		if( ( column_catalog_definition->flags & LIBESEDB_COLUMN_FLAG_IS_MULTI_VALUE ) != 0 )
+		{
+			batch_column->is_multi_value = 1;
+
+			batch_column->list_offsets = (int32_t *) memory_allocate(
+			                                          offsets_size );
+
+			if( batch_column->list_offsets == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create list offsets.",
+				 function );
+
+				goto on_error;
+			}
+			batch_column->list_offsets[ 0 ] = 0;
+		}
+
+		batch_column->validity_bitmap = (uint8_t *) memory_allocate(
+		                                             bitmap_size );
+
+		if( batch_column->validity_bitmap == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create validity bitmap.",
+			 function );
+
+			goto on_error;
+		}
+		if( batch_column->value_size > 0 )
+		{
+			values_size = batch_column->value_size * (size_t) maximum_number_of_records;
+
+			batch_column->values = (uint8_t *) memory_allocate(
+			                                    values_size );
+
+			if( batch_column->values == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create values.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			batch_column->offsets = (int32_t *) memory_allocate(
+			                                     offsets_size );
+
+			if( batch_column->offsets == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create offsets.",
+				 function );
+
+				goto on_error;
+			}
+			batch_column->offsets[ 0 ] = 0;
+		}
+	}
+	internal_batch->table_definition          = table_definition;
+	internal_batch->number_of_records         = 0;
+	internal_batch->maximum_number_of_records = maximum_number_of_records;
+
+	return( 1 );
+
+on_error:
+	libesedb_batch_clear(
+	 internal_batch,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Resizes the (variable size) value data of a batch column
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_batch_column_resize_data(
+     libesedb_batch_column_t *batch_column,
+     size_t required_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation      = NULL;
+	static char *function      = "libesedb_batch_column_resize_data";
+	size_t allocated_data_size = 0;
+
+	if( batch_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch column.",
+		 function );
+
+		return( -1 );
+	}
+	/* The offsets are stored as 32-bit signed integers
+	 */
+	if( ( required_data_size > (size_t) INT_MAX )
+	 || ( required_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid required data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_data_size <= batch_column->allocated_data_size )
+	{
+		return( 1 );
+	}
+	allocated_data_size = batch_column->allocated_data_size * 2;
+
+	if( allocated_data_size < 4096 )
+	{
+		allocated_data_size = 4096;
+	}
+	if( allocated_data_size < required_data_size )
+	{
+		allocated_data_size = required_data_size;
+	}
+	if( allocated_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		allocated_data_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE;
+	}
+	reallocation = (uint8_t *) memory_reallocate(
+	                            batch_column->data,
+	                            allocated_data_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize data.",
+		 function );
+
+		return( -1 );
+	}
+	batch_column->data                = reallocation;
+	batch_column->allocated_data_size = allocated_data_size;
+
+	return( 1 );
+}
+
+/* Resizes the (fixed or variable size) values of a batch column
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_batch_column_resize_elements(
+     libesedb_batch_column_t *batch_column,
+     int number_of_elements,
+     libcerror_error_t **error )
+{
+	void *reallocation             = NULL;
+	static char *function          = "libesedb_batch_column_resize_elements";
+	size_t element_size            = 0;
+	int maximum_number_of_elements = 0;
+
+	if( batch_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch column.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_elements < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of elements value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_elements <= batch_column->maximum_number_of_elements )
+	{
+		return( 1 );
+	}
+	if( batch_column->value_size > 0 )
+	{
+		element_size = batch_column->value_size;
+	}
+	else
+	{
+		element_size = sizeof( int32_t );
+	}
+	if( batch_column->maximum_number_of_elements > ( INT_MAX / 2 ) )
+	{
+		maximum_number_of_elements = INT_MAX - 1;
+	}
+	else
+	{
+		maximum_number_of_elements = batch_column->maximum_number_of_elements * 2;
+	}
+	if( maximum_number_of_elements < number_of_elements )
+	{
+		maximum_number_of_elements = number_of_elements;
+	}
+	if( ( maximum_number_of_elements >= ( INT_MAX - 1 ) )
+	 || ( ( (size_t) maximum_number_of_elements + 1 ) > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / element_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum number of elements value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_column->value_size > 0 )
+	{
+		reallocation = memory_reallocate(
+		                batch_column->values,
+		                element_size * (size_t) maximum_number_of_elements );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize values.",
+			 function );
+
+			return( -1 );
+		}
+		batch_column->values = (uint8_t *) reallocation;
+	}
+	else
+	{
+		reallocation = memory_reallocate(
+		                batch_column->offsets,
+		                element_size * ( (size_t) maximum_number_of_elements + 1 ) );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize offsets.",
+			 function );
+
+			return( -1 );
+		}
+		batch_column->offsets = (int32_t *) reallocation;
+	}
+	batch_column->maximum_number_of_elements = maximum_number_of_elements;
+
+	return( 1 );
+}
+
+/* Copies a fixed size record value into the values of a batch column
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_batch_column_copy_fixed_size_value(
+     libesedb_batch_column_t *batch_column,
+     int element_index,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *values            = NULL;
+	static char *function      = "libesedb_batch_column_copy_fixed_size_value";
+	size_t required_value_size = 0;
+	uint64_t value_64bit       = 0;
+	uint32_t value_32bit       = 0;
+	uint16_t value_16bit       = 0;
+	float value_float          = 0.0;
+	double value_double        = 0.0;
+
+	if( batch_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch column.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_column->values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid batch column - missing values.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	switch( batch_column->column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			required_value_size = 1;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			required_value_size = 2;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			required_value_size = 4;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			required_value_size = 8;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_GUID:
+			required_value_size = 16;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column type: %" PRIu32 ".",
+			 function,
+			 batch_column->column_type );
+
+			return( -1 );
+	}
+	if( value_data_size != required_value_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value data size: %" PRIzd " for column type: %" PRIu32 ".",
+		 function,
+		 value_data_size,
+		 batch_column->column_type );
+
+		return( -1 );
+	}
+	values = &( batch_column->values[ (size_t) element_index * batch_column->value_size ] );
+
+	switch( batch_column->column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			value_64bit = (uint64_t) value_data[ 0 ];
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			byte_stream_copy_to_uint16_little_endian(
+			 value_data,
+			 value_16bit );
+
+			value_64bit = (uint64_t) (int64_t) (int16_t) value_16bit;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			byte_stream_copy_to_uint16_little_endian(
+			 value_data,
+			 value_16bit );
+
+			value_64bit = (uint64_t) value_16bit;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			byte_stream_copy_to_uint32_little_endian(
+			 value_data,
+			 value_32bit );
+
+			value_64bit = (uint64_t) (int64_t) (int32_t) value_32bit;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			byte_stream_copy_to_uint32_little_endian(
+			 value_data,
+			 value_32bit );
+
+			value_64bit = (uint64_t) value_32bit;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			byte_stream_copy_to_uint32_little_endian(
+			 value_data,
+			 value_32bit );
+
+			memory_copy(
+			 &value_float,
+			 &value_32bit,
+			 sizeof( float ) );
+
+			value_double = (double) value_float;
+
+			memory_copy(
+			 &value_64bit,
+			 &value_double,
+			 sizeof( double ) );
+
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_GUID:
+			if( memory_copy(
+			     values,
+			     value_data,
+			     16 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy GUID value.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+
+		default:
+			byte_stream_copy_to_uint64_little_endian(
+			 value_data,
+			 value_64bit );
+
+			break;
+	}
+	/* The values are stored in native byte order
+	 */
+	memory_copy(
+	 values,
+	 &value_64bit,
+	 sizeof( uint64_t ) );
+
+	return( 1 );
+}
+
+/* Appends an uncompressed string to the data of a batch column
+ * The string is stored as UTF-8 without the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_batch_column_append_string_data(
+     libesedb_batch_column_t *batch_column,
+     int ascii_codepage,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "libesedb_batch_column_append_string_data";
+	size_t utf8_string_size = 0;
+	int codepage            = 0;
+	int result              = 0;
+
+	if( batch_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch column.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_column->column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid batch column - missing column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == 0 )
+	{
+		return( 1 );
+	}
+	codepage = (int) batch_column->column_catalog_definition->codepage;
+
+	/* If the codepage is not set use the default codepage
+	 */
+	if( codepage == 0 )
+	{
+		codepage = ascii_codepage;
+	}
+	/* Codepage 1200 in the ESE database format is not strict UTF-16 little-endian
+	 * it can be used for ASCII strings as well.
+	 */
+	if( codepage == 1200 )
+	{
+		result = libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+		          value_data,
+		          value_data_size,
+		          &utf8_string_size,
+		          error );
+	}
+	else
+	{
+		result = libuna_utf8_string_size_from_byte_stream(
+		          value_data,
+		          value_data_size,
+		          codepage,
+		          &utf8_string_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > ( (size_t) INT_MAX - batch_column->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_batch_column_resize_data(
+	     batch_column,
+	     batch_column->data_size + utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize data.",
+		 function );
+
+		return( -1 );
+	}
+	if( codepage == 1200 )
+	{
+		result = libesedb_compression_copy_to_utf8_string_from_uncompressed_data(
+		          value_data,
+		          value_data_size,
+		          &( batch_column->data[ batch_column->data_size ] ),
+		          utf8_string_size,
+		          &utf8_string_size,
+		          error );
+	}
+	else
+	{
+		result = libuna_utf8_string_copy_from_byte_stream(
+		          &( batch_column->data[ batch_column->data_size ] ),
+		          utf8_string_size,
+		          value_data,
+		          value_data_size,
+		          codepage,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	/* The strings are stored without the end-of-string character
+	 */
+	if( utf8_string_size > 0 )
+	{
+		batch_column->data_size += utf8_string_size - 1;
+	}
+	return( 1 );
+}
+
+/* Appends a variable size value to the data of a batch column
+ * The value data is the data of the value in the record data
+ * Returns 1 if successful, 0 if the value is NULL or -1 on error
+ */
+int libesedb_batch_column_append_variable_size_value(
+     libesedb_batch_column_t *batch_column,
+     libesedb_internal_table_t *internal_table,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     uint8_t value_flags,
+     libcerror_error_t **error )
+{
+	libesedb_long_value_t *long_value   = NULL;
+	libfdata_list_t *data_segments_list = NULL;
+	static char *function               = "libesedb_batch_column_append_variable_size_value";
+	size64_t long_value_data_size       = 0;
+	size_t copy_size                    = 0;
+	int result                          = 0;
+
+	if( batch_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch column.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_column->column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid batch column - missing column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) != 0 )
+	{
+		/* The value data contains the key of the long value
+		 */
+		result = libesedb_record_get_long_value_data_segments_list(
+		          internal_table->file_io_handle,
+		          internal_table->io_handle,
+		          internal_table->table_definition,
+		          internal_table->long_values_pages_vector,
+		          internal_table->long_values_pages_cache,
+		          internal_table->long_values_page_tree,
+		          internal_table->long_value_cursor,
+		          batch_column->column_catalog_definition->flags,
+		          value_data,
+		          value_data_size,
+		          &data_segments_list,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve long value: %d data segments list.",
+			 function,
+			 batch_column->column_entry );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( libesedb_long_value_initialize(
+		     &long_value,
+		     internal_table->file_io_handle,
+		     internal_table->io_handle,
+		     batch_column->column_catalog_definition,
+		     data_segments_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create long value.",
+			 function );
+
+			goto on_error;
+		}
+		/* The long value takes over management of the data segments list
+		 */
+		data_segments_list = NULL;
+
+		if( batch_column->value_format == LIBESEDB_BATCH_VALUE_FORMAT_UTF8_STRING )
+		{
+			result = libesedb_long_value_get_utf8_string_size(
+			          long_value,
+			          &copy_size,
+			          error );
+		}
+		else
+		{
+			result = libesedb_long_value_get_data_size(
+			          long_value,
+			          &long_value_data_size,
+			          error );
+
+			if( long_value_data_size > (size64_t) SSIZE_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid long value data size value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			copy_size = (size_t) long_value_data_size;
+		}
+	}
+	else if( ( value_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
+	{
+		/* Compressed values are decompressed once directly into the data
+		 * of the batch column, strings are sized using the maximum string size
+		 */
+		if( batch_column->value_format == LIBESEDB_BATCH_VALUE_FORMAT_UTF8_STRING )
+		{
+			result = libesedb_compression_get_utf8_string_maximum_size(
+			          value_data,
+			          value_data_size,
+			          &copy_size,
+			          error );
+		}
+		else
+		{
+			result = libesedb_compression_decompress_get_size(
+			          value_data,
+			          value_data_size,
+			          &copy_size,
+			          error );
+		}
+	}
+	else if( batch_column->value_format == LIBESEDB_BATCH_VALUE_FORMAT_UTF8_STRING )
+	{
+		if( libesedb_batch_column_append_string_data(
+		     batch_column,
+		     internal_table->io_handle->ascii_codepage,
+		     value_data,
+		     value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append string of value: %d.",
+			 function,
+			 batch_column->column_entry );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	else
+	{
+		copy_size = value_data_size;
+		result    = 1;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of value: %d.",
+		 function,
+		 batch_column->column_entry );
+
+		goto on_error;
+	}
+	if( copy_size > ( (size_t) INT_MAX - batch_column->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid value data size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_batch_column_resize_data(
+	     batch_column,
+	     batch_column->data_size + copy_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize data.",
+		 function );
+
+		goto on_error;
+	}
+	if( copy_size > 0 )
+	{
+		if( long_value != NULL )
+		{
+			if( batch_column->value_format == LIBESEDB_BATCH_VALUE_FORMAT_UTF8_STRING )
+			{
+				result = libesedb_long_value_get_utf8_string(
+				          long_value,
+				          &( batch_column->data[ batch_column->data_size ] ),
+				          copy_size,
+				          error );
+			}
+			else
+			{
+				result = libesedb_long_value_get_data(
+				          long_value,
+				          &( batch_column->data[ batch_column->data_size ] ),
+				          copy_size,
+				          error );
+			}
+		}
+		else if( ( value_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
+		{
+			if( batch_column->value_format == LIBESEDB_BATCH_VALUE_FORMAT_UTF8_STRING )
+			{
+				result = libesedb_compression_copy_to_utf8_string_with_index(
+				          value_data,
+				          value_data_size,
+				          &( batch_column->data[ batch_column->data_size ] ),
+				          copy_size,
+				          &copy_size,
+				          error );
+			}
+			else
+			{
+				result = libesedb_compression_decompress(
+				          value_data,
+				          value_data_size,
+				          &( batch_column->data[ batch_column->data_size ] ),
+				          copy_size,
+				          error );
+			}
+		}
+		else if( memory_copy(
+		          &( batch_column->data[ batch_column->data_size ] ),
+		          value_data,
+		          copy_size ) == NULL )
+		{
+			result = -1;
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value: %d.",
+			 function,
+			 batch_column->column_entry );
+
+			goto on_error;
+		}
+		/* The strings are stored without the end-of-string character
+		 */
+		if( batch_column->value_format == LIBESEDB_BATCH_VALUE_FORMAT_UTF8_STRING )
+		{
+			copy_size -= 1;
+		}
+		batch_column->data_size += copy_size;
+	}
+	if( long_value != NULL )
+	{
+		if( libesedb_long_value_free(
+		     &long_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free long value.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	if( data_segments_list != NULL )
+	{
+		libfdata_list_free(
+		 &data_segments_list,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends a value to a batch column
+ * The value data is the data of the value in the record data
+ * Returns 1 if successful, 0 if the value is NULL or -1 on error
+ */
+int libesedb_batch_column_append_value(
+     libesedb_batch_column_t *batch_column,
+     libesedb_internal_table_t *internal_table,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     uint8_t value_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_batch_column_append_value";
+	int result            = 0;
+
+	if( batch_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch column.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_batch_column_resize_elements(
+	     batch_column,
+	     batch_column->number_of_elements + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_column->value_size > 0 )
+	{
+		if( libesedb_batch_column_copy_fixed_size_value(
+		     batch_column,
+		     batch_column->number_of_elements,
+		     value_data,
+		     value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value: %d.",
+			 function,
+			 batch_column->column_entry );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		result = libesedb_batch_column_append_variable_size_value(
+		          batch_column,
+		          internal_table,
+		          value_data,
+		          value_data_size,
+		          value_flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value: %d.",
+			 function,
+			 batch_column->column_entry );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		batch_column->offsets[ batch_column->number_of_elements + 1 ] = (int32_t) batch_column->data_size;
+	}
+	batch_column->number_of_elements += 1;
+
+	return( 1 );
+}
+
+/* Appends a NULL value to a batch column
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_batch_column_append_null_value(
+     libesedb_batch_column_t *batch_column,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_batch_column_append_null_value";
+
+	if( batch_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch column.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_batch_column_resize_elements(
+	     batch_column,
+	     batch_column->number_of_elements + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_column->value_size > 0 )
+	{
+		if( memory_set(
+		     &( batch_column->values[ (size_t) batch_column->number_of_elements * batch_column->value_size ] ),
+		     0,
+		     batch_column->value_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		batch_column->offsets[ batch_column->number_of_elements + 1 ] = (int32_t) batch_column->data_size;
+	}
+	batch_column->number_of_elements += 1;
+
+	return( 1 );
+}
+
+/* Appends the values of a multi value to a batch column
+ * The value data is the data of the multi value in the record data, which starts
+ * with the offsets of the values, the first offset is also the size of the offsets
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_batch_column_append_multi_value(
+     libesedb_batch_column_t *batch_column,
+     int ascii_codepage,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	static char *function            = "libesedb_batch_column_append_multi_value";
+	size_t value_entry_size          = 0;
+	uint16_t next_value_entry_offset = 0;
+	uint16_t number_of_value_entries = 0;
+	uint16_t value_entry_index       = 0;
+	uint16_t value_entry_offset      = 0;
+
+	if( batch_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch column.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_data_size < 2 )
+	 || ( value_data_size > (size_t) UINT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 value_data,
+	 value_entry_offset );
+
+	value_entry_offset     &= 0x7fff;
+	number_of_value_entries = value_entry_offset / 2;
+
+	if( ( number_of_value_entries == 0 )
+	 || ( (size_t) value_entry_offset > value_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of value entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (int) number_of_value_entries > ( INT_MAX - 1 - batch_column->number_of_elements ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of value entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_batch_column_resize_elements(
+	     batch_column,
+	     batch_column->number_of_elements + (int) number_of_value_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize elements.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_entry_index = 0;
+	     value_entry_index < number_of_value_entries;
+	     value_entry_index++ )
+	{
+		if( ( value_entry_index + 1 ) < number_of_value_entries )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( value_data[ ( value_entry_index + 1 ) * 2 ] ),
+			 next_value_entry_offset );
+
+			next_value_entry_offset &= 0x7fff;
+		}
+		else
+		{
+			next_value_entry_offset = (uint16_t) value_data_size;
+		}
+		if( ( next_value_entry_offset < value_entry_offset )
+		 || ( (size_t) next_value_entry_offset > value_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid value entry: %" PRIu16 " offset value out of bounds.",
+			 function,
+			 value_entry_index );
+
+			return( -1 );
+		}
+		value_entry_size = (size_t) ( next_value_entry_offset - value_entry_offset );
+
+		if( batch_column->value_size > 0 )
+		{
+			if( libesedb_batch_column_copy_fixed_size_value(
+			     batch_column,
+			     batch_column->number_of_elements,
+			     &( value_data[ value_entry_offset ] ),
+			     value_entry_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy value entry: %" PRIu16 ".",
+				 function,
+				 value_entry_index );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( batch_column->value_format == LIBESEDB_BATCH_VALUE_FORMAT_UTF8_STRING )
+			{
+				if( libesedb_batch_column_append_string_data(
+				     batch_column,
+				     ascii_codepage,
+				     &( value_data[ value_entry_offset ] ),
+				     value_entry_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append string of value entry: %" PRIu16 ".",
+					 function,
+					 value_entry_index );
+
+					return( -1 );
+				}
+			}
+			else if( value_entry_size > 0 )
+			{
+				if( value_entry_size > ( (size_t) INT_MAX - batch_column->data_size ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid value entry: %" PRIu16 " size value exceeds maximum.",
+					 function,
+					 value_entry_index );
+
+					return( -1 );
+				}
+				if( libesedb_batch_column_resize_data(
+				     batch_column,
+				     batch_column->data_size + value_entry_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+					 "%s: unable to resize data.",
+					 function );
+
+					return( -1 );
+				}
+				if( memory_copy(
+				     &( batch_column->data[ batch_column->data_size ] ),
+				     &( value_data[ value_entry_offset ] ),
+				     value_entry_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy value entry: %" PRIu16 ".",
+					 function,
+					 value_entry_index );
+
+					return( -1 );
+				}
+				batch_column->data_size += value_entry_size;
+			}
+			batch_column->offsets[ batch_column->number_of_elements + 1 ] = (int32_t) batch_column->data_size;
+		}
+		batch_column->number_of_elements += 1;
+
+		value_entry_offset = next_value_entry_offset;
+	}
+	return( 1 );
+}
+
+/* Appends the values of the record data to a batch
+ * The values are read directly from the record data, only long values are
+ * retrieved from the long values of the table
+ * Multi values are stored as lists if the column is defined as multi valued
+ * otherwise they are stored as NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_batch_append_record_data(
+     libesedb_internal_batch_t *internal_batch,
+     libesedb_internal_table_t *internal_table,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_batch_column_t *batch_column = NULL;
+	const uint8_t *value_data             = NULL;
+	static char *function                 = "libesedb_batch_append_record_data";
+	size_t value_data_size                = 0;
+	uint8_t validity_bit                  = 0;
+	uint8_t value_flags                   = 0;
+	int column_index                      = 0;
+	int record_index                      = 0;
+	int result                            = 0;
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_batch->columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid batch - missing columns.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_batch->number_of_records >= internal_batch->maximum_number_of_records )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid batch - number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	record_index = internal_batch->number_of_records;
+	validity_bit = (uint8_t) ( 1 << ( record_index % 8 ) );
+
+	for( column_index = 0;
+	     column_index < internal_batch->number_of_columns;
+	     column_index++ )
+	{
+		batch_column = &( internal_batch->columns[ column_index ] );
+
+		result = libesedb_data_definition_get_record_value_data(
+		          internal_table->io_handle,
+		          record_data,
+		          record_data_size,
+		          batch_column->column_catalog_definition,
+		          batch_column->fixed_size_value_offset,
+		          &value_data,
+		          &value_data_size,
+		          &value_flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d data.",
+			 function,
+			 batch_column->column_entry );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( ( value_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) == 0 )
+			{
+				result = libesedb_batch_column_append_value(
+				          batch_column,
+				          internal_table,
+				          value_data,
+				          value_data_size,
+				          value_flags,
+				          error );
+			}
+			else if( ( batch_column->is_multi_value != 0 )
+			      && ( ( value_flags & ( LIBESEDB_VALUE_FLAG_COMPRESSED | LIBESEDB_VALUE_FLAG_LONG_VALUE | 0x10 ) ) == 0 ) )
+			{
+				result = libesedb_batch_column_append_multi_value(
+				          batch_column,
+				          internal_table->io_handle->ascii_codepage,
+				          value_data,
+				          value_data_size,
+				          error );
+			}
+			else
+			{
+				result = 0;
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append value: %d.",
+				 function,
+				 batch_column->column_entry );
+
+				return( -1 );
+			}
+		}
+		if( ( result == 0 )
+		 && ( batch_column->is_multi_value == 0 ) )
+		{
+			if( libesedb_batch_column_append_null_value(
+			     batch_column,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append NULL value: %d.",
+				 function,
+				 batch_column->column_entry );
+
+				return( -1 );
+			}
+		}
+		if( batch_column->list_offsets != NULL )
+		{
+			batch_column->list_offsets[ record_index + 1 ] = (int32_t) batch_column->number_of_elements;
+		}
+		if( result == 0 )
+		{
+			batch_column->validity_bitmap[ record_index / 8 ] &= (uint8_t) ~validity_bit;
+		}
+		else
+		{
+			batch_column->validity_bitmap[ record_index / 8 ] |= validity_bit;
+		}
+	}
+	internal_batch->number_of_records += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of records in the batch
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_batch_get_number_of_records(
+     libesedb_batch_t *batch,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libesedb_internal_batch_t *internal_batch = NULL;
+	static char *function                     = "libesedb_batch_get_number_of_records";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libesedb_internal_batch_t *) batch;
+
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_records = internal_batch->number_of_records;
+
+	return( 1 );
+}
+
+/* Retrieves the number of columns in the batch
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_batch_get_number_of_columns(
+     libesedb_batch_t *batch,
+     int *number_of_columns,
+     libcerror_error_t **error )
+{
+	libesedb_internal_batch_t *internal_batch = NULL;
+	static char *function                     = "libesedb_batch_get_number_of_columns";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libesedb_internal_batch_t *) batch;
+
+	if( number_of_columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of columns.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_columns = internal_batch->number_of_columns;
+
+	return( 1 );
+}
+
+/* Retrieves a specific column of the batch
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_batch_get_column_by_index(
+     libesedb_internal_batch_t *internal_batch,
+     int column_index,
+     libesedb_batch_column_t **batch_column,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_batch_get_column_by_index";
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_index < 0 )
+	 || ( column_index >= internal_batch->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch column.",
+		 function );
+
+		return( -1 );
+	}
+	*batch_column = &( internal_batch->columns[ column_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the column identifier of a specific column
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_batch_get_column_identifier(
+     libesedb_batch_t *batch,
+     int column_index,
+     uint32_t *column_identifier,
+     libcerror_error_t **error )
+{
+	libesedb_batch_column_t *batch_column = NULL;
+	static char *function                 = "libesedb_batch_get_column_identifier";
+
+	if( libesedb_batch_get_column_by_index(
+	     (libesedb_internal_batch_t *) batch,
+	     column_index,
+	     &batch_column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_definition_get_identifier(
+	     batch_column->column_catalog_definition,
+	     column_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve catalog definition identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the column type of a specific column
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_batch_get_column_type(
+     libesedb_batch_t *batch,
+     int column_index,
+     uint32_t *column_type,
+     libcerror_error_t **error )
+{
+	libesedb_batch_column_t *batch_column = NULL;
+	static char *function                 = "libesedb_batch_get_column_type";
+
+	if( column_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_batch_get_column_by_index(
+	     (libesedb_internal_batch_t *) batch,
+	     column_index,
+	     &batch_column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	*column_type = batch_column->column_type;
+
+	return( 1 );
+}
+
+/* Retrieves the value format of a specific column
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_batch_get_column_value_format(
+     libesedb_batch_t *batch,
+     int column_index,
+     int *value_format,
+     libcerror_error_t **error )
+{
+	libesedb_batch_column_t *batch_column = NULL;
+	static char *function                 = "libesedb_batch_get_column_value_format";
+
+	if( value_format == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value format.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_batch_get_column_by_index(
+	     (libesedb_internal_batch_t *) batch,
+	     column_index,
+	     &batch_column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	*value_format = batch_column->value_format;
+
+	return( 1 );
+}
+
+/* Retrieves the fixed size values of a specific column
+ * The values are stored contiguously in native byte order and remain
+ * valid until the next read into the batch or until the batch is freed
+ * For a multi value column these are the values of all the lists
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_batch_get_column_values(
+     libesedb_batch_t *batch,
+     int column_index,
+     const uint8_t **values,
+     size_t *values_size,
+     libcerror_error_t **error )
+{
+	libesedb_batch_column_t *batch_column = NULL;
+	static char *function                 = "libesedb_batch_get_column_values";
+
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	if( values_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_batch_get_column_by_index(
+	     (libesedb_internal_batch_t *) batch,
+	     column_index,
+	     &batch_column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	if( batch_column->values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value format: %d.",
+		 function,
+		 batch_column->value_format );
+
+		return( -1 );
+	}
+	*values      = batch_column->values;
+	*values_size = batch_column->value_size * (size_t) batch_column->number_of_elements;
+
+	return( 1 );
+}
+
+/* Retrieves the variable size value offsets of a specific column
+ * The number of offsets is the number of values + 1, where value N
+ * is stored in the data from offset N up to offset N + 1
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_batch_get_column_offsets(
+     libesedb_batch_t *batch,
+     int column_index,
+     const int32_t **offsets,
+     int *number_of_offsets,
+     libcerror_error_t **error )
+{
+	libesedb_batch_column_t *batch_column = NULL;
+	static char *function                 = "libesedb_batch_get_column_offsets";
+
+	if( offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_batch_get_column_by_index(
+	     (libesedb_internal_batch_t *) batch,
+	     column_index,
+	     &batch_column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	if( batch_column->offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value format: %d.",
+		 function,
+		 batch_column->value_format );
+
+		return( -1 );
+	}
+	*offsets           = batch_column->offsets;
+	*number_of_offsets = batch_column->number_of_elements + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the variable size value data of a specific column
+ * Strings are stored UTF-8 encoded without end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_batch_get_column_data(
+     libesedb_batch_t *batch,
+     int column_index,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libesedb_batch_column_t *batch_column = NULL;
+	static char *function                 = "libesedb_batch_get_column_data";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_batch_get_column_by_index(
+	     (libesedb_internal_batch_t *) batch,
+	     column_index,
+	     &batch_column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	if( batch_column->offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value format: %d.",
+		 function,
+		 batch_column->value_format );
+
+		return( -1 );
+	}
+	*data      = batch_column->data;
+	*data_size = batch_column->data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the list offsets of a specific multi value column
+ * The number of list offsets is the number of records + 1, where the list
+ * of record N consists of the values from offset N up to offset N + 1
+ * Returns 1 if successful, 0 if the column is not a multi value column or -1 on error
+ */
+int libesedb_batch_get_column_list_offsets(
+     libesedb_batch_t *batch,
+     int column_index,
+     const int32_t **list_offsets,
+     int *number_of_list_offsets,
+     libcerror_error_t **error )
+{
+	libesedb_batch_column_t *batch_column = NULL;
+	static char *function                 = "libesedb_batch_get_column_list_offsets";
+
+	if( list_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid list offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_list_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of list offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_batch_get_column_by_index(
+	     (libesedb_internal_batch_t *) batch,
+	     column_index,
+	     &batch_column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	if( batch_column->list_offsets == NULL )
+	{
+		return( 0 );
+	}
+	*list_offsets           = batch_column->list_offsets;
+	*number_of_list_offsets = ( (libesedb_internal_batch_t *) batch )->number_of_records + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the validity bitmap of a specific column
+ * Bit N, in least significant bit order, is set if the value of record N is not NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_batch_get_column_validity_bitmap(
+     libesedb_batch_t *batch,
+     int column_index,
+     const uint8_t **validity_bitmap,
+     size_t *validity_bitmap_size,
+     libcerror_error_t **error )
+{
+	libesedb_batch_column_t *batch_column = NULL;
+	static char *function                 = "libesedb_batch_get_column_validity_bitmap";
+
+	if( validity_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid validity bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( validity_bitmap_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid validity bitmap size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_batch_get_column_by_index(
+	     (libesedb_internal_batch_t *) batch,
+	     column_index,
+	     &batch_column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	*validity_bitmap      = batch_column->validity_bitmap;
+	*validity_bitmap_size = ( (size_t) ( (libesedb_internal_batch_t *) batch )->number_of_records + 7 ) / 8;
+
+	return( 1 );
+}
+
@@ -0,0 +1,304 @@
+/*
+ * Batch (columnar record set) functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_BATCH_H )
+#define _LIBESEDB_BATCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_extern.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_table.h"
+#include "libesedb_table_definition.h"
+#include "libesedb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_batch_column libesedb_batch_column_t;
+
+struct libesedb_batch_column
+{
+	/* The column (record value) entry
+	 */
+	int column_entry;
+
+	/* The column catalog definition
+	 */
+	libesedb_catalog_definition_t *column_catalog_definition;
+
+	/* The offset of the fixed size value in the record data
+	 */
+	uint16_t fixed_size_value_offset;
+
+	/* The column type
+	 */
+	uint32_t column_type;
+
+	/* The value format
+	 */
+	int value_format;
+
+	/* The value size or 0 for variable size values
+	 */
+	size_t value_size;
+
+	/* The (fixed size) values
+	 */
+	uint8_t *values;
+
+	/* The (variable size) value offsets
+	 */
+	int32_t *offsets;
+
+	/* The (variable size) value data
+	 */
+	uint8_t *data;
+
+	/* The (variable size) value data size
+	 */
+	size_t data_size;
+
+	/* The allocated (variable size) value data size
+	 */
+	size_t allocated_data_size;
+
+	/* The validity bitmap
+	 */
+	uint8_t *validity_bitmap;
+
+	/* The number of (fixed or variable size) values
+	 */
+	int number_of_elements;
+
+	/* The maximum number of (fixed or variable size) values
+	 */
+	int maximum_number_of_elements;
+
+	/* Value to indicate the column contains multi values
+	 */
+	uint8_t is_multi_value;
+
+	/* The multi value list offsets
+	 */
+	int32_t *list_offsets;
+};
+
+typedef struct libesedb_internal_batch libesedb_internal_batch_t;
+
+struct libesedb_internal_batch
+{
+	/* The table definition the columns were set from
+	 */
+	libesedb_table_definition_t *table_definition;
+
+	/* The columns
+	 */
+	libesedb_batch_column_t *columns;
+
+	/* The number of columns
+	 */
+	int number_of_columns;
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The maximum number of records the column buffers can contain
+	 */
+	int maximum_number_of_records;
+};
+
+LIBESEDB_EXTERN \
+int libesedb_batch_initialize(
+     libesedb_batch_t **batch,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_batch_free(
+     libesedb_batch_t **batch,
+     libcerror_error_t **error );
+
+int libesedb_batch_clear(
+     libesedb_internal_batch_t *internal_batch,
+     libcerror_error_t **error );
+
+int libesedb_batch_get_value_format(
+     uint32_t column_type,
+     int *value_format,
+     size_t *value_size,
+     libcerror_error_t **error );
+
+int libesedb_batch_set_columns(
+     libesedb_internal_batch_t *internal_batch,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     const int *column_entries,
+     int number_of_column_entries,
+     int maximum_number_of_records,
+     libcerror_error_t **error );
+
+int libesedb_batch_column_resize_data(
+     libesedb_batch_column_t *batch_column,
+     size_t required_data_size,
+     libcerror_error_t **error );
+
+int libesedb_batch_column_resize_elements(
+     libesedb_batch_column_t *batch_column,
+     int number_of_elements,
+     libcerror_error_t **error );
+
+int libesedb_batch_column_copy_fixed_size_value(
+     libesedb_batch_column_t *batch_column,
+     int element_index,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+int libesedb_batch_column_append_string_data(
+     libesedb_batch_column_t *batch_column,
+     int ascii_codepage,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+int libesedb_batch_column_append_variable_size_value(
+     libesedb_batch_column_t *batch_column,
+     libesedb_internal_table_t *internal_table,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     uint8_t value_flags,
+     libcerror_error_t **error );
+
+int libesedb_batch_column_append_value(
+     libesedb_batch_column_t *batch_column,
+     libesedb_internal_table_t *internal_table,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     uint8_t value_flags,
+     libcerror_error_t **error );
+
+int libesedb_batch_column_append_null_value(
+     libesedb_batch_column_t *batch_column,
+     libcerror_error_t **error );
+
+int libesedb_batch_column_append_multi_value(
+     libesedb_batch_column_t *batch_column,
+     int ascii_codepage,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+int libesedb_batch_append_record_data(
+     libesedb_internal_batch_t *internal_batch,
+     libesedb_internal_table_t *internal_table,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_batch_get_number_of_records(
+     libesedb_batch_t *batch,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_batch_get_number_of_columns(
+     libesedb_batch_t *batch,
+     int *number_of_columns,
+     libcerror_error_t **error );
+
+int libesedb_batch_get_column_by_index(
+     libesedb_internal_batch_t *internal_batch,
+     int column_index,
+     libesedb_batch_column_t **batch_column,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_batch_get_column_identifier(
+     libesedb_batch_t *batch,
+     int column_index,
+     uint32_t *column_identifier,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_batch_get_column_type(
+     libesedb_batch_t *batch,
+     int column_index,
+     uint32_t *column_type,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_batch_get_column_value_format(
+     libesedb_batch_t *batch,
+     int column_index,
+     int *value_format,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_batch_get_column_values(
+     libesedb_batch_t *batch,
+     int column_index,
+     const uint8_t **values,
+     size_t *values_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_batch_get_column_offsets(
+     libesedb_batch_t *batch,
+     int column_index,
+     const int32_t **offsets,
+     int *number_of_offsets,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_batch_get_column_data(
+     libesedb_batch_t *batch,
+     int column_index,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_batch_get_column_list_offsets(
+     libesedb_batch_t *batch,
+     int column_index,
+     const int32_t **list_offsets,
+     int *number_of_list_offsets,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_batch_get_column_validity_bitmap(
+     libesedb_batch_t *batch,
+     int column_index,
+     const uint8_t **validity_bitmap,
+     size_t *validity_bitmap_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_BATCH_H ) */
+
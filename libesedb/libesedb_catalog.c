@@ -23,12 +23,11 @@
 #include <memory.h>
 #include <types.h>
 
-#include "libesedb_block_descriptor.h"
-#include "libesedb_block_tree.h"
 #include "libesedb_data_definition.h"
 #include "libesedb_debug.h"
 #include "libesedb_definitions.h"
 #include "libesedb_catalog.h"
+#include "libesedb_catalog_cache.h"
 #include "libesedb_catalog_definition.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
@@ -37,6 +36,8 @@
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_libuna.h"
+#include "libesedb_name_hash_table.h"
+#include "libesedb_page_store.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_table_definition.h"
 
@@ -140,17 +141,16 @@ int libesedb_catalog_initialize(
 
 		goto on_error;
 	}
-	if( libesedb_block_tree_initialize(
-	     &( ( *catalog )->page_block_tree ),
-	     io_handle->file_size,
-	     io_handle->page_size,
+	if( libesedb_page_bitmap_initialize(
+	     &( ( *catalog )->page_bitmap ),
+	     io_handle->last_page_number,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create page block tree.",
+		 "%s: unable to create page bitmap.",
 		 function );
 
 		goto on_error;
@@ -174,11 +174,10 @@ int libesedb_catalog_initialize(
 on_error:
 	if( *catalog != NULL )
 	{
-		if( ( *catalog )->page_block_tree != NULL )
+		if( ( *catalog )->page_bitmap != NULL )
 		{
-			libesedb_block_tree_free(
-			 &( ( *catalog )->page_block_tree ),
-			 (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_block_descriptor_free,
+			libesedb_page_bitmap_free(
+			 &( ( *catalog )->page_bitmap ),
 			 NULL );
 		}
 		if( ( *catalog )->page_tree != NULL )
@@ -231,16 +230,15 @@ int libesedb_catalog_free(
 
 			result = -1;
 		}
-		if( libesedb_block_tree_free(
-		     &( ( *catalog )->page_block_tree ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_block_descriptor_free,
+		if( libesedb_page_bitmap_free(
+		     &( ( *catalog )->page_bitmap ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free page block tree.",
+			 "%s: unable to free page bitmap.",
 			 function );
 
 			result = -1;
@@ -259,6 +257,38 @@ int libesedb_catalog_free(
 
 			result = -1;
 		}
+		if( ( *catalog )->table_name_hash_table != NULL )
+		{
+			if( libesedb_name_hash_table_free(
+			     &( ( *catalog )->table_name_hash_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free table name hash table.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *catalog )->case_folded_table_name_hash_table != NULL )
+		{
+			if( libesedb_name_hash_table_free(
+			     &( ( *catalog )->case_folded_table_name_hash_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free case folded table name hash table.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *catalog );
 
@@ -556,6 +586,7 @@ int libesedb_catalog_read_values_from_leaf_page(
 	libesedb_page_value_t *page_value           = NULL;
 	static char *function                       = "libesedb_catalog_read_values_from_leaf_page";
 	uint32_t page_flags                         = 0;
+	uint16_t catalog_definition_type            = 0;
 	uint16_t number_of_page_values              = 0;
 	uint16_t page_value_index                   = 0;
 
@@ -570,6 +601,28 @@ int libesedb_catalog_read_values_from_leaf_page(
 
 		return( -1 );
 	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
 	if( libesedb_page_get_flags(
 	     page,
 	     &page_flags,
@@ -689,21 +742,53 @@ int libesedb_catalog_read_values_from_leaf_page(
 
 			goto on_error;
 		}
-		if( libesedb_catalog_read_value_data(
-		     catalog,
-		     page_tree_value->data,
-		     page_tree_value->data_size,
-		     table_definition,
-		     error ) != 1 )
+		if( catalog->read_on_demand != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read catalog value.",
-			 function );
+			if( libesedb_catalog_definition_read_type(
+			     page_tree_value->data,
+			     page_tree_value->data_size,
+			     &catalog_definition_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read catalog definition type.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
+		}
+		/* When reading on demand only the table catalog definitions are read
+		 * and the position of the table catalog definition is stored
+		 */
+		if( ( catalog->read_on_demand == 0 )
+		 || ( catalog_definition_type == LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE ) )
+		{
+			if( libesedb_catalog_read_value_data(
+			     catalog,
+			     page_tree_value->data,
+			     page_tree_value->data_size,
+			     table_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read catalog value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( ( catalog->read_on_demand != 0 )
+		 && ( catalog_definition_type == LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE )
+		 && ( *table_definition != NULL ) )
+		{
+			( *table_definition )->catalog_leaf_page_number = page->page_number;
+			( *table_definition )->catalog_page_value_index = page_value_index;
 		}
 		if( libesedb_page_tree_value_free(
 		     &page_tree_value,
@@ -742,7 +827,6 @@ int libesedb_catalog_read_file_io_handle(
 	libesedb_page_t *page                         = NULL;
 	libesedb_table_definition_t *table_definition = NULL;
 	static char *function                         = "libesedb_catalog_read_file_io_handle";
-	off64_t page_offset                           = 0;
 	uint32_t leaf_page_number                     = 0;
 
 	if( catalog == NULL )
@@ -795,13 +879,10 @@ int libesedb_catalog_read_file_io_handle(
 	}
 	while( leaf_page_number != 0 )
 	{
-		page_offset = ( leaf_page_number + 1 ) * catalog->page_tree->io_handle->page_size;
-
 		if( libesedb_page_tree_check_if_page_block_first_read(
 		     catalog->page_tree,
-		     catalog->page_block_tree,
+		     catalog->page_bitmap,
 		     leaf_page_number,
-		     page_offset,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -829,13 +910,12 @@ int libesedb_catalog_read_file_io_handle(
 
 			return( -1 );
 		}
-		if( libfdata_vector_get_element_value_by_index(
-		     catalog->page_tree->pages_vector,
-		     (intptr_t *) file_io_handle,
-		     (libfdata_cache_t *) catalog->page_tree->pages_cache,
-		     (int) leaf_page_number - 1,
-		     (intptr_t **) &page,
-		     0,
+		if( libesedb_page_store_get_page_by_number(
+		     catalog->page_tree->io_handle,
+		     file_io_handle,
+		     catalog->page_tree->pages_cache,
+		     leaf_page_number,
+		     &page,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -880,40 +960,15 @@ int libesedb_catalog_read_file_io_handle(
 			return( -1 );
 		}
 	}
-	return( 1 );
-}
-
-/* Retrieves the number of table definitions
- * Returns 1 if successful or -1 on error
- */
-int libesedb_catalog_get_number_of_table_definitions(
-     libesedb_catalog_t *catalog,
-     int *number_of_table_definitions,
-     libcerror_error_t **error )
-{
-	static char *function = "libesedb_catalog_get_number_of_table_definitions";
-
-	if( catalog == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid catalog.",
-		 function );
-
-		return( -1 );
-	}
-	if( libcdata_array_get_number_of_entries(
-	     catalog->table_definition_array,
-	     number_of_table_definitions,
+	if( libesedb_catalog_build_table_name_hash_tables(
+	     catalog,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries from table definition array.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build table name hash tables.",
 		 function );
 
 		return( -1 );
@@ -921,16 +976,21 @@ int libesedb_catalog_get_number_of_table_definitions(
 	return( 1 );
 }
 
-/* Retrieves the table definition for the specific index
+/* Reads the table definitions from a catalog cache
+ * The table definitions are stored in the catalog cache with all their catalog definitions
+ * hence they are never read on demand.
  * Returns 1 if successful or -1 on error
  */
-int libesedb_catalog_get_table_definition_by_index(
+int libesedb_catalog_read_catalog_cache(
      libesedb_catalog_t *catalog,
-     int table_definition_index,
-     libesedb_table_definition_t **table_definition,
+     libesedb_catalog_cache_t *catalog_cache,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_catalog_get_table_definition_by_index";
+	libesedb_table_definition_t *table_definition = NULL;
+	static char *function                         = "libesedb_catalog_read_catalog_cache";
+	size_t data_offset                            = 0;
+	int entry_index                               = 0;
+	int result                                    = 0;
 
 	if( catalog == NULL )
 	{
@@ -943,40 +1003,80 @@ int libesedb_catalog_get_table_definition_by_index(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     catalog->table_definition_array,
-	     table_definition_index,
-	     (intptr_t **) table_definition,
+	do
+	{
+		result = libesedb_catalog_cache_get_next_table_definition(
+		          catalog_cache,
+		          &data_offset,
+		          &table_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table definition from catalog cache.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libcdata_array_append_entry(
+			     catalog->table_definition_array,
+			     &entry_index,
+			     (intptr_t *) table_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append table definition to table definition array.",
+				 function );
+
+				libesedb_table_definition_free(
+				 &table_definition,
+				 NULL );
+
+				return( -1 );
+			}
+			table_definition = NULL;
+		}
+	}
+	while( result != 0 );
+
+	if( libesedb_catalog_build_table_name_hash_tables(
+	     catalog,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve entry: %d from table definition array.",
-		 function,
-		 table_definition_index );
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build table name hash tables.",
+		 function );
 
 		return( -1 );
 	}
 	return( 1 );
 }
 
-/* Retrieves the table definition for the specific name
- * Returns 1 if successful, 0 if no corresponding table definition was found or -1 on error
+/* Builds the table name hash tables
+ * Returns 1 if successful or -1 on error
  */
-int libesedb_catalog_get_table_definition_by_name(
+int libesedb_catalog_build_table_name_hash_tables(
      libesedb_catalog_t *catalog,
-     const uint8_t *table_name,
-     size_t table_name_size,
-     libesedb_table_definition_t **table_definition,
      libcerror_error_t **error )
 {
-	libesedb_table_definition_t *safe_table_definition = NULL;
-	static char *function                              = "libesedb_catalog_get_table_definition_by_name";
-	int entry_index                                    = 0;
-	int number_of_entries                              = 0;
-	int result                                         = 0;
+	libesedb_table_definition_t *table_definition = NULL;
+	static char *function                         = "libesedb_catalog_build_table_name_hash_tables";
+	uint32_t case_folded_hash                     = 0;
+	uint32_t hash                                 = 0;
+	int entry_index                               = 0;
+	int number_of_entries                         = 0;
 
 	if( catalog == NULL )
 	{
@@ -989,64 +1089,95 @@ int libesedb_catalog_get_table_definition_by_name(
 
 		return( -1 );
 	}
-	if( table_name == NULL )
+	if( catalog->table_name_hash_table != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid table name.",
-		 function );
+		if( libesedb_name_hash_table_free(
+		     &( catalog->table_name_hash_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free table name hash table.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
-	if( ( table_name_size == 0 )
-	 || ( table_name_size > (size_t) SSIZE_MAX ) )
+	if( catalog->case_folded_table_name_hash_table != NULL )
+	{
+		if( libesedb_name_hash_table_free(
+		     &( catalog->case_folded_table_name_hash_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free case folded table name hash table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     catalog->table_definition_array,
+	     &number_of_entries,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid table name size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries in table definition array.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( table_definition == NULL )
+	if( number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	if( libesedb_name_hash_table_initialize(
+	     &( catalog->table_name_hash_table ),
+	     number_of_entries,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid table definition.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table name hash table.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	*table_definition = NULL;
-
-	if( libcdata_array_get_number_of_entries(
-	     catalog->table_definition_array,
-	     &number_of_entries,
+	if( libesedb_name_hash_table_initialize(
+	     &( catalog->case_folded_table_name_hash_table ),
+	     number_of_entries,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries in table definition array.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create case folded table name hash table.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	/* The entries are set in reverse order so that tables with the same name
+	 * are retrieved in the order of the table definition array
+	 */
+	for( entry_index = number_of_entries - 1;
+	     entry_index >= 0;
+	     entry_index-- )
 	{
 		if( libcdata_array_get_entry_by_index(
 		     catalog->table_definition_array,
 		     entry_index,
-		     (intptr_t **) &safe_table_definition,
+		     (intptr_t **) &table_definition,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1057,9 +1188,10 @@ int libesedb_catalog_get_table_definition_by_name(
 			 function,
 			 entry_index );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( safe_table_definition == NULL )
+		if( ( table_definition == NULL )
+		 || ( table_definition->table_catalog_definition == NULL ) )
 		{
 			libcerror_error_set(
 			 error,
@@ -1069,30 +1201,1030 @@ int libesedb_catalog_get_table_definition_by_name(
 			 function,
 			 entry_index );
 
-			return( -1 );
+			goto on_error;
 		}
-		result = libesedb_catalog_definition_compare_name(
-			  safe_table_definition->table_catalog_definition,
-			  table_name,
-			  table_name_size,
-			  error );
+		hash             = 0;
+		case_folded_hash = 0;
 
-		if( result == -1 )
+		if( table_definition->table_catalog_definition->name != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: unable to compare table name with table catalog definition: %d name.",
-			 function,
-			 entry_index );
+			if( libesedb_name_hash_table_calculate_hash_from_byte_stream(
+			     table_definition->table_catalog_definition->name,
+			     table_definition->table_catalog_definition->name_size,
+			     0,
+			     &hash,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calculate name hash of table definition: %d.",
+				 function,
+				 entry_index );
 
-			return( -1 );
-		}
+				goto on_error;
+			}
+			if( libesedb_name_hash_table_calculate_hash_from_byte_stream(
+			     table_definition->table_catalog_definition->name,
+			     table_definition->table_catalog_definition->name_size,
+			     1,
+			     &case_folded_hash,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calculate case folded name hash of table definition: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+		}
+		if( libesedb_name_hash_table_set_entry(
+		     catalog->table_name_hash_table,
+		     entry_index,
+		     hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set table definition: %d in name hash table.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libesedb_name_hash_table_set_entry(
+		     catalog->case_folded_table_name_hash_table,
+		     entry_index,
+		     case_folded_hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set table definition: %d in case folded name hash table.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( catalog->case_folded_table_name_hash_table != NULL )
+	{
+		libesedb_name_hash_table_free(
+		 &( catalog->case_folded_table_name_hash_table ),
+		 NULL );
+	}
+	if( catalog->table_name_hash_table != NULL )
+	{
+		libesedb_name_hash_table_free(
+		 &( catalog->table_name_hash_table ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the column, index, long value and callback catalog definitions of a table definition
+ * that were not read when the catalog was read on demand
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_read_table_definition(
+     libesedb_catalog_t *catalog,
+     libbfio_handle_t *file_io_handle,
+     libesedb_table_definition_t *table_definition,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page                       = NULL;
+	libesedb_page_tree_value_t *page_tree_value = NULL;
+	libesedb_page_value_t *page_value           = NULL;
+	static char *function                       = "libesedb_catalog_read_table_definition";
+	uint32_t leaf_page_number                   = 0;
+	uint32_t number_of_leaf_pages               = 0;
+	uint16_t catalog_definition_type            = 0;
+	uint16_t number_of_page_values              = 0;
+	uint16_t page_value_index                   = 0;
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog->page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid catalog - missing page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog->page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid catalog - invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->catalog_leaf_page_number == 0 )
+	{
+		return( 1 );
+	}
+	leaf_page_number = table_definition->catalog_leaf_page_number;
+	page_value_index = table_definition->catalog_page_value_index + 1;
+
+	while( leaf_page_number != 0 )
+	{
+		/* Protect against a loop in the leaf page chain
+		 */
+		if( number_of_leaf_pages >= catalog->page_tree->io_handle->last_page_number )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of leaf pages value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_leaf_pages++;
+
+#if ( SIZEOF_INT <= 4 )
+		if( leaf_page_number > (uint32_t) INT_MAX )
+#else
+		if( leaf_page_number > (unsigned int) INT_MAX )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid leaf page number value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_page_store_get_page_by_number(
+		     catalog->page_tree->io_handle,
+		     file_io_handle,
+		     catalog->page_tree->pages_cache,
+		     leaf_page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 leaf_page_number );
+
+			goto on_error;
+		}
+		if( libesedb_page_get_number_of_values(
+		     page,
+		     &number_of_page_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of page values.",
+			 function );
+
+			goto on_error;
+		}
+		while( page_value_index < number_of_page_values )
+		{
+			if( libesedb_page_get_value_by_index(
+			     page,
+			     page_value_index,
+			     &page_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			if( page_value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			page_value_index++;
+
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+			{
+				continue;
+			}
+			if( libesedb_page_tree_value_initialize(
+			     &page_tree_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create page tree value.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_page_tree_value_read_data(
+			     page_tree_value,
+			     page_value->data,
+			     (size_t) page_value->size,
+			     page_value->flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read page tree value: %" PRIu16 ".",
+				 function,
+				 page_value_index - 1 );
+
+				goto on_error;
+			}
+			if( libesedb_catalog_definition_read_type(
+			     page_tree_value->data,
+			     page_tree_value->data_size,
+			     &catalog_definition_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read catalog definition type.",
+				 function );
+
+				goto on_error;
+			}
+			/* The catalog definitions of the table end at the next table catalog definition
+			 */
+			if( catalog_definition_type == LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE )
+			{
+				leaf_page_number = 0;
+
+				break;
+			}
+			if( libesedb_catalog_read_value_data(
+			     catalog,
+			     page_tree_value->data,
+			     page_tree_value->data_size,
+			     &table_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read catalog value.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_page_tree_value_free(
+			     &page_tree_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free page tree value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( page_tree_value != NULL )
+		{
+			if( libesedb_page_tree_value_free(
+			     &page_tree_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free page tree value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( leaf_page_number != 0 )
+		{
+			if( libesedb_page_get_next_page_number(
+			     page,
+			     &leaf_page_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next page number from page: %" PRIu32 ".",
+				 function,
+				 leaf_page_number );
+
+				goto on_error;
+			}
+			page_value_index = 1;
+		}
+	}
+	table_definition->catalog_leaf_page_number = 0;
+
+	return( 1 );
+
+on_error:
+	if( page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &page_tree_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the leaf page descriptors of the table page tree of a table definition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_read_leaf_page_descriptors(
+     libesedb_catalog_t *catalog,
+     libbfio_handle_t *file_io_handle,
+     libesedb_table_definition_t *table_definition,
+     libcerror_error_t **error )
+{
+	libesedb_leaf_page_descriptor_t *leaf_page_descriptor  = NULL;
+	libesedb_leaf_page_descriptor_t *leaf_page_descriptors = NULL;
+	libesedb_page_tree_t *table_page_tree                  = NULL;
+	static char *function                                  = "libesedb_catalog_read_leaf_page_descriptors";
+	int leaf_page_descriptor_index                         = 0;
+	int number_of_leaf_page_descriptors                    = 0;
+	int number_of_leaf_values                              = 0;
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog->page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid catalog - missing page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->table_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table definition - missing table catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->leaf_page_descriptors != NULL )
+	{
+		return( 1 );
+	}
+	/* The table page tree shares the pages vector and cache of the catalog
+	 */
+	if( libesedb_page_tree_initialize(
+	     &table_page_tree,
+	     catalog->page_tree->io_handle,
+	     catalog->page_tree->pages_vector,
+	     catalog->page_tree->pages_cache,
+	     table_definition->table_catalog_definition->identifier,
+	     table_definition->table_catalog_definition->father_data_page_number,
+	     table_definition,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table page tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_get_number_of_leaf_values(
+	     table_page_tree,
+	     file_io_handle,
+	     &number_of_leaf_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of leaf values from table page tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_btree_get_number_of_values(
+	     table_page_tree->leaf_page_descriptors_tree,
+	     &number_of_leaf_page_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of leaf page descriptors.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_leaf_page_descriptors < 0 )
+	 || ( number_of_leaf_page_descriptors > LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of leaf page descriptors value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_leaf_page_descriptors > 0 )
+	{
+		leaf_page_descriptors = (libesedb_leaf_page_descriptor_t *) memory_allocate(
+		                                                             sizeof( libesedb_leaf_page_descriptor_t ) * number_of_leaf_page_descriptors );
+
+		if( leaf_page_descriptors == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create leaf page descriptors.",
+			 function );
+
+			goto on_error;
+		}
+		for( leaf_page_descriptor_index = 0;
+		     leaf_page_descriptor_index < number_of_leaf_page_descriptors;
+		     leaf_page_descriptor_index++ )
+		{
+			if( libcdata_btree_get_value_by_index(
+			     table_page_tree->leaf_page_descriptors_tree,
+			     leaf_page_descriptor_index,
+			     (intptr_t **) &leaf_page_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve leaf page descriptor: %d.",
+				 function,
+				 leaf_page_descriptor_index );
+
+				goto on_error;
+			}
+			if( leaf_page_descriptor == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing leaf page descriptor: %d.",
+				 function,
+				 leaf_page_descriptor_index );
+
+				goto on_error;
+			}
+			leaf_page_descriptors[ leaf_page_descriptor_index ].page_number            = leaf_page_descriptor->page_number;
+			leaf_page_descriptors[ leaf_page_descriptor_index ].first_leaf_value_index = leaf_page_descriptor->first_leaf_value_index;
+			leaf_page_descriptors[ leaf_page_descriptor_index ].last_leaf_value_index  = leaf_page_descriptor->last_leaf_value_index;
+		}
+	}
+	if( libesedb_page_tree_free(
+	     &table_page_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free table page tree.",
+		 function );
+
+		goto on_error;
+	}
+	table_definition->leaf_page_descriptors           = leaf_page_descriptors;
+	table_definition->number_of_leaf_page_descriptors = number_of_leaf_page_descriptors;
+
+	return( 1 );
+
+on_error:
+	if( leaf_page_descriptors != NULL )
+	{
+		memory_free(
+		 leaf_page_descriptors );
+	}
+	if( table_page_tree != NULL )
+	{
+		libesedb_page_tree_free(
+		 &table_page_tree,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the table definitions to a catalog cache
+ * The catalog definitions of table definitions that are read on demand are read first.
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_write_catalog_cache(
+     libesedb_catalog_t *catalog,
+     libbfio_handle_t *file_io_handle,
+     libesedb_catalog_cache_t *catalog_cache,
+     libcerror_error_t **error )
+{
+	libesedb_table_definition_t *table_definition = NULL;
+	static char *function                         = "libesedb_catalog_write_catalog_cache";
+	int number_of_table_definitions               = 0;
+	int table_definition_index                    = 0;
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     catalog->table_definition_array,
+	     &number_of_table_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from table definition array.",
+		 function );
+
+		return( -1 );
+	}
+	for( table_definition_index = 0;
+	     table_definition_index < number_of_table_definitions;
+	     table_definition_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     catalog->table_definition_array,
+		     table_definition_index,
+		     (intptr_t **) &table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d from table definition array.",
+			 function,
+			 table_definition_index );
+
+			return( -1 );
+		}
+		if( libesedb_catalog_read_table_definition(
+		     catalog,
+		     file_io_handle,
+		     table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read table definition: %d.",
+			 function,
+			 table_definition_index );
+
+			return( -1 );
+		}
+		/* A table of which the leaf pages cannot be read is stored without leaf page descriptors
+		 * so that the error is reported when the table is read
+		 */
+		if( libesedb_catalog_read_leaf_page_descriptors(
+		     catalog,
+		     file_io_handle,
+		     table_definition,
+		     error ) != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( libcnotify_verbose != 0 )
+			 && ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		if( libesedb_catalog_cache_append_table_definition(
+		     catalog_cache,
+		     table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append table definition: %d to catalog cache.",
+			 function,
+			 table_definition_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of table definitions
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_get_number_of_table_definitions(
+     libesedb_catalog_t *catalog,
+     int *number_of_table_definitions,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_catalog_get_number_of_table_definitions";
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     catalog->table_definition_array,
+	     number_of_table_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from table definition array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the table definition for the specific index
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_get_table_definition_by_index(
+     libesedb_catalog_t *catalog,
+     int table_definition_index,
+     libesedb_table_definition_t **table_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_catalog_get_table_definition_by_index";
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     catalog->table_definition_array,
+	     table_definition_index,
+	     (intptr_t **) table_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d from table definition array.",
+		 function,
+		 table_definition_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the table definition for the specific name
+ * If use_case_folding is set upper case ASCII characters are folded to lower case
+ * Returns 1 if successful, 0 if no corresponding table definition was found or -1 on error
+ */
+int libesedb_catalog_get_table_definition_by_name(
+     libesedb_catalog_t *catalog,
+     const uint8_t *table_name,
+     size_t table_name_size,
+     uint8_t use_case_folding,
+     libesedb_table_definition_t **table_definition,
+     libcerror_error_t **error )
+{
+	libesedb_name_hash_table_t *name_hash_table        = NULL;
+	libesedb_table_definition_t *safe_table_definition = NULL;
+	static char *function                              = "libesedb_catalog_get_table_definition_by_name";
+	uint32_t hash                                      = 0;
+	int entry_index                                    = 0;
+	int number_of_entries                              = 0;
+	int entry_result                                   = 0;
+	int result                                         = 0;
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( table_name_size == 0 )
+	 || ( table_name_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid table name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	*table_definition = NULL;
+
+	if( libcdata_array_get_number_of_entries(
+	     catalog->table_definition_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries in table definition array.",
+		 function );
+
+		return( -1 );
+	}
+	if( use_case_folding == 0 )
+	{
+		name_hash_table = catalog->table_name_hash_table;
+	}
+	else
+	{
+		name_hash_table = catalog->case_folded_table_name_hash_table;
+	}
+	if( name_hash_table != NULL )
+	{
+		if( name_hash_table->number_of_entries != number_of_entries )
+		{
+			name_hash_table = NULL;
+		}
+	}
+	if( name_hash_table != NULL )
+	{
+		if( libesedb_name_hash_table_calculate_hash_from_byte_stream(
+		     table_name,
+		     table_name_size,
+		     use_case_folding,
+		     &hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate name hash.",
+			 function );
+
+			return( -1 );
+		}
+		entry_result = libesedb_name_hash_table_get_first_entry_index(
+		                name_hash_table,
+		                hash,
+		                &entry_index,
+		                error );
+
+		if( entry_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first entry index from name hash table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( entry_result == 0 )
+		{
+			entry_index = number_of_entries;
+		}
+	}
+	while( entry_index < number_of_entries )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     catalog->table_definition_array,
+		     entry_index,
+		     (intptr_t **) &safe_table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d from table definition array.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( safe_table_definition == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing table definition: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		result = libesedb_catalog_definition_compare_name(
+			  safe_table_definition->table_catalog_definition,
+			  table_name,
+			  table_name_size,
+			  use_case_folding,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: unable to compare table name with table catalog definition: %d name.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
 		else if( result == 1 )
 		{
 			break;
 		}
+		if( name_hash_table != NULL )
+		{
+			entry_result = libesedb_name_hash_table_get_next_entry_index(
+			                name_hash_table,
+			                entry_index,
+			                &entry_index,
+			                error );
+
+			if( entry_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next entry index from name hash table.",
+				 function );
+
+				return( -1 );
+			}
+			else if( entry_result == 0 )
+			{
+				break;
+			}
+		}
+		else
+		{
+			entry_index++;
+		}
 	}
 	if( result != 0 )
 	{
@@ -1102,19 +2234,24 @@ int libesedb_catalog_get_table_definition_by_name(
 }
 
 /* Retrieves the table definition for the specific UTF-8 encoded name
+ * If use_case_folding is set upper case ASCII characters are folded to lower case
  * Returns 1 if successful, 0 if no corresponding table definition was found or -1 on error
  */
 int libesedb_catalog_get_table_definition_by_utf8_name(
      libesedb_catalog_t *catalog,
      const uint8_t *utf8_string,
      size_t utf8_string_length,
+     uint8_t use_case_folding,
      libesedb_table_definition_t **table_definition,
      libcerror_error_t **error )
 {
+	libesedb_name_hash_table_t *name_hash_table        = NULL;
 	libesedb_table_definition_t *safe_table_definition = NULL;
 	static char *function                              = "libesedb_catalog_get_table_definition_by_utf8_name";
+	uint32_t hash                                      = 0;
 	int entry_index                                    = 0;
 	int number_of_entries                              = 0;
+	int entry_result                                   = 0;
 	int result                                         = LIBUNA_COMPARE_GREATER;
 
 	if( catalog == NULL )
@@ -1178,9 +2315,62 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
 
 		return( -1 );
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	if( use_case_folding == 0 )
+	{
+		name_hash_table = catalog->table_name_hash_table;
+	}
+	else
+	{
+		name_hash_table = catalog->case_folded_table_name_hash_table;
+	}
+	if( name_hash_table != NULL )
+	{
+		if( name_hash_table->number_of_entries != number_of_entries )
+		{
+			name_hash_table = NULL;
+		}
+	}
+	if( name_hash_table != NULL )
+	{
+		if( libesedb_name_hash_table_calculate_hash_from_utf8_string(
+		     utf8_string,
+		     utf8_string_length,
+		     use_case_folding,
+		     &hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate name hash.",
+			 function );
+
+			return( -1 );
+		}
+		entry_result = libesedb_name_hash_table_get_first_entry_index(
+		                name_hash_table,
+		                hash,
+		                &entry_index,
+		                error );
+
+		if( entry_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first entry index from name hash table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( entry_result == 0 )
+		{
+			entry_index = number_of_entries;
+		}
+	}
+	while( entry_index < number_of_entries )
 	{
 		if( libcdata_array_get_entry_by_index(
 		     catalog->table_definition_array,
@@ -1214,6 +2404,7 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
 			  safe_table_definition->table_catalog_definition,
 			  utf8_string,
 			  utf8_string_length,
+			  use_case_folding,
 			  error );
 
 		if( result == -1 )
@@ -1232,6 +2423,34 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
 		{
 			break;
 		}
+		if( name_hash_table != NULL )
+		{
+			entry_result = libesedb_name_hash_table_get_next_entry_index(
+			                name_hash_table,
+			                entry_index,
+			                &entry_index,
+			                error );
+
+			if( entry_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next entry index from name hash table.",
+				 function );
+
+				return( -1 );
+			}
+			else if( entry_result == 0 )
+			{
+				break;
+			}
+		}
+		else
+		{
+			entry_index++;
+		}
 	}
 	if( result == LIBUNA_COMPARE_EQUAL )
 	{
@@ -1243,19 +2462,24 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
 }
 
 /* Retrieves the table definition for the specific UTF-16 encoded name
+ * If use_case_folding is set upper case ASCII characters are folded to lower case
  * Returns 1 if successful, 0 if no corresponding table definition was found or -1 on error
  */
 int libesedb_catalog_get_table_definition_by_utf16_name(
      libesedb_catalog_t *catalog,
      const uint16_t *utf16_string,
      size_t utf16_string_length,
+     uint8_t use_case_folding,
      libesedb_table_definition_t **table_definition,
      libcerror_error_t **error )
 {
+	libesedb_name_hash_table_t *name_hash_table        = NULL;
 	libesedb_table_definition_t *safe_table_definition = NULL;
 	static char *function                              = "libesedb_catalog_get_table_definition_by_utf16_name";
+	uint32_t hash                                      = 0;
 	int entry_index                                    = 0;
 	int number_of_entries                              = 0;
+	int entry_result                                   = 0;
 	int result                                         = LIBUNA_COMPARE_GREATER;
 
 	if( catalog == NULL )
@@ -1319,9 +2543,62 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
 
 		return( -1 );
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	if( use_case_folding == 0 )
+	{
+		name_hash_table = catalog->table_name_hash_table;
+	}
+	else
+	{
+		name_hash_table = catalog->case_folded_table_name_hash_table;
+	}
+	if( name_hash_table != NULL )
+	{
+		if( name_hash_table->number_of_entries != number_of_entries )
+		{
+			name_hash_table = NULL;
+		}
+	}
+	if( name_hash_table != NULL )
+	{
+		if( libesedb_name_hash_table_calculate_hash_from_utf16_string(
+		     utf16_string,
+		     utf16_string_length,
+		     use_case_folding,
+		     &hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate name hash.",
+			 function );
+
+			return( -1 );
+		}
+		entry_result = libesedb_name_hash_table_get_first_entry_index(
+		                name_hash_table,
+		                hash,
+		                &entry_index,
+		                error );
+
+		if( entry_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first entry index from name hash table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( entry_result == 0 )
+		{
+			entry_index = number_of_entries;
+		}
+	}
+	while( entry_index < number_of_entries )
 	{
 		if( libcdata_array_get_entry_by_index(
 		     catalog->table_definition_array,
@@ -1355,6 +2632,7 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
 			  safe_table_definition->table_catalog_definition,
 			  utf16_string,
 			  utf16_string_length,
+			  use_case_folding,
 			  error );
 
 		if( result == -1 )
@@ -1373,6 +2651,34 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
 		{
 			break;
 		}
+		if( name_hash_table != NULL )
+		{
+			entry_result = libesedb_name_hash_table_get_next_entry_index(
+			                name_hash_table,
+			                entry_index,
+			                &entry_index,
+			                error );
+
+			if( entry_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next entry index from name hash table.",
+				 function );
+
+				return( -1 );
+			}
+			else if( entry_result == 0 )
+			{
+				break;
+			}
+		}
+		else
+		{
+			entry_index++;
+		}
 	}
 	if( result == LIBUNA_COMPARE_EQUAL )
 	{
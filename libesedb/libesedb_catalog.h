@@ -25,13 +25,15 @@
 #include <common.h>
 #include <types.h>
 
-#include "libesedb_block_tree.h"
+#include "libesedb_catalog_cache.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_name_hash_table.h"
+#include "libesedb_page_bitmap.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_table_definition.h"
 
@@ -47,13 +49,27 @@ struct libesedb_catalog
 	 */
 	libesedb_page_tree_t *page_tree;
 
-	/* The page block tree
+	/* The page bitmap
+	 * Used to detect loops in the leaf page chain
 	 */
-	libesedb_block_tree_t *page_block_tree;
+	libesedb_page_bitmap_t *page_bitmap;
 
 	/* The table definition array
 	 */
 	libcdata_array_t *table_definition_array;
+
+	/* The table name hash table
+	 */
+	libesedb_name_hash_table_t *table_name_hash_table;
+
+	/* The case folded table name hash table
+	 */
+	libesedb_name_hash_table_t *case_folded_table_name_hash_table;
+
+	/* Value to indicate the column, index, long value and callback catalog definitions
+	 * of a table are read on demand
+	 */
+	uint8_t read_on_demand;
 };
 
 int libesedb_catalog_initialize(
@@ -86,6 +102,33 @@ int libesedb_catalog_read_file_io_handle(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libesedb_catalog_read_catalog_cache(
+     libesedb_catalog_t *catalog,
+     libesedb_catalog_cache_t *catalog_cache,
+     libcerror_error_t **error );
+
+int libesedb_catalog_build_table_name_hash_tables(
+     libesedb_catalog_t *catalog,
+     libcerror_error_t **error );
+
+int libesedb_catalog_read_table_definition(
+     libesedb_catalog_t *catalog,
+     libbfio_handle_t *file_io_handle,
+     libesedb_table_definition_t *table_definition,
+     libcerror_error_t **error );
+
+int libesedb_catalog_read_leaf_page_descriptors(
+     libesedb_catalog_t *catalog,
+     libbfio_handle_t *file_io_handle,
+     libesedb_table_definition_t *table_definition,
+     libcerror_error_t **error );
+
+int libesedb_catalog_write_catalog_cache(
+     libesedb_catalog_t *catalog,
+     libbfio_handle_t *file_io_handle,
+     libesedb_catalog_cache_t *catalog_cache,
+     libcerror_error_t **error );
+
 int libesedb_catalog_get_number_of_table_definitions(
      libesedb_catalog_t *catalog,
      int *number_of_table_definitions,
@@ -101,6 +144,7 @@ int libesedb_catalog_get_table_definition_by_name(
      libesedb_catalog_t *catalog,
      const uint8_t *table_name,
      size_t table_name_size,
+     uint8_t use_case_folding,
      libesedb_table_definition_t **table_definition,
      libcerror_error_t **error );
 
@@ -108,6 +152,7 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
      libesedb_catalog_t *catalog,
      const uint8_t *utf8_string,
      size_t utf8_string_length,
+     uint8_t use_case_folding,
      libesedb_table_definition_t **table_definition,
      libcerror_error_t **error );
 
@@ -115,6 +160,7 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
      libesedb_catalog_t *catalog,
      const uint16_t *utf16_string,
      size_t utf16_string_length,
+     uint8_t use_case_folding,
      libesedb_table_definition_t **table_definition,
      libcerror_error_t **error );
 
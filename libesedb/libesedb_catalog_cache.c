@@ -0,0 +1,1845 @@
+/*
+ * Catalog cache functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_catalog_cache.h"
+#include "libesedb_catalog_definition.h"
+#include "libesedb_checksum.h"
+#include "libesedb_definitions.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_leaf_page_descriptor.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libcnotify.h"
+
+#include "esedb_catalog_cache.h"
+
+const uint8_t esedb_catalog_cache_signature[ 8 ] = {
+	'E', 'S', 'E', 'D', 'B', 'C', 'C', 0 };
+
+/* Creates a catalog cache
+ * Make sure the value catalog_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_cache_initialize(
+     libesedb_catalog_cache_t **catalog_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_catalog_cache_initialize";
+
+	if( catalog_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *catalog_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid catalog cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*catalog_cache = memory_allocate_structure(
+	                  libesedb_catalog_cache_t );
+
+	if( *catalog_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create catalog cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *catalog_cache,
+	     0,
+	     sizeof( libesedb_catalog_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear catalog cache.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *catalog_cache != NULL )
+	{
+		memory_free(
+		 *catalog_cache );
+
+		*catalog_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a catalog cache
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_cache_free(
+     libesedb_catalog_cache_t **catalog_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_catalog_cache_free";
+
+	if( catalog_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *catalog_cache != NULL )
+	{
+		if( ( *catalog_cache )->data != NULL )
+		{
+			memory_free(
+			 ( *catalog_cache )->data );
+		}
+		memory_free(
+		 *catalog_cache );
+
+		*catalog_cache = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the data of the catalog cache
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_cache_resize_data(
+     libesedb_catalog_cache_t *catalog_cache,
+     size_t required_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation      = NULL;
+	static char *function      = "libesedb_catalog_cache_resize_data";
+	size_t allocated_data_size = 0;
+
+	if( catalog_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_data_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid required data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_data_size <= catalog_cache->allocated_data_size )
+	{
+		return( 1 );
+	}
+	allocated_data_size = 2 * catalog_cache->allocated_data_size;
+
+	if( allocated_data_size < 65536 )
+	{
+		allocated_data_size = 65536;
+	}
+	if( allocated_data_size < required_data_size )
+	{
+		allocated_data_size = required_data_size;
+	}
+	if( allocated_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		allocated_data_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE;
+	}
+	if( allocated_data_size < required_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocated data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	reallocation = (uint8_t *) memory_reallocate(
+	                            catalog_cache->data,
+	                            allocated_data_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize data.",
+		 function );
+
+		return( -1 );
+	}
+	catalog_cache->data                = reallocation;
+	catalog_cache->allocated_data_size = allocated_data_size;
+
+	return( 1 );
+}
+
+/* Appends a catalog definition to the catalog cache
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_cache_append_catalog_definition(
+     libesedb_catalog_cache_t *catalog_cache,
+     libesedb_catalog_definition_t *catalog_definition,
+     libcerror_error_t **error )
+{
+	esedb_catalog_cache_catalog_definition_t *catalog_definition_data = NULL;
+	static char *function                                             = "libesedb_catalog_cache_append_catalog_definition";
+	size_t data_offset                                                = 0;
+	size_t required_data_size                                         = 0;
+
+	if( catalog_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( catalog_definition->name_size > (size_t) UINT16_MAX )
+	 || ( catalog_definition->template_name_size > (size_t) UINT16_MAX )
+	 || ( catalog_definition->default_value_size > (size_t) UINT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid catalog definition - data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset        = catalog_cache->data_size;
+	required_data_size = data_offset
+	                   + sizeof( esedb_catalog_cache_catalog_definition_t )
+	                   + catalog_definition->name_size
+	                   + catalog_definition->template_name_size
+	                   + catalog_definition->default_value_size;
+
+	if( libesedb_catalog_cache_resize_data(
+	     catalog_cache,
+	     required_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize data.",
+		 function );
+
+		return( -1 );
+	}
+	catalog_definition_data = (esedb_catalog_cache_catalog_definition_t *) &( catalog_cache->data[ data_offset ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 catalog_definition_data->father_data_page_object_identifier,
+	 catalog_definition->father_data_page_object_identifier );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 catalog_definition_data->type,
+	 catalog_definition->type );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 catalog_definition_data->identifier,
+	 catalog_definition->identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 catalog_definition_data->father_data_page_number,
+	 catalog_definition->father_data_page_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 catalog_definition_data->size,
+	 catalog_definition->size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 catalog_definition_data->flags,
+	 catalog_definition->flags );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 catalog_definition_data->codepage,
+	 catalog_definition->codepage );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 catalog_definition_data->lcmap_flags,
+	 catalog_definition->lcmap_flags );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 catalog_definition_data->name_size,
+	 (uint16_t) catalog_definition->name_size );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 catalog_definition_data->template_name_size,
+	 (uint16_t) catalog_definition->template_name_size );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 catalog_definition_data->default_value_size,
+	 (uint16_t) catalog_definition->default_value_size );
+
+	data_offset += sizeof( esedb_catalog_cache_catalog_definition_t );
+
+	if( catalog_definition->name_size > 0 )
+	{
+		if( memory_copy(
+		     &( catalog_cache->data[ data_offset ] ),
+		     catalog_definition->name,
+		     catalog_definition->name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset += catalog_definition->name_size;
+	}
+	if( catalog_definition->template_name_size > 0 )
+	{
+		if( memory_copy(
+		     &( catalog_cache->data[ data_offset ] ),
+		     catalog_definition->template_name,
+		     catalog_definition->template_name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy template name.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset += catalog_definition->template_name_size;
+	}
+	if( catalog_definition->default_value_size > 0 )
+	{
+		if( memory_copy(
+		     &( catalog_cache->data[ data_offset ] ),
+		     catalog_definition->default_value,
+		     catalog_definition->default_value_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy default value.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset += catalog_definition->default_value_size;
+	}
+	catalog_cache->data_size = data_offset;
+
+	return( 1 );
+}
+
+/* Appends a table definition to the catalog cache
+ * The table definition must contain all its catalog definitions
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_cache_append_table_definition(
+     libesedb_catalog_cache_t *catalog_cache,
+     libesedb_table_definition_t *table_definition,
+     libcerror_error_t **error )
+{
+	esedb_catalog_cache_leaf_page_descriptor_t *leaf_page_descriptor_data = NULL;
+	esedb_catalog_cache_table_definition_t *table_definition_data         = NULL;
+	libesedb_catalog_definition_t *catalog_definition                     = NULL;
+	libesedb_leaf_page_descriptor_t *leaf_page_descriptor                 = NULL;
+	static char *function                                                 = "libesedb_catalog_cache_append_table_definition";
+	size_t table_definition_data_offset                                   = 0;
+	size_t table_definition_data_size                                     = 0;
+	uint32_t flags                                                        = 0;
+	int definition_index                                                  = 0;
+	int leaf_page_descriptor_index                                        = 0;
+	int number_of_column_catalog_definitions                              = 0;
+	int number_of_index_catalog_definitions                               = 0;
+
+	if( catalog_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_cache->number_of_table_definitions == UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid catalog cache - number of table definitions value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->catalog_leaf_page_number != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported table definition - catalog definitions have not been read.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_table_definition_get_number_of_column_catalog_definitions(
+	     table_definition,
+	     &number_of_column_catalog_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of column catalog definitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_table_definition_get_number_of_index_catalog_definitions(
+	     table_definition,
+	     &number_of_index_catalog_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of index catalog definitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->long_value_catalog_definition != NULL )
+	{
+		flags |= LIBESEDB_CATALOG_CACHE_TABLE_DEFINITION_FLAG_HAS_LONG_VALUE;
+	}
+	if( table_definition->callback_catalog_definition != NULL )
+	{
+		flags |= LIBESEDB_CATALOG_CACHE_TABLE_DEFINITION_FLAG_HAS_CALLBACK;
+	}
+	if( table_definition->leaf_page_descriptors != NULL )
+	{
+		flags |= LIBESEDB_CATALOG_CACHE_TABLE_DEFINITION_FLAG_HAS_LEAF_PAGES;
+	}
+	table_definition_data_offset = catalog_cache->data_size;
+
+	if( libesedb_catalog_cache_resize_data(
+	     catalog_cache,
+	     table_definition_data_offset + 4 + sizeof( esedb_catalog_cache_table_definition_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize data.",
+		 function );
+
+		goto on_error;
+	}
+	table_definition_data = (esedb_catalog_cache_table_definition_t *) &( catalog_cache->data[ table_definition_data_offset + 4 ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 table_definition_data->flags,
+	 flags );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 table_definition_data->number_of_column_catalog_definitions,
+	 (uint32_t) number_of_column_catalog_definitions );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 table_definition_data->number_of_index_catalog_definitions,
+	 (uint32_t) number_of_index_catalog_definitions );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 table_definition_data->number_of_leaf_page_descriptors,
+	 (uint32_t) table_definition->number_of_leaf_page_descriptors );
+
+	catalog_cache->data_size = table_definition_data_offset + 4 + sizeof( esedb_catalog_cache_table_definition_t );
+
+	if( libesedb_catalog_cache_append_catalog_definition(
+	     catalog_cache,
+	     table_definition->table_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append table catalog definition.",
+		 function );
+
+		goto on_error;
+	}
+	if( table_definition->long_value_catalog_definition != NULL )
+	{
+		if( libesedb_catalog_cache_append_catalog_definition(
+		     catalog_cache,
+		     table_definition->long_value_catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append long value catalog definition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( table_definition->callback_catalog_definition != NULL )
+	{
+		if( libesedb_catalog_cache_append_catalog_definition(
+		     catalog_cache,
+		     table_definition->callback_catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append callback catalog definition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( definition_index = 0;
+	     definition_index < number_of_column_catalog_definitions;
+	     definition_index++ )
+	{
+		if( libesedb_table_definition_get_column_catalog_definition_by_index(
+		     table_definition,
+		     definition_index,
+		     &catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition: %d.",
+			 function,
+			 definition_index );
+
+			goto on_error;
+		}
+		if( libesedb_catalog_cache_append_catalog_definition(
+		     catalog_cache,
+		     catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append column catalog definition: %d.",
+			 function,
+			 definition_index );
+
+			goto on_error;
+		}
+	}
+	for( definition_index = 0;
+	     definition_index < number_of_index_catalog_definitions;
+	     definition_index++ )
+	{
+		if( libesedb_table_definition_get_index_catalog_definition_by_index(
+		     table_definition,
+		     definition_index,
+		     &catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve index catalog definition: %d.",
+			 function,
+			 definition_index );
+
+			goto on_error;
+		}
+		if( libesedb_catalog_cache_append_catalog_definition(
+		     catalog_cache,
+		     catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append index catalog definition: %d.",
+			 function,
+			 definition_index );
+
+			goto on_error;
+		}
+	}
+	if( table_definition->leaf_page_descriptors != NULL )
+	{
+		if( libesedb_catalog_cache_resize_data(
+		     catalog_cache,
+		     catalog_cache->data_size + ( sizeof( esedb_catalog_cache_leaf_page_descriptor_t ) * (size_t) table_definition->number_of_leaf_page_descriptors ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize data.",
+			 function );
+
+			goto on_error;
+		}
+		for( leaf_page_descriptor_index = 0;
+		     leaf_page_descriptor_index < table_definition->number_of_leaf_page_descriptors;
+		     leaf_page_descriptor_index++ )
+		{
+			leaf_page_descriptor      = &( table_definition->leaf_page_descriptors[ leaf_page_descriptor_index ] );
+			leaf_page_descriptor_data = (esedb_catalog_cache_leaf_page_descriptor_t *) &( catalog_cache->data[ catalog_cache->data_size ] );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 leaf_page_descriptor_data->page_number,
+			 leaf_page_descriptor->page_number );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 leaf_page_descriptor_data->number_of_leaf_values,
+			 (uint32_t) ( leaf_page_descriptor->last_leaf_value_index + 1 - leaf_page_descriptor->first_leaf_value_index ) );
+
+			catalog_cache->data_size += sizeof( esedb_catalog_cache_leaf_page_descriptor_t );
+		}
+	}
+	table_definition_data_size = catalog_cache->data_size - ( table_definition_data_offset + 4 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( catalog_cache->data[ table_definition_data_offset ] ),
+	 (uint32_t) table_definition_data_size );
+
+	catalog_cache->number_of_table_definitions += 1;
+
+	return( 1 );
+
+on_error:
+	catalog_cache->data_size = table_definition_data_offset;
+
+	return( -1 );
+}
+
+/* Reads a catalog definition from catalog cache data
+ * The data offset is updated to point to the data after the catalog definition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_cache_read_catalog_definition(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libesedb_catalog_definition_t **catalog_definition,
+     libcerror_error_t **error )
+{
+	esedb_catalog_cache_catalog_definition_t *catalog_definition_data = NULL;
+	libesedb_catalog_definition_t *safe_catalog_definition            = NULL;
+	static char *function                                             = "libesedb_catalog_cache_read_catalog_definition";
+	size_t safe_data_offset                                           = 0;
+	uint16_t default_value_size                                       = 0;
+	uint16_t name_size                                                = 0;
+	uint16_t template_name_size                                       = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_offset = *data_offset;
+
+	if( ( safe_data_offset > data_size )
+	 || ( sizeof( esedb_catalog_cache_catalog_definition_t ) > ( data_size - safe_data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	catalog_definition_data = (esedb_catalog_cache_catalog_definition_t *) &( data[ safe_data_offset ] );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 catalog_definition_data->name_size,
+	 name_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 catalog_definition_data->template_name_size,
+	 template_name_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 catalog_definition_data->default_value_size,
+	 default_value_size );
+
+	safe_data_offset += sizeof( esedb_catalog_cache_catalog_definition_t );
+
+	if( ( (size_t) name_size + (size_t) template_name_size + (size_t) default_value_size ) > ( data_size - safe_data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid catalog definition data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_definition_initialize(
+	     &safe_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create catalog definition.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 catalog_definition_data->father_data_page_object_identifier,
+	 safe_catalog_definition->father_data_page_object_identifier );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 catalog_definition_data->type,
+	 safe_catalog_definition->type );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 catalog_definition_data->identifier,
+	 safe_catalog_definition->identifier );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 catalog_definition_data->father_data_page_number,
+	 safe_catalog_definition->father_data_page_number );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 catalog_definition_data->size,
+	 safe_catalog_definition->size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 catalog_definition_data->flags,
+	 safe_catalog_definition->flags );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 catalog_definition_data->codepage,
+	 safe_catalog_definition->codepage );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 catalog_definition_data->lcmap_flags,
+	 safe_catalog_definition->lcmap_flags );
+
+	if( name_size > 0 )
+	{
+		safe_catalog_definition->name = (uint8_t *) memory_allocate(
+		                                             sizeof( uint8_t ) * name_size );
+
+		if( safe_catalog_definition->name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create name.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     safe_catalog_definition->name,
+		     &( data[ safe_data_offset ] ),
+		     (size_t) name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			goto on_error;
+		}
+		safe_catalog_definition->name_size = (size_t) name_size;
+
+		safe_data_offset += name_size;
+	}
+	if( template_name_size > 0 )
+	{
+		safe_catalog_definition->template_name = (uint8_t *) memory_allocate(
+		                                                      sizeof( uint8_t ) * template_name_size );
+
+		if( safe_catalog_definition->template_name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create template name.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     safe_catalog_definition->template_name,
+		     &( data[ safe_data_offset ] ),
+		     (size_t) template_name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy template name.",
+			 function );
+
+			goto on_error;
+		}
+		safe_catalog_definition->template_name_size = (size_t) template_name_size;
+
+		safe_data_offset += template_name_size;
+	}
+	if( default_value_size > 0 )
+	{
+		safe_catalog_definition->default_value = (uint8_t *) memory_allocate(
+		                                                      sizeof( uint8_t ) * default_value_size );
+
+		if( safe_catalog_definition->default_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create default value.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     safe_catalog_definition->default_value,
+		     &( data[ safe_data_offset ] ),
+		     (size_t) default_value_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy default value.",
+			 function );
+
+			goto on_error;
+		}
+		safe_catalog_definition->default_value_size = (size_t) default_value_size;
+
+		safe_data_offset += default_value_size;
+	}
+	*data_offset        = safe_data_offset;
+	*catalog_definition = safe_catalog_definition;
+
+	return( 1 );
+
+on_error:
+	if( safe_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &safe_catalog_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the next table definition from the catalog cache
+ * The data offset is updated to point to the table definition after the table definition retrieved
+ * Returns 1 if successful, 0 if no more table definitions or -1 on error
+ */
+int libesedb_catalog_cache_get_next_table_definition(
+     libesedb_catalog_cache_t *catalog_cache,
+     size_t *data_offset,
+     libesedb_table_definition_t **table_definition,
+     libcerror_error_t **error )
+{
+	esedb_catalog_cache_leaf_page_descriptor_t *leaf_page_descriptor_data = NULL;
+	libesedb_catalog_definition_t *catalog_definition                     = NULL;
+	libesedb_leaf_page_descriptor_t *leaf_page_descriptors                = NULL;
+	libesedb_table_definition_t *safe_table_definition                    = NULL;
+	const uint8_t *table_definition_data                                  = NULL;
+	static char *function                                                 = "libesedb_catalog_cache_get_next_table_definition";
+	size_t safe_data_offset                                               = 0;
+	size_t table_definition_data_offset                                   = 0;
+	uint32_t definition_index                                             = 0;
+	uint32_t flags                                                        = 0;
+	uint32_t leaf_page_number_of_leaf_values                              = 0;
+	uint32_t number_of_column_catalog_definitions                         = 0;
+	uint32_t number_of_index_catalog_definitions                          = 0;
+	uint32_t number_of_leaf_page_descriptors                              = 0;
+	uint32_t table_definition_data_size                                   = 0;
+	int number_of_leaf_values                                             = 0;
+
+	if( catalog_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( *table_definition != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid table definition value already set.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_offset = *data_offset;
+
+	if( safe_data_offset >= catalog_cache->data_size )
+	{
+		return( 0 );
+	}
+	if( ( catalog_cache->data == NULL )
+	 || ( 4 > ( catalog_cache->data_size - safe_data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( catalog_cache->data[ safe_data_offset ] ),
+	 table_definition_data_size );
+
+	safe_data_offset += 4;
+
+	if( ( (size_t) table_definition_data_size > ( catalog_cache->data_size - safe_data_offset ) )
+	 || ( table_definition_data_size < sizeof( esedb_catalog_cache_table_definition_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid table definition data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	table_definition_data = &( catalog_cache->data[ safe_data_offset ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_catalog_cache_table_definition_t *) table_definition_data )->flags,
+	 flags );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_catalog_cache_table_definition_t *) table_definition_data )->number_of_column_catalog_definitions,
+	 number_of_column_catalog_definitions );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_catalog_cache_table_definition_t *) table_definition_data )->number_of_index_catalog_definitions,
+	 number_of_index_catalog_definitions );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_catalog_cache_table_definition_t *) table_definition_data )->number_of_leaf_page_descriptors,
+	 number_of_leaf_page_descriptors );
+
+	table_definition_data_offset = sizeof( esedb_catalog_cache_table_definition_t );
+
+	if( libesedb_catalog_cache_read_catalog_definition(
+	     table_definition_data,
+	     (size_t) table_definition_data_size,
+	     &table_definition_data_offset,
+	     &catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read table catalog definition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_table_definition_initialize(
+	     &safe_table_definition,
+	     catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table definition.",
+		 function );
+
+		goto on_error;
+	}
+	catalog_definition = NULL;
+
+	if( ( flags & LIBESEDB_CATALOG_CACHE_TABLE_DEFINITION_FLAG_HAS_LONG_VALUE ) != 0 )
+	{
+		if( libesedb_catalog_cache_read_catalog_definition(
+		     table_definition_data,
+		     (size_t) table_definition_data_size,
+		     &table_definition_data_offset,
+		     &catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read long value catalog definition.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_table_definition_set_long_value_catalog_definition(
+		     safe_table_definition,
+		     catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set long value catalog definition in table definition.",
+			 function );
+
+			goto on_error;
+		}
+		catalog_definition = NULL;
+	}
+	if( ( flags & LIBESEDB_CATALOG_CACHE_TABLE_DEFINITION_FLAG_HAS_CALLBACK ) != 0 )
+	{
+		if( libesedb_catalog_cache_read_catalog_definition(
+		     table_definition_data,
+		     (size_t) table_definition_data_size,
+		     &table_definition_data_offset,
+		     &catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read callback catalog definition.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_table_definition_set_callback_catalog_definition(
+		     safe_table_definition,
+		     catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set callback catalog definition in table definition.",
+			 function );
+
+			goto on_error;
+		}
+		catalog_definition = NULL;
+	}
+	for( definition_index = 0;
+	     definition_index < number_of_column_catalog_definitions;
+	     definition_index++ )
+	{
+		if( libesedb_catalog_cache_read_catalog_definition(
+		     table_definition_data,
+		     (size_t) table_definition_data_size,
+		     &table_definition_data_offset,
+		     &catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read column catalog definition: %" PRIu32 ".",
+			 function,
+			 definition_index );
+
+			goto on_error;
+		}
+		if( libesedb_table_definition_append_column_catalog_definition(
+		     safe_table_definition,
+		     catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append column catalog definition: %" PRIu32 " to table definition.",
+			 function,
+			 definition_index );
+
+			goto on_error;
+		}
+		catalog_definition = NULL;
+	}
+	for( definition_index = 0;
+	     definition_index < number_of_index_catalog_definitions;
+	     definition_index++ )
+	{
+		if( libesedb_catalog_cache_read_catalog_definition(
+		     table_definition_data,
+		     (size_t) table_definition_data_size,
+		     &table_definition_data_offset,
+		     &catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read index catalog definition: %" PRIu32 ".",
+			 function,
+			 definition_index );
+
+			goto on_error;
+		}
+		if( libesedb_table_definition_append_index_catalog_definition(
+		     safe_table_definition,
+		     catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append index catalog definition: %" PRIu32 " to table definition.",
+			 function,
+			 definition_index );
+
+			goto on_error;
+		}
+		catalog_definition = NULL;
+	}
+	if( ( flags & LIBESEDB_CATALOG_CACHE_TABLE_DEFINITION_FLAG_HAS_LEAF_PAGES ) != 0 )
+	{
+		if( ( number_of_leaf_page_descriptors == 0 )
+		 || ( number_of_leaf_page_descriptors > (uint32_t) LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES )
+		 || ( ( sizeof( esedb_catalog_cache_leaf_page_descriptor_t ) * (size_t) number_of_leaf_page_descriptors ) > ( (size_t) table_definition_data_size - table_definition_data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of leaf page descriptors value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		leaf_page_descriptors = (libesedb_leaf_page_descriptor_t *) memory_allocate(
+		                                                             sizeof( libesedb_leaf_page_descriptor_t ) * number_of_leaf_page_descriptors );
+
+		if( leaf_page_descriptors == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create leaf page descriptors.",
+			 function );
+
+			goto on_error;
+		}
+		for( definition_index = 0;
+		     definition_index < number_of_leaf_page_descriptors;
+		     definition_index++ )
+		{
+			leaf_page_descriptor_data = (esedb_catalog_cache_leaf_page_descriptor_t *) &( table_definition_data[ table_definition_data_offset ] );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 leaf_page_descriptor_data->page_number,
+			 leaf_page_descriptors[ definition_index ].page_number );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 leaf_page_descriptor_data->number_of_leaf_values,
+			 leaf_page_number_of_leaf_values );
+
+			table_definition_data_offset += sizeof( esedb_catalog_cache_leaf_page_descriptor_t );
+
+			if( ( leaf_page_descriptors[ definition_index ].page_number == 0 )
+			 || ( leaf_page_number_of_leaf_values > (uint32_t) ( INT_MAX - number_of_leaf_values ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid leaf page descriptor: %" PRIu32 " value out of bounds.",
+				 function,
+				 definition_index );
+
+				goto on_error;
+			}
+			leaf_page_descriptors[ definition_index ].first_leaf_value_index = number_of_leaf_values;
+
+			number_of_leaf_values += (int) leaf_page_number_of_leaf_values;
+
+			leaf_page_descriptors[ definition_index ].last_leaf_value_index = number_of_leaf_values - 1;
+		}
+		safe_table_definition->leaf_page_descriptors           = leaf_page_descriptors;
+		safe_table_definition->number_of_leaf_page_descriptors = (int) number_of_leaf_page_descriptors;
+
+		leaf_page_descriptors = NULL;
+	}
+	if( table_definition_data_offset != (size_t) table_definition_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid table definition data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	*data_offset      = safe_data_offset + table_definition_data_size;
+	*table_definition = safe_table_definition;
+
+	return( 1 );
+
+on_error:
+	if( leaf_page_descriptors != NULL )
+	{
+		memory_free(
+		 leaf_page_descriptors );
+	}
+	if( catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &catalog_definition,
+		 NULL );
+	}
+	if( safe_table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &safe_table_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the catalog cache
+ * The catalog cache is only read if it corresponds with the database of the IO handle
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libesedb_catalog_cache_read_file_io_handle(
+     libesedb_catalog_cache_t *catalog_cache,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t header_data[ sizeof( esedb_catalog_cache_header_t ) ];
+
+	uint8_t *data                        = NULL;
+	static char *function                = "libesedb_catalog_cache_read_file_io_handle";
+	size_t data_offset                   = 0;
+	ssize_t read_count                   = 0;
+	uint64_t database_time               = 0;
+	uint64_t file_size                   = 0;
+	uint32_t calculated_checksum         = 0;
+	uint32_t data_size                   = 0;
+	uint32_t file_header_checksum        = 0;
+	uint32_t format_version              = 0;
+	uint32_t number_of_table_definitions = 0;
+	uint32_t page_size                   = 0;
+	uint32_t stored_checksum             = 0;
+	uint32_t table_definition_data_size  = 0;
+	uint32_t table_definition_index      = 0;
+
+	if( catalog_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_cache->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid catalog cache - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              header_data,
+	              sizeof( esedb_catalog_cache_header_t ),
+	              0,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read catalog cache header data at offset: 0 (0x00000000).",
+		 function );
+
+		goto on_error;
+	}
+	/* An empty or truncated catalog cache is not considered an error
+	 */
+	if( read_count != (ssize_t) sizeof( esedb_catalog_cache_header_t ) )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     ( (esedb_catalog_cache_header_t *) header_data )->signature,
+	     esedb_catalog_cache_signature,
+	     8 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) header_data )->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) header_data )->number_of_table_definitions,
+	 number_of_table_definitions );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (esedb_catalog_cache_header_t *) header_data )->file_size,
+	 file_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) header_data )->file_header_checksum,
+	 file_header_checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) header_data )->page_size,
+	 page_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (esedb_catalog_cache_header_t *) header_data )->database_time,
+	 database_time );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) header_data )->data_size,
+	 data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) header_data )->data_checksum,
+	 stored_checksum );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: format version\t\t\t: %" PRIu32 "\n",
+		 function,
+		 format_version );
+
+		libcnotify_printf(
+		 "%s: number of table definitions\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_table_definitions );
+
+		libcnotify_printf(
+		 "%s: file size\t\t\t\t: %" PRIu64 "\n",
+		 function,
+		 file_size );
+
+		libcnotify_printf(
+		 "%s: file header checksum\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 file_header_checksum );
+
+		libcnotify_printf(
+		 "%s: page size\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 page_size );
+
+		libcnotify_printf(
+		 "%s: database time\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 database_time );
+
+		libcnotify_printf(
+		 "%s: data size\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 data_size );
+
+		libcnotify_printf(
+		 "%s: data checksum\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 stored_checksum );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	/* A catalog cache of another format version or of another database is not used
+	 */
+	if( ( format_version != 2 )
+	 || ( file_size != (uint64_t) io_handle->file_size )
+	 || ( file_header_checksum != io_handle->file_header_checksum )
+	 || ( page_size != io_handle->page_size )
+	 || ( database_time != io_handle->database_time ) )
+	{
+		return( 0 );
+	}
+	if( ( number_of_table_definitions == 0 )
+	 || ( data_size == 0 )
+	 || ( (size_t) data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		return( 0 );
+	}
+	data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              data,
+	              (size_t) data_size,
+	              (off64_t) sizeof( esedb_catalog_cache_header_t ),
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read catalog cache data.",
+		 function );
+
+		goto on_error;
+	}
+	if( read_count != (ssize_t) data_size )
+	{
+		memory_free(
+		 data );
+
+		return( 0 );
+	}
+	if( libesedb_checksum_calculate_little_endian_xor32(
+	     &calculated_checksum,
+	     data,
+	     (size_t) data_size,
+	     0x89abcdef,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		memory_free(
+		 data );
+
+		return( 0 );
+	}
+	/* Check if the data consists of exactly the number of table definitions
+	 */
+	while( data_offset < (size_t) data_size )
+	{
+		if( 4 > ( data_size - data_offset ) )
+		{
+			break;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ data_offset ] ),
+		 table_definition_data_size );
+
+		data_offset += 4;
+
+		if( (size_t) table_definition_data_size > ( data_size - data_offset ) )
+		{
+			break;
+		}
+		data_offset += table_definition_data_size;
+
+		table_definition_index++;
+	}
+	if( ( table_definition_index != number_of_table_definitions )
+	 || ( data_offset != (size_t) data_size ) )
+	{
+		memory_free(
+		 data );
+
+		return( 0 );
+	}
+	catalog_cache->data                        = data;
+	catalog_cache->data_size                   = (size_t) data_size;
+	catalog_cache->allocated_data_size         = (size_t) data_size;
+	catalog_cache->number_of_table_definitions = number_of_table_definitions;
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Writes the catalog cache
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_cache_write_file_io_handle(
+     libesedb_catalog_cache_t *catalog_cache,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t header_data[ sizeof( esedb_catalog_cache_header_t ) ];
+
+	static char *function = "libesedb_catalog_cache_write_file_io_handle";
+	ssize_t write_count   = 0;
+	uint32_t checksum     = 0;
+
+	if( catalog_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( catalog_cache->data == NULL )
+	 || ( catalog_cache->data_size == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid catalog cache - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_cache->data_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid catalog cache - data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_checksum_calculate_little_endian_xor32(
+	     &checksum,
+	     catalog_cache->data,
+	     catalog_cache->data_size,
+	     0x89abcdef,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     ( (esedb_catalog_cache_header_t *) header_data )->signature,
+	     esedb_catalog_cache_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) header_data )->format_version,
+	 2 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) header_data )->number_of_table_definitions,
+	 catalog_cache->number_of_table_definitions );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (esedb_catalog_cache_header_t *) header_data )->file_size,
+	 (uint64_t) io_handle->file_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) header_data )->file_header_checksum,
+	 io_handle->file_header_checksum );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) header_data )->page_size,
+	 io_handle->page_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (esedb_catalog_cache_header_t *) header_data )->database_time,
+	 io_handle->database_time );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) header_data )->data_size,
+	 (uint32_t) catalog_cache->data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) header_data )->data_checksum,
+	 checksum );
+
+	/* The data is written before the header so that an interrupted write
+	 * does not result in a catalog cache with a valid header
+	 */
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               file_io_handle,
+	               catalog_cache->data,
+	               catalog_cache->data_size,
+	               (off64_t) sizeof( esedb_catalog_cache_header_t ),
+	               error );
+
+	if( write_count != (ssize_t) catalog_cache->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write catalog cache data.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               file_io_handle,
+	               header_data,
+	               sizeof( esedb_catalog_cache_header_t ),
+	               0,
+	               error );
+
+	if( write_count != (ssize_t) sizeof( esedb_catalog_cache_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write catalog cache header data at offset: 0 (0x00000000).",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
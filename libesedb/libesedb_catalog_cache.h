@@ -0,0 +1,115 @@
+/*
+ * Catalog cache functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_CATALOG_CACHE_H )
+#define _LIBESEDB_CATALOG_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_table_definition.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_catalog_cache libesedb_catalog_cache_t;
+
+/* The catalog cache contains the parsed table definitions of the catalog
+ * and the leaf page descriptors of the table page trees
+ */
+struct libesedb_catalog_cache
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The allocated data size
+	 */
+	size_t allocated_data_size;
+
+	/* The number of table definitions
+	 */
+	uint32_t number_of_table_definitions;
+};
+
+int libesedb_catalog_cache_initialize(
+     libesedb_catalog_cache_t **catalog_cache,
+     libcerror_error_t **error );
+
+int libesedb_catalog_cache_free(
+     libesedb_catalog_cache_t **catalog_cache,
+     libcerror_error_t **error );
+
+int libesedb_catalog_cache_resize_data(
+     libesedb_catalog_cache_t *catalog_cache,
+     size_t required_data_size,
+     libcerror_error_t **error );
+
+int libesedb_catalog_cache_append_catalog_definition(
+     libesedb_catalog_cache_t *catalog_cache,
+     libesedb_catalog_definition_t *catalog_definition,
+     libcerror_error_t **error );
+
+int libesedb_catalog_cache_append_table_definition(
+     libesedb_catalog_cache_t *catalog_cache,
+     libesedb_table_definition_t *table_definition,
+     libcerror_error_t **error );
+
+int libesedb_catalog_cache_read_catalog_definition(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libesedb_catalog_definition_t **catalog_definition,
+     libcerror_error_t **error );
+
+int libesedb_catalog_cache_get_next_table_definition(
+     libesedb_catalog_cache_t *catalog_cache,
+     size_t *data_offset,
+     libesedb_table_definition_t **table_definition,
+     libcerror_error_t **error );
+
+int libesedb_catalog_cache_read_file_io_handle(
+     libesedb_catalog_cache_t *catalog_cache,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libesedb_catalog_cache_write_file_io_handle(
+     libesedb_catalog_cache_t *catalog_cache,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_CATALOG_CACHE_H ) */
+
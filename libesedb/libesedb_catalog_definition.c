@@ -48,6 +48,13 @@
 #endif
 #endif
 
+#define LIBESEDB_CATALOG_DEFINITION_FOLD_CASE( character ) \
+	if( ( ( character ) >= (uint8_t) 'A' ) \
+	 && ( ( character ) <= (uint8_t) 'Z' ) ) \
+	{ \
+		character += 0x20; \
+	}
+
 /* Creates a catalog definition
  * Make sure the value catalog_definition is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -173,6 +180,71 @@ int libesedb_catalog_definition_free(
 	return( 1 );
 }
 
+/* Reads the type of a catalog definition without reading the rest of the catalog definition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_definition_read_type(
+     const uint8_t *data,
+     size_t data_size,
+     uint16_t *type,
+     libcerror_error_t **error )
+{
+	const uint8_t *fixed_size_data_type_value_data = NULL;
+	static char *function                          = "libesedb_catalog_definition_read_type";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < ( sizeof( esedb_data_definition_header_t ) + 6 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: data too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type.",
+		 function );
+
+		return( -1 );
+	}
+	fixed_size_data_type_value_data = &( data[ sizeof( esedb_data_definition_header_t ) ] );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (esedb_data_definition_t *) fixed_size_data_type_value_data )->type,
+	 *type );
+
+	return( 1 );
+}
+
 /* Reads the catalog definition
  * Returns 1 if successful or -1 on error
  */
@@ -429,6 +501,12 @@ int libesedb_catalog_definition_read_data(
 	 ( (esedb_data_definition_t *) fixed_size_data_type_value_data )->space_usage,
 	 catalog_definition->size );
 
+	if( last_fixed_size_data_type >= 6 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_data_definition_t *) fixed_size_data_type_value_data )->flags,
+		 catalog_definition->flags );
+	}
 	if( catalog_definition->type == LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN )
 	{
 		byte_stream_copy_to_uint32_little_endian(
@@ -494,10 +572,6 @@ int libesedb_catalog_definition_read_data(
 		 data_type_number++,
 		 catalog_definition->size );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_data_definition_t *) fixed_size_data_type_value_data )->flags,
-		 value_32bit );
-
 		if( last_fixed_size_data_type >= 6 )
 		{
 			if( catalog_definition->type == LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN )
@@ -506,9 +580,9 @@ int libesedb_catalog_definition_read_data(
 				 "%s: (%03" PRIu16 ") flags\t\t\t\t\t: 0x%08" PRIx32 "\n",
 				 function,
 				 data_type_number++,
-				 value_32bit );
+				 catalog_definition->flags );
 				libesedb_debug_print_column_group_of_bits(
-				 value_32bit );
+				 catalog_definition->flags );
 				libcnotify_printf(
 				 "\n" );
 			}
@@ -518,9 +592,9 @@ int libesedb_catalog_definition_read_data(
 				 "%s: (%03" PRIu16 ") flags\t\t\t\t\t: 0x%08" PRIx32 "\n",
 				 function,
 				 data_type_number++,
-				 value_32bit );
+				 catalog_definition->flags );
 				libesedb_debug_print_index_group_of_bits(
-				 value_32bit );
+				 catalog_definition->flags );
 				libcnotify_printf(
 				 "\n" );
 			}
@@ -530,7 +604,7 @@ int libesedb_catalog_definition_read_data(
 				 "%s: (%03" PRIu16 ") flags\t\t\t\t\t: 0x%08" PRIx32 "\n",
 				 function,
 				 data_type_number++,
-				 value_32bit );
+				 catalog_definition->flags );
 			}
 		}
 		if( last_fixed_size_data_type >= 7 )
@@ -1713,15 +1787,20 @@ int libesedb_catalog_definition_get_utf16_template_name(
 }
 
 /* Compares the name of the table definition with a name
+ * If use_case_folding is set upper case ASCII characters are folded to lower case
  * Returns 1 if equal, 0 if not or -1 on error
  */
 int libesedb_catalog_definition_compare_name(
      libesedb_catalog_definition_t *catalog_definition,
      const uint8_t *name,
      size_t name_size,
+     uint8_t use_case_folding,
      libcerror_error_t **error )
 {
 	static char *function = "libesedb_catalog_definition_compare_name";
+	size_t name_index     = 0;
+	uint8_t character1    = 0;
+	uint8_t character2    = 0;
 
 	if( catalog_definition == NULL )
 	{
@@ -1768,30 +1847,59 @@ int libesedb_catalog_definition_compare_name(
 
 		return( -1 );
 	}
-	if( name_size == catalog_definition->name_size )
+	if( name_size != catalog_definition->name_size )
+	{
+		return( 0 );
+	}
+	if( use_case_folding == 0 )
 	{
 		if( memory_compare(
 		     catalog_definition->name,
 		     name,
-		     name_size ) == 0 )
+		     name_size ) != 0 )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
+	for( name_index = 0;
+	     name_index < name_size;
+	     name_index++ )
+	{
+		character1 = catalog_definition->name[ name_index ];
+		character2 = name[ name_index ];
+
+		LIBESEDB_CATALOG_DEFINITION_FOLD_CASE(
+		 character1 )
+
+		LIBESEDB_CATALOG_DEFINITION_FOLD_CASE(
+		 character2 )
+
+		if( character1 != character2 )
 		{
-			return( 1 );
+			return( 0 );
 		}
 	}
-	return( 0 );
+	return( 1 );
 }
 
 /* Compares the name of the table definition with an UTF-8 encoded string
+ * If use_case_folding is set upper case ASCII characters are folded to lower case
  * Returns LIBUNA_COMPARE_LESS, LIBUNA_COMPARE_EQUAL, LIBUNA_COMPARE_GREATER if successful or -1 on error
  */
 int libesedb_catalog_definition_compare_name_with_utf8_string(
      libesedb_catalog_definition_t *catalog_definition,
      const uint8_t *utf8_string,
      size_t utf8_string_length,
+     uint8_t use_case_folding,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_catalog_definition_compare_name_with_utf8_string";
-	int result            = 0;
+	libuna_unicode_character_t name_character   = 0;
+	libuna_unicode_character_t string_character = 0;
+	static char *function                       = "libesedb_catalog_definition_compare_name_with_utf8_string";
+	size_t name_index                           = 0;
+	size_t utf8_string_index                    = 0;
+	int result                                  = 0;
 
 	if( catalog_definition == NULL )
 	{
@@ -1815,6 +1923,96 @@ int libesedb_catalog_definition_compare_name_with_utf8_string(
 
 		return( -1 );
 	}
+	if( use_case_folding != 0 )
+	{
+		if( utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( utf8_string_length > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid UTF-8 string length value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		/* The end of the name or string, or an end-of-string character, is compared as 0
+		 */
+		do
+		{
+			name_character   = 0;
+			string_character = 0;
+
+			if( name_index < catalog_definition->name_size )
+			{
+/* TODO use ascii codepage */
+				if( libuna_unicode_character_copy_from_byte_stream(
+				     &name_character,
+				     catalog_definition->name,
+				     catalog_definition->name_size,
+				     &name_index,
+				     LIBUNA_CODEPAGE_WINDOWS_1252,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy catalog definition name to Unicode character.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			if( utf8_string_index < utf8_string_length )
+			{
+				if( libuna_unicode_character_copy_from_utf8(
+				     &string_character,
+				     utf8_string,
+				     utf8_string_length,
+				     &utf8_string_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy UTF-8 string to Unicode character.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			LIBESEDB_CATALOG_DEFINITION_FOLD_CASE(
+			 name_character )
+
+			LIBESEDB_CATALOG_DEFINITION_FOLD_CASE(
+			 string_character )
+
+			if( string_character < name_character )
+			{
+				return( LIBUNA_COMPARE_LESS );
+			}
+			else if( string_character > name_character )
+			{
+				return( LIBUNA_COMPARE_GREATER );
+			}
+		}
+		while( name_character != 0 );
+
+		return( LIBUNA_COMPARE_EQUAL );
+	}
 /* TODO use ascii codepage */
 	result = libuna_utf8_string_compare_with_byte_stream(
 		  utf8_string,
@@ -1839,16 +2037,22 @@ int libesedb_catalog_definition_compare_name_with_utf8_string(
 }
 
 /* Compares the name of the table definition with an UTF-16 encoded string
+ * If use_case_folding is set upper case ASCII characters are folded to lower case
  * Returns LIBUNA_COMPARE_LESS, LIBUNA_COMPARE_EQUAL, LIBUNA_COMPARE_GREATER if successful or -1 on error
  */
 int libesedb_catalog_definition_compare_name_with_utf16_string(
      libesedb_catalog_definition_t *catalog_definition,
      const uint16_t *utf16_string,
      size_t utf16_string_length,
+     uint8_t use_case_folding,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_catalog_definition_compare_name_with_utf16_string";
-	int result            = 0;
+	libuna_unicode_character_t name_character   = 0;
+	libuna_unicode_character_t string_character = 0;
+	static char *function                       = "libesedb_catalog_definition_compare_name_with_utf16_string";
+	size_t name_index                           = 0;
+	size_t utf16_string_index                   = 0;
+	int result                                  = 0;
 
 	if( catalog_definition == NULL )
 	{
@@ -1872,6 +2076,96 @@ int libesedb_catalog_definition_compare_name_with_utf16_string(
 
 		return( -1 );
 	}
+	if( use_case_folding != 0 )
+	{
+		if( utf16_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( utf16_string_length > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid UTF-16 string length value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		/* The end of the name or string, or an end-of-string character, is compared as 0
+		 */
+		do
+		{
+			name_character   = 0;
+			string_character = 0;
+
+			if( name_index < catalog_definition->name_size )
+			{
+/* TODO use ascii codepage */
+				if( libuna_unicode_character_copy_from_byte_stream(
+				     &name_character,
+				     catalog_definition->name,
+				     catalog_definition->name_size,
+				     &name_index,
+				     LIBUNA_CODEPAGE_WINDOWS_1252,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy catalog definition name to Unicode character.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			if( utf16_string_index < utf16_string_length )
+			{
+				if( libuna_unicode_character_copy_from_utf16(
+				     &string_character,
+				     utf16_string,
+				     utf16_string_length,
+				     &utf16_string_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy UTF-16 string to Unicode character.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			LIBESEDB_CATALOG_DEFINITION_FOLD_CASE(
+			 name_character )
+
+			LIBESEDB_CATALOG_DEFINITION_FOLD_CASE(
+			 string_character )
+
+			if( string_character < name_character )
+			{
+				return( LIBUNA_COMPARE_LESS );
+			}
+			else if( string_character > name_character )
+			{
+				return( LIBUNA_COMPARE_GREATER );
+			}
+		}
+		while( name_character != 0 );
+
+		return( LIBUNA_COMPARE_EQUAL );
+	}
 /* TODO use ascii codepage */
 	result = libuna_utf16_string_compare_with_byte_stream(
 		  utf16_string,
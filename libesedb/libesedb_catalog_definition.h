@@ -62,6 +62,10 @@ struct libesedb_catalog_definition
 	 */
 	uint32_t size;
 
+	/* The flags
+	 */
+	uint32_t flags;
+
 	/* The codepage
 	 */
 	uint32_t codepage;
@@ -109,6 +113,12 @@ int libesedb_catalog_definition_free(
      libesedb_catalog_definition_t **catalog_definition,
      libcerror_error_t **error );
 
+int libesedb_catalog_definition_read_type(
+     const uint8_t *data,
+     size_t data_size,
+     uint16_t *type,
+     libcerror_error_t **error );
+
 int libesedb_catalog_definition_read_data(
      libesedb_catalog_definition_t *catalog_definition,
      const uint8_t *data,
@@ -182,18 +192,21 @@ int libesedb_catalog_definition_compare_name(
      libesedb_catalog_definition_t *catalog_definition,
      const uint8_t *name,
      size_t name_size,
+     uint8_t use_case_folding,
      libcerror_error_t **error );
 
 int libesedb_catalog_definition_compare_name_with_utf8_string(
      libesedb_catalog_definition_t *catalog_definition,
      const uint8_t *utf8_string,
      size_t utf8_string_length,
+     uint8_t use_case_folding,
      libcerror_error_t **error );
 
 int libesedb_catalog_definition_compare_name_with_utf16_string(
      libesedb_catalog_definition_t *catalog_definition,
      const uint16_t *utf16_string,
      size_t utf16_string_length,
+     uint8_t use_case_folding,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
@@ -30,6 +30,20 @@
 #include "libesedb_libfwnt.h"
 #include "libesedb_libuna.h"
 
+#if defined( LIBESEDB_COMPRESSION_HAVE_X86_KERNELS ) && defined( __GNUC__ )
+#include <immintrin.h>
+
+#elif defined( LIBESEDB_COMPRESSION_HAVE_X86_KERNELS ) && defined( _MSC_VER )
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+/* The number of compressed bytes unpacked at a time when decompressing
+ * directly into a string, this is a multiple of 7
+ */
+#define LIBESEDB_COMPRESSION_7BIT_UNPACK_READ_SIZE	224
+#define LIBESEDB_COMPRESSION_7BIT_UNPACK_BUFFER_SIZE	256
+
 /* Retrieves the uncompressed size of the 7-bit compressed data
  * Returns 1 on success or -1 on error
  */
@@ -85,7 +99,7 @@ int libesedb_compression_7bit_decompress_get_size(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
+	if( LIBESEDB_COMPRESSION_IS_7BIT_COMPRESSED( compressed_data[ 0 ] ) == 0 )
 	{
 		libcerror_error_set(
 		 error,
@@ -102,6 +116,384 @@ int libesedb_compression_7bit_decompress_get_size(
 	return( 1 );
 }
 
+#if defined( LIBESEDB_COMPRESSION_HAVE_X86_KERNELS )
+
+/* Shuffle mask that places the 2 bytes containing each 7-bit value of
+ * 2 groups of 7 compressed bytes into a 16-bit lane
+ */
+#define LIBESEDB_COMPRESSION_7BIT_SHUFFLE_MASK_GROUP1 \
+	0x00, 0x01, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, \
+	0x03, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x80
+
+#define LIBESEDB_COMPRESSION_7BIT_SHUFFLE_MASK_GROUP2 \
+	0x07, 0x08, 0x07, 0x08, 0x08, 0x09, 0x09, 0x0a, \
+	0x0a, 0x0b, 0x0b, 0x0c, 0x0c, 0x0d, 0x0d, 0x80
+
+/* Multipliers that shift each 16-bit lane left so that its 7-bit value
+ * starts at bit 8
+ */
+#define LIBESEDB_COMPRESSION_7BIT_SHIFT_MULTIPLIERS \
+	256, 2, 4, 8, 16, 32, 64, 128
+
+/* Unpacks groups of 7 compressed bytes into 8 uncompressed bytes using SSSE3
+ * 14 compressed bytes are unpacked per iteration and 16 compressed bytes must be readable,
+ * the readable data size can exceed the compressed data size
+ * Returns the number of compressed bytes consumed
+ */
+#if defined( __GNUC__ )
+__attribute__((target("ssse3")))
+#endif
+static size_t libesedb_compression_7bit_unpack_ssse3(
+               const uint8_t *compressed_data,
+               size_t compressed_data_size,
+               size_t readable_data_size,
+               uint8_t *uncompressed_data )
+{
+	__m128i group1_values         = _mm_setzero_si128();
+	__m128i group2_values         = _mm_setzero_si128();
+	__m128i input_values          = _mm_setzero_si128();
+	size_t compressed_data_offset = 0;
+
+	const __m128i group1_shuffle_mask = _mm_setr_epi8(
+	                                     LIBESEDB_COMPRESSION_7BIT_SHUFFLE_MASK_GROUP1 );
+	const __m128i group2_shuffle_mask = _mm_setr_epi8(
+	                                     LIBESEDB_COMPRESSION_7BIT_SHUFFLE_MASK_GROUP2 );
+	const __m128i shift_multipliers   = _mm_setr_epi16(
+	                                     LIBESEDB_COMPRESSION_7BIT_SHIFT_MULTIPLIERS );
+	const __m128i value_mask          = _mm_set1_epi16(
+	                                     0x007f );
+
+	while( ( ( compressed_data_size - compressed_data_offset ) >= 14 )
+	    && ( ( readable_data_size - compressed_data_offset ) >= 16 ) )
+	{
+		input_values = _mm_loadu_si128(
+		                (const __m128i *) &( compressed_data[ compressed_data_offset ] ) );
+
+		group1_values = _mm_shuffle_epi8(
+		                 input_values,
+		                 group1_shuffle_mask );
+		group2_values = _mm_shuffle_epi8(
+		                 input_values,
+		                 group2_shuffle_mask );
+
+		group1_values = _mm_and_si128(
+		                 _mm_srli_epi16(
+		                  _mm_mullo_epi16(
+		                   group1_values,
+		                   shift_multipliers ),
+		                  8 ),
+		                 value_mask );
+		group2_values = _mm_and_si128(
+		                 _mm_srli_epi16(
+		                  _mm_mullo_epi16(
+		                   group2_values,
+		                   shift_multipliers ),
+		                  8 ),
+		                 value_mask );
+
+		_mm_storeu_si128(
+		 (__m128i *) uncompressed_data,
+		 _mm_packus_epi16(
+		  group1_values,
+		  group2_values ) );
+
+		compressed_data_offset += 14;
+		uncompressed_data      += 16;
+	}
+	return( compressed_data_offset );
+}
+
+/* Unpacks groups of 7 compressed bytes into 8 uncompressed bytes using AVX2
+ * 28 compressed bytes are unpacked per iteration and 30 compressed bytes must be readable,
+ * the readable data size can exceed the compressed data size
+ * Returns the number of compressed bytes consumed
+ */
+#if defined( __GNUC__ )
+__attribute__((target("avx2")))
+#endif
+static size_t libesedb_compression_7bit_unpack_avx2(
+               const uint8_t *compressed_data,
+               size_t compressed_data_size,
+               size_t readable_data_size,
+               uint8_t *uncompressed_data )
+{
+	__m256i group1_values         = _mm256_setzero_si256();
+	__m256i group2_values         = _mm256_setzero_si256();
+	__m256i input_values          = _mm256_setzero_si256();
+	size_t compressed_data_offset = 0;
+
+	const __m256i group1_shuffle_mask = _mm256_setr_epi8(
+	                                     LIBESEDB_COMPRESSION_7BIT_SHUFFLE_MASK_GROUP1,
+	                                     LIBESEDB_COMPRESSION_7BIT_SHUFFLE_MASK_GROUP1 );
+	const __m256i group2_shuffle_mask = _mm256_setr_epi8(
+	                                     LIBESEDB_COMPRESSION_7BIT_SHUFFLE_MASK_GROUP2,
+	                                     LIBESEDB_COMPRESSION_7BIT_SHUFFLE_MASK_GROUP2 );
+	const __m256i shift_multipliers   = _mm256_setr_epi16(
+	                                     LIBESEDB_COMPRESSION_7BIT_SHIFT_MULTIPLIERS,
+	                                     LIBESEDB_COMPRESSION_7BIT_SHIFT_MULTIPLIERS );
+	const __m256i value_mask          = _mm256_set1_epi16(
+	                                     0x007f );
+
+	while( ( ( compressed_data_size - compressed_data_offset ) >= 28 )
+	    && ( ( readable_data_size - compressed_data_offset ) >= 30 ) )
+	{
+		/* The shuffle operates per 128-bit lane hence the lower lane
+		 * contains compressed bytes 0 - 13 and the upper lane 14 - 27
+		 */
+		input_values = _mm256_inserti128_si256(
+		                _mm256_castsi128_si256(
+		                 _mm_loadu_si128(
+		                  (const __m128i *) &( compressed_data[ compressed_data_offset ] ) ) ),
+		                _mm_loadu_si128(
+		                 (const __m128i *) &( compressed_data[ compressed_data_offset + 14 ] ) ),
+		                1 );
+
+		group1_values = _mm256_shuffle_epi8(
+		                 input_values,
+		                 group1_shuffle_mask );
+		group2_values = _mm256_shuffle_epi8(
+		                 input_values,
+		                 group2_shuffle_mask );
+
+		group1_values = _mm256_and_si256(
+		                 _mm256_srli_epi16(
+		                  _mm256_mullo_epi16(
+		                   group1_values,
+		                   shift_multipliers ),
+		                  8 ),
+		                 value_mask );
+		group2_values = _mm256_and_si256(
+		                 _mm256_srli_epi16(
+		                  _mm256_mullo_epi16(
+		                   group2_values,
+		                   shift_multipliers ),
+		                  8 ),
+		                 value_mask );
+
+		/* The pack also operates per 128-bit lane which keeps the groups in order
+		 */
+		_mm256_storeu_si256(
+		 (__m256i *) uncompressed_data,
+		 _mm256_packus_epi16(
+		  group1_values,
+		  group2_values ) );
+
+		compressed_data_offset += 28;
+		uncompressed_data      += 32;
+	}
+	return( compressed_data_offset );
+}
+
+#endif /* defined( LIBESEDB_COMPRESSION_HAVE_X86_KERNELS ) */
+
+/* Unpacks 7-bit compressed data, without the leading byte, using a specific kernel
+ * The uncompressed data must be large enough to contain ( compressed data size * 8 ) / 7 bytes
+ * Returns the number of uncompressed bytes
+ */
+static size_t libesedb_compression_7bit_unpack(
+               const uint8_t *compressed_data,
+               size_t compressed_data_size,
+               size_t readable_data_size,
+               uint8_t *uncompressed_data,
+               int kernel,
+               uint16_t *remainder )
+{
+	size_t compressed_data_index   = 0;
+	size_t uncompressed_data_index = 0;
+	uint16_t value_16bit           = 0;
+	uint8_t bit_index              = 0;
+
+#if defined( LIBESEDB_COMPRESSION_HAVE_X86_KERNELS )
+	size_t unpacked_data_size      = 0;
+
+	/* Every 7 compressed bytes contain exactly 8 uncompressed bytes hence the vectorized
+	 * kernels unpack groups of 7 bytes and leave the remaining bytes to the scalar loop
+	 */
+	if( kernel == LIBESEDB_COMPRESSION_7BIT_KERNEL_AVX2 )
+	{
+		unpacked_data_size = libesedb_compression_7bit_unpack_avx2(
+		                      compressed_data,
+		                      compressed_data_size,
+		                      readable_data_size,
+		                      uncompressed_data );
+
+		compressed_data_index   += unpacked_data_size;
+		uncompressed_data_index += ( unpacked_data_size / 7 ) * 8;
+	}
+	if( ( kernel == LIBESEDB_COMPRESSION_7BIT_KERNEL_SSSE3 )
+	 || ( kernel == LIBESEDB_COMPRESSION_7BIT_KERNEL_AVX2 ) )
+	{
+		unpacked_data_size = libesedb_compression_7bit_unpack_ssse3(
+		                      &( compressed_data[ compressed_data_index ] ),
+		                      compressed_data_size - compressed_data_index,
+		                      readable_data_size - compressed_data_index,
+		                      &( uncompressed_data[ uncompressed_data_index ] ) );
+
+		compressed_data_index   += unpacked_data_size;
+		uncompressed_data_index += ( unpacked_data_size / 7 ) * 8;
+	}
+#endif /* defined( LIBESEDB_COMPRESSION_HAVE_X86_KERNELS ) */
+
+	while( compressed_data_index < compressed_data_size )
+	{
+		value_16bit |= (uint16_t) compressed_data[ compressed_data_index ] << bit_index;
+
+		uncompressed_data[ uncompressed_data_index++ ] = (uint8_t) ( value_16bit & 0x7f );
+
+		value_16bit >>= 7;
+
+		bit_index++;
+
+		if( bit_index == 7 )
+		{
+			uncompressed_data[ uncompressed_data_index++ ] = (uint8_t) ( value_16bit & 0x7f );
+
+			value_16bit >>= 7;
+
+			bit_index = 0;
+		}
+		compressed_data_index++;
+	}
+	*remainder = value_16bit;
+
+	return( uncompressed_data_index );
+}
+
+/* Determines if a 7-bit decompression kernel is supported by the CPU
+ * Returns 1 if supported, 0 if not or -1 on error
+ */
+int libesedb_compression_7bit_kernel_is_supported(
+     int kernel,
+     libcerror_error_t **error )
+{
+#if defined( LIBESEDB_COMPRESSION_HAVE_X86_KERNELS ) && defined( _MSC_VER )
+	int cpu_information[ 4 ];
+
+	int maximum_function  = 0;
+#endif
+	static char *function = "libesedb_compression_7bit_kernel_is_supported";
+	int result            = 0;
+
+	switch( kernel )
+	{
+		case LIBESEDB_COMPRESSION_7BIT_KERNEL_SCALAR:
+			result = 1;
+			break;
+
+#if defined( LIBESEDB_COMPRESSION_HAVE_X86_KERNELS ) && defined( __GNUC__ )
+		case LIBESEDB_COMPRESSION_7BIT_KERNEL_SSSE3:
+			__builtin_cpu_init();
+
+			result = ( __builtin_cpu_supports( "ssse3" ) != 0 );
+			break;
+
+		case LIBESEDB_COMPRESSION_7BIT_KERNEL_AVX2:
+			__builtin_cpu_init();
+
+			result = ( __builtin_cpu_supports( "avx2" ) != 0 );
+			break;
+
+#elif defined( LIBESEDB_COMPRESSION_HAVE_X86_KERNELS ) && defined( _MSC_VER )
+		case LIBESEDB_COMPRESSION_7BIT_KERNEL_SSSE3:
+			__cpuid(
+			 cpu_information,
+			 1 );
+
+			/* CPUID.1:ECX.SSSE3[bit 9]
+			 */
+			result = ( ( cpu_information[ 2 ] & 0x00000200UL ) != 0 );
+			break;
+
+		case LIBESEDB_COMPRESSION_7BIT_KERNEL_AVX2:
+			__cpuid(
+			 cpu_information,
+			 0 );
+
+			maximum_function = cpu_information[ 0 ];
+
+			if( maximum_function < 7 )
+			{
+				break;
+			}
+			__cpuid(
+			 cpu_information,
+			 1 );
+
+			/* CPUID.1:ECX.OSXSAVE[bit 27] and CPUID.1:ECX.AVX[bit 28]
+			 */
+			if( ( cpu_information[ 2 ] & 0x18000000UL ) != 0x18000000UL )
+			{
+				break;
+			}
+			/* The operating system must preserve the XMM and YMM state
+			 */
+			if( ( _xgetbv( 0 ) & 0x06 ) != 0x06 )
+			{
+				break;
+			}
+			__cpuidex(
+			 cpu_information,
+			 7,
+			 0 );
+
+			/* CPUID.(EAX=07H, ECX=0H):EBX.AVX2[bit 5]
+			 */
+			result = ( ( cpu_information[ 1 ] & 0x00000020UL ) != 0 );
+			break;
+
+#else
+		case LIBESEDB_COMPRESSION_7BIT_KERNEL_SSSE3:
+		case LIBESEDB_COMPRESSION_7BIT_KERNEL_AVX2:
+			break;
+
+#endif
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported kernel: %d.",
+			 function,
+			 kernel );
+
+			return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the fastest 7-bit decompression kernel supported by the CPU
+ * Returns the kernel
+ */
+int libesedb_compression_7bit_get_kernel(
+     void )
+{
+	/* The CPU features do not change at run-time, concurrent callers
+	 * will determine and store the same value
+	 */
+	static int kernel = -1;
+
+	if( kernel == -1 )
+	{
+		if( libesedb_compression_7bit_kernel_is_supported(
+		     LIBESEDB_COMPRESSION_7BIT_KERNEL_AVX2,
+		     NULL ) == 1 )
+		{
+			kernel = LIBESEDB_COMPRESSION_7BIT_KERNEL_AVX2;
+		}
+		else if( libesedb_compression_7bit_kernel_is_supported(
+		          LIBESEDB_COMPRESSION_7BIT_KERNEL_SSSE3,
+		          NULL ) == 1 )
+		{
+			kernel = LIBESEDB_COMPRESSION_7BIT_KERNEL_SSSE3;
+		}
+		else
+		{
+			kernel = LIBESEDB_COMPRESSION_7BIT_KERNEL_SCALAR;
+		}
+	}
+	return( kernel );
+}
+
 /* Decompresses 7-bit compressed data
  * Returns 1 on success or -1 on error
  */
@@ -112,11 +504,42 @@ int libesedb_compression_7bit_decompress(
      size_t uncompressed_data_size,
      libcerror_error_t **error )
 {
-	static char *function          = "libesedb_compression_7bit_decompress";
-	size_t compressed_data_index   = 0;
-	size_t uncompressed_data_index = 0;
-	uint16_t value_16bit           = 0;
-	uint8_t bit_index              = 0;
+	static char *function = "libesedb_compression_7bit_decompress";
+
+	if( libesedb_compression_7bit_decompress_with_kernel(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     libesedb_compression_7bit_get_kernel(),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decompresses 7-bit compressed data using a specific kernel
+ * The kernel must be supported by the CPU
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_7bit_decompress_with_kernel(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int kernel,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_compression_7bit_decompress_with_kernel";
+	uint16_t value_16bit  = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -184,7 +607,7 @@ int libesedb_compression_7bit_decompress(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
+	if( LIBESEDB_COMPRESSION_IS_7BIT_COMPRESSED( compressed_data[ 0 ] ) == 0 )
 	{
 		libcerror_error_set(
 		 error,
@@ -196,27 +619,28 @@ int libesedb_compression_7bit_decompress(
 
 		return( -1 );
 	}
-	for( compressed_data_index = 1;
-	     compressed_data_index < compressed_data_size;
-	     compressed_data_index++ )
+	if( ( kernel != LIBESEDB_COMPRESSION_7BIT_KERNEL_SCALAR )
+	 && ( kernel != LIBESEDB_COMPRESSION_7BIT_KERNEL_SSSE3 )
+	 && ( kernel != LIBESEDB_COMPRESSION_7BIT_KERNEL_AVX2 ) )
 	{
-		value_16bit |= (uint16_t) compressed_data[ compressed_data_index ] << bit_index;
-
-		uncompressed_data[ uncompressed_data_index++ ] = (uint8_t) ( value_16bit & 0x7f );
-
-		value_16bit >>= 7;
-
-		bit_index++;
-
-		if( bit_index == 7 )
-		{
-			uncompressed_data[ uncompressed_data_index++ ] = (uint8_t) ( value_16bit & 0x7f );
-
-			value_16bit >>= 7;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported kernel: %d.",
+		 function,
+		 kernel );
 
-			bit_index = 0;
-		}
+		return( -1 );
 	}
+	libesedb_compression_7bit_unpack(
+	 &( compressed_data[ 1 ] ),
+	 compressed_data_size - 1,
+	 compressed_data_size - 1,
+	 uncompressed_data,
+	 kernel,
+	 &value_16bit );
+
 	if( value_16bit != 0 )
 	{
 		libcerror_error_set(
@@ -232,16 +656,33 @@ int libesedb_compression_7bit_decompress(
 	return( 1 );
 }
 
-/* Retrieves the uncompressed size of LZXPRESS compressed data
+/* Decompresses 7-bit compressed data directly into an UTF-8 string
+ * If the UTF-8 string is NULL only the required UTF-8 string size is determined
+ * The UTF-8 string index is set to the size of the UTF-8 string including the end-of-string character
  * Returns 1 on success or -1 on error
  */
-int libesedb_compression_lzxpress_decompress_get_size(
+int libesedb_compression_7bit_decompress_to_utf8_string(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
-     size_t *uncompressed_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_compression_lzxpress_decompress_get_size";
+	uint8_t uncompressed_data[ LIBESEDB_COMPRESSION_7BIT_UNPACK_BUFFER_SIZE ];
+
+	static char *function          = "libesedb_compression_7bit_decompress_to_utf8_string";
+	size_t character_size          = 0;
+	size_t compressed_data_index   = 0;
+	size_t read_size               = 0;
+	size_t safe_utf8_string_index  = 0;
+	size_t uncompressed_data_index = 0;
+	size_t uncompressed_data_size  = 0;
+	uint32_t unicode_character     = 0;
+	uint16_t remainder             = 0;
+	uint8_t is_utf16_stream        = 0;
+	uint8_t remainder_bit_count    = 0;
+	int kernel                     = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -265,7 +706,7 @@ int libesedb_compression_lzxpress_decompress_get_size(
 
 		return( -1 );
 	}
-	if( compressed_data_size < 3 )
+	if( compressed_data_size < 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -276,18 +717,29 @@ int libesedb_compression_lzxpress_decompress_get_size(
 
 		return( -1 );
 	}
-	if( uncompressed_data_size == NULL )
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data size.",
+		 "%s: invalid UTF-8 string index.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] != 0x18 )
+	if( LIBESEDB_COMPRESSION_IS_7BIT_COMPRESSED( compressed_data[ 0 ] ) == 0 )
 	{
 		libcerror_error_set(
 		 error,
@@ -299,24 +751,182 @@ int libesedb_compression_lzxpress_decompress_get_size(
 
 		return( -1 );
 	}
-	byte_stream_copy_to_uint16_little_endian(
-	 &( compressed_data[ 1 ] ),
-	 *uncompressed_data_size );
+	uncompressed_data_size = ( ( compressed_data_size - 1 ) * 8 ) / 7;
+
+	if( uncompressed_data_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The unused upper bits of the last compressed byte must be 0
+	 */
+	remainder_bit_count = (uint8_t) ( ( compressed_data_size - 1 ) % 7 );
+
+	if( remainder_bit_count != 0 )
+	{
+		remainder = compressed_data[ compressed_data_size - 1 ] >> ( 8 - remainder_bit_count );
+
+		if( remainder != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported remainder: 0x%02" PRIx16 ".",
+			 function,
+			 remainder );
+
+			return( -1 );
+		}
+	}
+	/* 7-bit compressed Unicode strings are stored as UTF-16 little-endian
+	 */
+	if( ( ( uncompressed_data_size % 2 ) == 0 )
+	 && ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) )
+	{
+		is_utf16_stream = 1;
+	}
+	kernel = libesedb_compression_7bit_get_kernel();
+
+	compressed_data_index = 1;
+
+	while( compressed_data_index < compressed_data_size )
+	{
+		read_size = compressed_data_size - compressed_data_index;
+
+		if( read_size > LIBESEDB_COMPRESSION_7BIT_UNPACK_READ_SIZE )
+		{
+			read_size = LIBESEDB_COMPRESSION_7BIT_UNPACK_READ_SIZE;
+		}
+		uncompressed_data_size = libesedb_compression_7bit_unpack(
+		                          &( compressed_data[ compressed_data_index ] ),
+		                          read_size,
+		                          compressed_data_size - compressed_data_index,
+		                          uncompressed_data,
+		                          kernel,
+		                          &remainder );
+
+		compressed_data_index += read_size;
+
+		for( uncompressed_data_index = 0;
+		     uncompressed_data_index < uncompressed_data_size;
+		     uncompressed_data_index++ )
+		{
+			unicode_character = uncompressed_data[ uncompressed_data_index ];
+
+			if( is_utf16_stream != 0 )
+			{
+				uncompressed_data_index++;
+
+				unicode_character |= (uint32_t) uncompressed_data[ uncompressed_data_index ] << 8;
+			}
+			if( unicode_character == 0 )
+			{
+				break;
+			}
+			/* The 7-bit compressed characters cannot contain surrogates
+			 * hence every character is encoded in 1 to 3 bytes
+			 */
+			if( unicode_character < 0x00000080UL )
+			{
+				character_size = 1;
+			}
+			else if( unicode_character < 0x00000800UL )
+			{
+				character_size = 2;
+			}
+			else
+			{
+				character_size = 3;
+			}
+			if( utf8_string != NULL )
+			{
+				if( character_size > ( utf8_string_size - safe_utf8_string_index ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: UTF-8 string too small.",
+					 function );
+
+					return( -1 );
+				}
+				if( character_size == 1 )
+				{
+					utf8_string[ safe_utf8_string_index ] = (uint8_t) unicode_character;
+				}
+				else if( character_size == 2 )
+				{
+					utf8_string[ safe_utf8_string_index ]     = (uint8_t) ( 0xc0 | ( unicode_character >> 6 ) );
+					utf8_string[ safe_utf8_string_index + 1 ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+				}
+				else
+				{
+					utf8_string[ safe_utf8_string_index ]     = (uint8_t) ( 0xe0 | ( unicode_character >> 12 ) );
+					utf8_string[ safe_utf8_string_index + 1 ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 6 ) & 0x3f ) );
+					utf8_string[ safe_utf8_string_index + 2 ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+				}
+			}
+			safe_utf8_string_index += character_size;
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+	}
+	if( utf8_string != NULL )
+	{
+		if( safe_utf8_string_index >= utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_string[ safe_utf8_string_index ] = 0;
+	}
+	*utf8_string_index = safe_utf8_string_index + 1;
 
 	return( 1 );
 }
 
-/* Decompresses LZXPRESS compressed data
+/* Decompresses 7-bit compressed data directly into an UTF-16 string
+ * If the UTF-16 string is NULL only the required UTF-16 string size is determined
+ * The UTF-16 string index is set to the size of the UTF-16 string including the end-of-string character
  * Returns 1 on success or -1 on error
  */
-int libesedb_compression_lzxpress_decompress(
+int libesedb_compression_7bit_decompress_to_utf16_string(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
-     uint8_t *uncompressed_data,
-     size_t uncompressed_data_size,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_compression_lzxpress_decompress";
+	uint8_t uncompressed_data[ LIBESEDB_COMPRESSION_7BIT_UNPACK_BUFFER_SIZE ];
+
+	static char *function          = "libesedb_compression_7bit_decompress_to_utf16_string";
+	size_t compressed_data_index   = 0;
+	size_t read_size               = 0;
+	size_t safe_utf16_string_index = 0;
+	size_t uncompressed_data_index = 0;
+	size_t uncompressed_data_size  = 0;
+	uint32_t unicode_character     = 0;
+	uint16_t remainder             = 0;
+	uint8_t is_utf16_stream        = 0;
+	uint8_t remainder_bit_count    = 0;
+	int kernel                     = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -329,22 +939,299 @@ int libesedb_compression_lzxpress_decompress(
 
 		return( -1 );
 	}
-	if( compressed_data_size < 3 )
+	if( compressed_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: compressed data size value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] != 0x18 )
+	if( compressed_data_size < 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( LIBESEDB_COMPRESSION_IS_7BIT_COMPRESSED( compressed_data[ 0 ] ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported leading byte: 0x%02" PRIx8 ".",
+		 function,
+		 compressed_data[ 0 ] );
+
+		return( -1 );
+	}
+	uncompressed_data_size = ( ( compressed_data_size - 1 ) * 8 ) / 7;
+
+	if( uncompressed_data_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The unused upper bits of the last compressed byte must be 0
+	 */
+	remainder_bit_count = (uint8_t) ( ( compressed_data_size - 1 ) % 7 );
+
+	if( remainder_bit_count != 0 )
+	{
+		remainder = compressed_data[ compressed_data_size - 1 ] >> ( 8 - remainder_bit_count );
+
+		if( remainder != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported remainder: 0x%02" PRIx16 ".",
+			 function,
+			 remainder );
+
+			return( -1 );
+		}
+	}
+	/* 7-bit compressed Unicode strings are stored as UTF-16 little-endian
+	 */
+	if( ( ( uncompressed_data_size % 2 ) == 0 )
+	 && ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) )
+	{
+		is_utf16_stream = 1;
+	}
+	kernel = libesedb_compression_7bit_get_kernel();
+
+	compressed_data_index = 1;
+
+	while( compressed_data_index < compressed_data_size )
+	{
+		read_size = compressed_data_size - compressed_data_index;
+
+		if( read_size > LIBESEDB_COMPRESSION_7BIT_UNPACK_READ_SIZE )
+		{
+			read_size = LIBESEDB_COMPRESSION_7BIT_UNPACK_READ_SIZE;
+		}
+		uncompressed_data_size = libesedb_compression_7bit_unpack(
+		                          &( compressed_data[ compressed_data_index ] ),
+		                          read_size,
+		                          compressed_data_size - compressed_data_index,
+		                          uncompressed_data,
+		                          kernel,
+		                          &remainder );
+
+		compressed_data_index += read_size;
+
+		for( uncompressed_data_index = 0;
+		     uncompressed_data_index < uncompressed_data_size;
+		     uncompressed_data_index++ )
+		{
+			unicode_character = uncompressed_data[ uncompressed_data_index ];
+
+			if( is_utf16_stream != 0 )
+			{
+				uncompressed_data_index++;
+
+				unicode_character |= (uint32_t) uncompressed_data[ uncompressed_data_index ] << 8;
+			}
+			if( unicode_character == 0 )
+			{
+				break;
+			}
+			/* The 7-bit compressed characters cannot contain surrogates
+			 * hence every character is encoded in a single UTF-16 value
+			 */
+			if( utf16_string != NULL )
+			{
+				if( safe_utf16_string_index >= utf16_string_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: UTF-16 string too small.",
+					 function );
+
+					return( -1 );
+				}
+				utf16_string[ safe_utf16_string_index ] = (uint16_t) unicode_character;
+			}
+			safe_utf16_string_index += 1;
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+	}
+	if( utf16_string != NULL )
+	{
+		if( safe_utf16_string_index >= utf16_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-16 string too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf16_string[ safe_utf16_string_index ] = 0;
+	}
+	*utf16_string_index = safe_utf16_string_index + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the uncompressed size of LZXPRESS compressed data
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_lzxpress_decompress_get_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_compression_lzxpress_decompress_get_size";
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < 3 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data[ 0 ] != 0x18 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported leading byte: 0x%02" PRIx8 ".",
+		 function,
+		 compressed_data[ 0 ] );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( compressed_data[ 1 ] ),
+	 *uncompressed_data_size );
+
+	return( 1 );
+}
+
+/* Decompresses LZXPRESS compressed data
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_lzxpress_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_compression_lzxpress_decompress";
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < 3 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data[ 0 ] != 0x18 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
 		 "%s: unsupported leading byte: 0x%02" PRIx8 ".",
 		 function,
@@ -416,21 +1303,45 @@ int libesedb_compression_decompress_get_size(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
+	switch( compressed_data[ 0 ] )
 	{
-		result = libesedb_compression_lzxpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data_size,
-		          error );
+		case 0x18:
+			result = libesedb_compression_lzxpress_decompress_get_size(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data_size,
+			          error );
+			break;
+
+		case 0x28:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported Xpress9 compressed data.",
+			 function );
+
+			return( -1 );
+
+		/* The Xpress10 format has not been verified with data written by ESE
+		 */
+		case 0x30:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported Xpress10 compressed data.",
+			 function );
+
+			return( -1 );
+
+		default:
+			result = libesedb_compression_7bit_decompress_get_size(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data_size,
+			          error );
+			break;
 	}
 	if( result != 1 )
 	{
@@ -492,31 +1403,563 @@ int libesedb_compression_decompress(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
+	switch( compressed_data[ 0 ] )
+	{
+		case 0x18:
+			result = libesedb_compression_lzxpress_decompress(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          error );
+			break;
+
+		case 0x28:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported Xpress9 compressed data.",
+			 function );
+
+			return( -1 );
+
+		/* The Xpress10 format has not been verified with data written by ESE
+		 */
+		case 0x30:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported Xpress10 compressed data.",
+			 function );
+
+			return( -1 );
+
+		default:
+			result = libesedb_compression_7bit_decompress(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          error );
+			break;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable decompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 string size of uncompressed data
+ * The uncompressed data is an UTF-16 little-endian stream if its size is even,
+ * otherwise or if this fails, an UTF-8 stream
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_compression_get_utf8_string_size_from_uncompressed_data";
+	int result            = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_size % 2 ) == 0 )
+	{
+		result = libuna_utf8_string_size_from_utf16_stream(
+			  uncompressed_data,
+			  uncompressed_data_size,
+			  LIBUNA_ENDIAN_LITTLE,
+			  utf8_string_size,
+			  error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-8 string size of UTF-16 stream.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+	}
+	if( result != 1 )
+	{
+		result = libuna_utf8_string_size_from_utf8_stream(
+			  uncompressed_data,
+			  uncompressed_data_size,
+			  utf8_string_size,
+			  error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-8 string size of UTF-8 stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Copies uncompressed data to an UTF-8 string
+ * The uncompressed data is an UTF-16 little-endian stream if its size is even,
+ * otherwise or if this fails, an UTF-8 stream
+ * The UTF-8 string index is set to the size of the UTF-8 string including the end-of-string character
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_copy_to_utf8_string_from_uncompressed_data(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error )
+{
+	static char *function         = "libesedb_compression_copy_to_utf8_string_from_uncompressed_data";
+	size_t safe_utf8_string_index = 0;
+	int result                    = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_size % 2 ) == 0 )
+	{
+		safe_utf8_string_index = 0;
+
+		result = libuna_utf8_string_with_index_copy_from_utf16_stream(
+			  utf8_string,
+			  utf8_string_size,
+			  &safe_utf8_string_index,
+			  uncompressed_data,
+			  uncompressed_data_size,
+			  LIBUNA_ENDIAN_LITTLE,
+			  error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 stream to UTF-8 string.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+	}
+	if( result != 1 )
+	{
+		safe_utf8_string_index = 0;
+
+		result = libuna_utf8_string_with_index_copy_from_utf8_stream(
+			  utf8_string,
+			  utf8_string_size,
+			  &safe_utf8_string_index,
+			  uncompressed_data,
+			  uncompressed_data_size,
+			  error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 stream to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*utf8_string_index = safe_utf8_string_index;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 string size of compressed data
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_get_utf8_string_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t *uncompressed_data    = NULL;
+	static char *function         = "libesedb_compression_get_utf8_string_size";
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* 7-bit compressed data is decompressed directly into the string
+	 * which does not require the uncompressed data to be allocated
+	 */
+	if( LIBESEDB_COMPRESSION_IS_7BIT_COMPRESSED( compressed_data[ 0 ] ) != 0 )
+	{
+		if( libesedb_compression_7bit_decompress_to_utf8_string(
+		     compressed_data,
+		     compressed_data_size,
+		     NULL,
+		     0,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-8 string size of 7-bit compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	result = libesedb_compression_decompress_get_size(
+	          compressed_data,
+	          compressed_data_size,
+	          &uncompressed_data_size,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable retrieve uncompressed data size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( uncompressed_data_size == 0 )
+	 || ( uncompressed_data_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	uncompressed_data = (uint8_t *) memory_allocate(
+					 sizeof( uint8_t ) * uncompressed_data_size );
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	result = libesedb_compression_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable decompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	result = libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          utf8_string_size,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 string size of uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	return( 1 );
+
+on_error:
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( -1 );
+}
+
+/* Retrieves the maximum UTF-8 string size of compressed data
+ * The maximum size can be determined without decompressing the data
+ * and allows the UTF-8 string to be allocated before it is decompressed
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_get_utf8_string_maximum_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "libesedb_compression_get_utf8_string_maximum_size";
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_compression_decompress_get_size(
+	          compressed_data,
+	          compressed_data_size,
+	          &uncompressed_data_size,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable retrieve uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_size == 0 )
+	 || ( uncompressed_data_size > ( (size_t) SSIZE_MAX / 3 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( LIBESEDB_COMPRESSION_IS_7BIT_COMPRESSED( compressed_data[ 0 ] ) == 0 )
+	{
+		/* LZXPRESS compressed data can contain invalid UTF-8 or UTF-16
+		 * sequences that are replaced by a 3 byte Unicode replacement character
+		 */
+		*utf8_string_size = ( uncompressed_data_size * 3 ) + 1;
+	}
+	else if( ( ( uncompressed_data_size % 2 ) == 0 )
+	      && ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) )
 	{
-		result = libesedb_compression_lzxpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
+		*utf8_string_size = ( ( uncompressed_data_size / 2 ) * 3 ) + 1;
 	}
 	else
 	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
+		*utf8_string_size = uncompressed_data_size + 1;
 	}
-	if( result != 1 )
+	return( 1 );
+}
+
+/* Copies compressed data to an UTF-8 string
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_copy_to_utf8_string(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libesedb_compression_copy_to_utf8_string";
+	size_t utf8_string_index = 0;
+
+	if( libesedb_compression_copy_to_utf8_string_with_index(
+	     compressed_data,
+	     compressed_data_size,
+	     utf8_string,
+	     utf8_string_size,
+	     &utf8_string_index,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
-		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
-		 "%s: unable decompressed data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy compressed data to UTF-8 string.",
 		 function );
 
 		return( -1 );
@@ -524,17 +1967,21 @@ int libesedb_compression_decompress(
 	return( 1 );
 }
 
-/* Retrieves the UTF-8 string size of compressed data
+/* Copies compressed data to an UTF-8 string
+ * The UTF-8 string index is set to the size of the UTF-8 string including the end-of-string character
  * Returns 1 on success or -1 on error
  */
-int libesedb_compression_get_utf8_string_size(
+int libesedb_compression_copy_to_utf8_string_with_index(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
-     size_t *utf8_string_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
      libcerror_error_t **error )
 {
 	uint8_t *uncompressed_data    = NULL;
-	static char *function         = "libesedb_compression_get_utf8_string_size";
+	static char *function         = "libesedb_compression_copy_to_utf8_string_with_index";
+	size_t safe_utf8_string_index = 0;
 	size_t uncompressed_data_size = 0;
 	int result                    = 0;
 
@@ -571,22 +2018,58 @@ int libesedb_compression_get_utf8_string_size(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
+	if( utf8_string == NULL )
 	{
-		result = libesedb_compression_lzxpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	if( utf8_string_index == NULL )
 	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	/* 7-bit compressed data is decompressed directly into the string
+	 * which does not require the uncompressed data to be allocated
+	 */
+	if( LIBESEDB_COMPRESSION_IS_7BIT_COMPRESSED( compressed_data[ 0 ] ) != 0 )
+	{
+		if( libesedb_compression_7bit_decompress_to_utf8_string(
+		     compressed_data,
+		     compressed_data_size,
+		     utf8_string,
+		     utf8_string_size,
+		     utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy 7-bit compressed data to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
 	}
+	result = libesedb_compression_decompress_get_size(
+	          compressed_data,
+	          compressed_data_size,
+	          &uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -624,24 +2107,13 @@ int libesedb_compression_get_utf8_string_size(
 
 		goto on_error;
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_lzxpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
+	result = libesedb_compression_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -653,17 +2125,86 @@ int libesedb_compression_get_utf8_string_size(
 
 		goto on_error;
 	}
-	result = 0;
+	result = libesedb_compression_copy_to_utf8_string_from_uncompressed_data(
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          utf8_string,
+	          utf8_string_size,
+	          &safe_utf8_string_index,
+	          error );
 
-	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
+	if( result != 1 )
 	{
-		result = libuna_utf8_string_size_from_utf16_stream(
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy uncompressed data to UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	*utf8_string_index = safe_utf8_string_index;
+
+	return( 1 );
+
+on_error:
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( -1 );
+}
+
+/* Retrieves the UTF-16 string size of uncompressed data
+ * The uncompressed data is an UTF-16 little-endian stream if its size is even,
+ * otherwise or if this fails, an UTF-8 stream
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_compression_get_utf16_string_size_from_uncompressed_data";
+	int result            = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_size % 2 ) == 0 )
+	{
+		result = libuna_utf16_string_size_from_utf16_stream(
 			  uncompressed_data,
 			  uncompressed_data_size,
 			  LIBUNA_ENDIAN_LITTLE,
-			  utf8_string_size,
+			  utf16_string_size,
 			  error );
 
 		if( result != 1 )
@@ -672,7 +2213,7 @@ int libesedb_compression_get_utf8_string_size(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine UTF-8 string size of UTF-16 stream.",
+			 "%s: unable to determine UTF-16 string size of UTF-16 stream.",
 			 function );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -689,10 +2230,10 @@ int libesedb_compression_get_utf8_string_size(
 	}
 	if( result != 1 )
 	{
-		result = libuna_utf8_string_size_from_utf8_stream(
+		result = libuna_utf16_string_size_from_utf8_stream(
 			  uncompressed_data,
 			  uncompressed_data_size,
-			  utf8_string_size,
+			  utf16_string_size,
 			  error );
 
 		if( result != 1 )
@@ -701,40 +2242,140 @@ int libesedb_compression_get_utf8_string_size(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine UTF-8 string size of UTF-8 stream.",
+			 "%s: unable to determine UTF-16 string size of UTF-8 stream.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	memory_free(
-	 uncompressed_data );
+	return( 1 );
+}
 
-	uncompressed_data = NULL;
+/* Copies uncompressed data to an UTF-16 string
+ * The uncompressed data is an UTF-16 little-endian stream if its size is even,
+ * otherwise or if this fails, an UTF-8 stream
+ * The UTF-16 string index is set to the size of the UTF-16 string including the end-of-string character
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_copy_to_utf16_string_from_uncompressed_data(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     libcerror_error_t **error )
+{
+	static char *function          = "libesedb_compression_copy_to_utf16_string_from_uncompressed_data";
+	size_t safe_utf16_string_index = 0;
+	int result                     = 0;
 
-	return( 1 );
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
 
-on_error:
-	if( uncompressed_data != NULL )
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
 	{
-		memory_free(
-		 uncompressed_data );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	if( utf16_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_size % 2 ) == 0 )
+	{
+		safe_utf16_string_index = 0;
+
+		result = libuna_utf16_string_with_index_copy_from_utf16_stream(
+			  utf16_string,
+			  utf16_string_size,
+			  &safe_utf16_string_index,
+			  uncompressed_data,
+			  uncompressed_data_size,
+			  LIBUNA_ENDIAN_LITTLE,
+			  error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 stream to UTF-16 string.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+	}
+	if( result != 1 )
+	{
+		safe_utf16_string_index = 0;
+
+		result = libuna_utf16_string_with_index_copy_from_utf8_stream(
+			  utf16_string,
+			  utf16_string_size,
+			  &safe_utf16_string_index,
+			  uncompressed_data,
+			  uncompressed_data_size,
+			  error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 stream to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*utf16_string_index = safe_utf16_string_index;
+
+	return( 1 );
 }
 
-/* Copies compressed data to an UTF-8 string
+/* Retrieves the UTF-16 string size of compressed data
  * Returns 1 on success or -1 on error
  */
-int libesedb_compression_copy_to_utf8_string(
+int libesedb_compression_get_utf16_string_size(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
+     size_t *utf16_string_size,
      libcerror_error_t **error )
 {
 	uint8_t *uncompressed_data    = NULL;
-	static char *function         = "libesedb_compression_copy_to_utf8_string";
+	static char *function         = "libesedb_compression_get_utf16_string_size";
 	size_t uncompressed_data_size = 0;
 	int result                    = 0;
 
@@ -771,22 +2412,36 @@ int libesedb_compression_copy_to_utf8_string(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_lzxpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+	/* 7-bit compressed data is decompressed directly into the string
+	 * which does not require the uncompressed data to be allocated
+	 */
+	if( LIBESEDB_COMPRESSION_IS_7BIT_COMPRESSED( compressed_data[ 0 ] ) != 0 )
+	{
+		if( libesedb_compression_7bit_decompress_to_utf16_string(
+		     compressed_data,
+		     compressed_data_size,
+		     NULL,
+		     0,
+		     utf16_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-16 string size of 7-bit compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
 	}
+	result = libesedb_compression_decompress_get_size(
+	          compressed_data,
+	          compressed_data_size,
+	          &uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -821,27 +2476,16 @@ int libesedb_compression_copy_to_utf8_string(
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
 		 "%s: unable to create uncompressed data.",
 		 function );
-
-		goto on_error;
-	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_lzxpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
+
+		goto on_error;
 	}
+	result = libesedb_compression_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -853,61 +2497,22 @@ int libesedb_compression_copy_to_utf8_string(
 
 		goto on_error;
 	}
-	result = 0;
-
-	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
-	{
-		result = libuna_utf8_string_copy_from_utf16_stream(
-			  utf8_string,
-			  utf8_string_size,
-			  uncompressed_data,
-			  uncompressed_data_size,
-			  LIBUNA_ENDIAN_LITTLE,
-			  error );
-
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy UTF-16 stream to UTF-8 string.",
-			 function );
+	result = libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          utf16_string_size,
+	          error );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-#endif
-			libcerror_error_free(
-			 error );
-		}
-	}
 	if( result != 1 )
 	{
-		result = libuna_utf8_string_copy_from_utf8_stream(
-			  utf8_string,
-			  utf8_string_size,
-			  uncompressed_data,
-			  uncompressed_data_size,
-			  error );
-
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy UTF-8 stream to UTF-8 string.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-16 string size of uncompressed data.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
 	memory_free(
 	 uncompressed_data );
@@ -925,17 +2530,17 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the UTF-16 string size of compressed data
+/* Retrieves the maximum UTF-16 string size of compressed data
+ * The maximum size can be determined without decompressing the data
  * Returns 1 on success or -1 on error
  */
-int libesedb_compression_get_utf16_string_size(
+int libesedb_compression_get_utf16_string_maximum_size(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      size_t *utf16_string_size,
      libcerror_error_t **error )
 {
-	uint8_t *uncompressed_data    = NULL;
-	static char *function         = "libesedb_compression_get_utf16_string_size";
+	static char *function         = "libesedb_compression_get_utf16_string_maximum_size";
 	size_t uncompressed_data_size = 0;
 	int result                    = 0;
 
@@ -972,22 +2577,23 @@ int libesedb_compression_get_utf16_string_size(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_lzxpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
-	}
-	else
+	if( utf16_string_size == NULL )
 	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string size.",
+		 function );
+
+		return( -1 );
 	}
+	result = libesedb_compression_decompress_get_size(
+	          compressed_data,
+	          compressed_data_size,
+	          &uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -997,10 +2603,10 @@ int libesedb_compression_get_utf16_string_size(
 		 "%s: unable retrieve uncompressed data size.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( ( uncompressed_data_size == 0 )
-	 || ( uncompressed_data_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	 || ( uncompressed_data_size >= (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -1009,135 +2615,77 @@ int libesedb_compression_get_utf16_string_size(
 		 "%s: invalid uncompressed data size value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	uncompressed_data = (uint8_t *) memory_allocate(
-					 sizeof( uint8_t ) * uncompressed_data_size );
-
-	if( uncompressed_data == NULL )
+	if( LIBESEDB_COMPRESSION_IS_7BIT_COMPRESSED( compressed_data[ 0 ] ) == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create uncompressed data.",
-		 function );
-
-		goto on_error;
+		/* LZXPRESS compressed data can contain invalid UTF-8 or UTF-16 sequences
+		 * that are replaced by a single Unicode replacement character
+		 */
+		*utf16_string_size = uncompressed_data_size + 1;
 	}
-	if( compressed_data[ 0 ] == 0x18 )
+	else if( ( ( uncompressed_data_size % 2 ) == 0 )
+	      && ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) )
 	{
-		result = libesedb_compression_lzxpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
+		*utf16_string_size = ( uncompressed_data_size / 2 ) + 1;
 	}
 	else
 	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
+		*utf16_string_size = uncompressed_data_size + 1;
 	}
-	if( result != 1 )
+	return( 1 );
+}
+
+/* Copies compressed data to an UTF-16 string
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_copy_to_utf16_string(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libesedb_compression_copy_to_utf16_string";
+	size_t utf16_string_index = 0;
+
+	if( libesedb_compression_copy_to_utf16_string_with_index(
+	     compressed_data,
+	     compressed_data_size,
+	     utf16_string,
+	     utf16_string_size,
+	     &utf16_string_index,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
-		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
-		 "%s: unable decompressed data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy compressed data to UTF-16 string.",
 		 function );
 
-		goto on_error;
-	}
-	result = 0;
-
-	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
-	{
-		result = libuna_utf16_string_size_from_utf16_stream(
-			  uncompressed_data,
-			  uncompressed_data_size,
-			  LIBUNA_ENDIAN_LITTLE,
-			  utf16_string_size,
-			  error );
-
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine UTF-16 string size of UTF-16 stream.",
-			 function );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-#endif
-			libcerror_error_free(
-			 error );
-		}
-	}
-	if( result != 1 )
-	{
-		result = libuna_utf16_string_size_from_utf8_stream(
-			  uncompressed_data,
-			  uncompressed_data_size,
-			  utf16_string_size,
-			  error );
-
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine UTF-16 string size of UTF-8 stream.",
-			 function );
-
-			goto on_error;
-		}
+		return( -1 );
 	}
-	memory_free(
-	 uncompressed_data );
-
-	uncompressed_data = NULL;
-
 	return( 1 );
-
-on_error:
-	if( uncompressed_data != NULL )
-	{
-		memory_free(
-		 uncompressed_data );
-	}
-	return( -1 );
 }
 
 /* Copies compressed data to an UTF-16 string
+ * The UTF-16 string index is set to the size of the UTF-16 string including the end-of-string character
  * Returns 1 on success or -1 on error
  */
-int libesedb_compression_copy_to_utf16_string(
+int libesedb_compression_copy_to_utf16_string_with_index(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      uint16_t *utf16_string,
      size_t utf16_string_size,
+     size_t *utf16_string_index,
      libcerror_error_t **error )
 {
-	uint8_t *uncompressed_data    = NULL;
-	static char *function         = "libesedb_compression_copy_to_utf16_string";
-	size_t uncompressed_data_size = 0;
-	int result                    = 0;
+	uint8_t *uncompressed_data     = NULL;
+	static char *function          = "libesedb_compression_copy_to_utf16_string_with_index";
+	size_t safe_utf16_string_index = 0;
+	size_t uncompressed_data_size  = 0;
+	int result                     = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -1172,22 +2720,58 @@ int libesedb_compression_copy_to_utf16_string(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
+	if( utf16_string == NULL )
 	{
-		result = libesedb_compression_lzxpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	if( utf16_string_index == NULL )
 	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string index.",
+		 function );
+
+		return( -1 );
+	}
+	/* 7-bit compressed data is decompressed directly into the string
+	 * which does not require the uncompressed data to be allocated
+	 */
+	if( LIBESEDB_COMPRESSION_IS_7BIT_COMPRESSED( compressed_data[ 0 ] ) != 0 )
+	{
+		if( libesedb_compression_7bit_decompress_to_utf16_string(
+		     compressed_data,
+		     compressed_data_size,
+		     utf16_string,
+		     utf16_string_size,
+		     utf16_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy 7-bit compressed data to UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
 	}
+	result = libesedb_compression_decompress_get_size(
+	          compressed_data,
+	          compressed_data_size,
+	          &uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -1225,24 +2809,13 @@ int libesedb_compression_copy_to_utf16_string(
 
 		goto on_error;
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_lzxpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
+	result = libesedb_compression_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -1254,67 +2827,32 @@ int libesedb_compression_copy_to_utf16_string(
 
 		goto on_error;
 	}
-	result = 0;
-
-	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
-	{
-		result = libuna_utf16_string_copy_from_utf16_stream(
-			  utf16_string,
-			  utf16_string_size,
-			  uncompressed_data,
-			  uncompressed_data_size,
-			  LIBUNA_ENDIAN_LITTLE,
-			  error );
-
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy UTF-16 stream to UTF-16 string.",
-			 function );
+	result = libesedb_compression_copy_to_utf16_string_from_uncompressed_data(
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          utf16_string,
+	          utf16_string_size,
+	          &safe_utf16_string_index,
+	          error );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-#endif
-			libcerror_error_free(
-			 error );
-		}
-	}
 	if( result != 1 )
 	{
-		result = libuna_utf16_string_copy_from_utf8_stream(
-			  utf16_string,
-			  utf16_string_size,
-			  uncompressed_data,
-			  uncompressed_data_size,
-			  error );
-
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy UTF-16 stream to UTF-8 string.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy uncompressed data to UTF-16 string.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
 	memory_free(
 	 uncompressed_data );
 
 	uncompressed_data = NULL;
 
+	*utf16_string_index = safe_utf16_string_index;
+
 	return( 1 );
 
 on_error:
@@ -25,18 +25,62 @@
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_definitions.h"
 #include "libesedb_libcerror.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The vectorized 7-bit decompression kernels require x86 intrinsics
+ * and a compiler that supports run-time CPU feature detection
+ */
+#if ( defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 9 ) ) ) ) || defined( __clang__ )
+#if defined( __x86_64__ ) || defined( __i386__ )
+#define LIBESEDB_COMPRESSION_HAVE_X86_KERNELS
+#endif
+
+#elif defined( _MSC_VER ) && ( _MSC_VER >= 1800 )
+#if defined( _M_X64 ) || defined( _M_IX86 )
+#define LIBESEDB_COMPRESSION_HAVE_X86_KERNELS
+#endif
+
+#endif
+
+/* The upper 5 bits of the leading byte of compressed data contain the compression scheme
+ * 0x08 and 0x10 are 7-bit, 0x18 LZXPRESS, 0x28 Xpress9 and 0x30 Xpress10 compressed data
+ */
+#define LIBESEDB_COMPRESSION_IS_7BIT_COMPRESSED( leading_byte ) \
+	( ( ( leading_byte ) != 0x18 ) && ( ( leading_byte ) != 0x28 ) && ( ( leading_byte ) != 0x30 ) )
+
+/* Long value data segments are not 7-bit compressed, hence uncompressed data
+ * can start with any byte. Only columns that are defined as compressed
+ * contain Xpress10 compressed data segments, which are reported as unsupported
+ */
+#define LIBESEDB_COMPRESSION_IS_LONG_VALUE_COMPRESSED( leading_byte, column_flags ) \
+	( ( ( leading_byte ) == 0x18 ) \
+	 || ( ( ( leading_byte ) == 0x30 ) && ( ( ( column_flags ) & LIBESEDB_COLUMN_FLAG_IS_COMPRESSED ) != 0 ) ) )
+
+enum LIBESEDB_COMPRESSION_7BIT_KERNELS
+{
+	LIBESEDB_COMPRESSION_7BIT_KERNEL_SCALAR		= 0,
+	LIBESEDB_COMPRESSION_7BIT_KERNEL_SSSE3		= 1,
+	LIBESEDB_COMPRESSION_7BIT_KERNEL_AVX2		= 2
+};
+
 int libesedb_compression_7bit_decompress_get_size(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      size_t *uncompressed_data_size,
      libcerror_error_t **error );
 
+int libesedb_compression_7bit_kernel_is_supported(
+     int kernel,
+     libcerror_error_t **error );
+
+int libesedb_compression_7bit_get_kernel(
+     void );
+
 int libesedb_compression_7bit_decompress(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -44,6 +88,30 @@ int libesedb_compression_7bit_decompress(
      size_t uncompressed_data_size,
      libcerror_error_t **error );
 
+int libesedb_compression_7bit_decompress_with_kernel(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int kernel,
+     libcerror_error_t **error );
+
+int libesedb_compression_7bit_decompress_to_utf8_string(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error );
+
+int libesedb_compression_7bit_decompress_to_utf16_string(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     libcerror_error_t **error );
+
 int libesedb_compression_lzxpress_decompress_get_size(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -70,12 +138,32 @@ int libesedb_compression_decompress(
      size_t uncompressed_data_size,
      libcerror_error_t **error );
 
+int libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libesedb_compression_copy_to_utf8_string_from_uncompressed_data(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error );
+
 int libesedb_compression_get_utf8_string_size(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      size_t *utf8_string_size,
      libcerror_error_t **error );
 
+int libesedb_compression_get_utf8_string_maximum_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 int libesedb_compression_copy_to_utf8_string(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -83,12 +171,40 @@ int libesedb_compression_copy_to_utf8_string(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+int libesedb_compression_copy_to_utf8_string_with_index(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error );
+
+int libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+int libesedb_compression_copy_to_utf16_string_from_uncompressed_data(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     libcerror_error_t **error );
+
 int libesedb_compression_get_utf16_string_size(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      size_t *utf16_string_size,
      libcerror_error_t **error );
 
+int libesedb_compression_get_utf16_string_maximum_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
 int libesedb_compression_copy_to_utf16_string(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -96,6 +212,14 @@ int libesedb_compression_copy_to_utf16_string(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+int libesedb_compression_copy_to_utf16_string_with_index(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -20,12 +20,14 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <system_string.h>
 #include <types.h>
 
 #include "libesedb_catalog_definition.h"
 #include "libesedb_column_type.h"
+#include "libesedb_compression.h"
 #include "libesedb_data_definition.h"
 #include "libesedb_debug.h"
 #include "libesedb_definitions.h"
@@ -38,6 +40,7 @@
 #include "libesedb_libfdata.h"
 #include "libesedb_libfvalue.h"
 #include "libesedb_page.h"
+#include "libesedb_page_store.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_value_data_handle.h"
 
@@ -146,6 +149,85 @@ int libesedb_data_definition_free(
 	return( 1 );
 }
 
+/* Clones a data definition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_data_definition_clone(
+     libesedb_data_definition_t **destination_data_definition,
+     libesedb_data_definition_t *source_data_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_data_definition_clone";
+
+	if( destination_data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_data_definition != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination data definition value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_data_definition == NULL )
+	{
+		*destination_data_definition = NULL;
+
+		return( 1 );
+	}
+	*destination_data_definition = memory_allocate_structure(
+	                                libesedb_data_definition_t );
+
+	if( *destination_data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination data definition.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     *destination_data_definition,
+	     source_data_definition,
+	     sizeof( libesedb_data_definition_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination data definition.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_data_definition != NULL )
+	{
+		memory_free(
+		 *destination_data_definition );
+
+		*destination_data_definition = NULL;
+	}
+	return( -1 );
+}
+
 /* Reads the data
  * Returns 1 if successful or -1 on error
  */
@@ -162,7 +244,6 @@ int libesedb_data_definition_read_data(
 	libesedb_page_t *page             = NULL;
 	libesedb_page_value_t *page_value = NULL;
 	static char *function             = "libesedb_data_definition_read_data";
-	off64_t element_data_offset       = 0;
 	uint16_t data_offset              = 0;
 
 	if( data_definition == NULL )
@@ -209,14 +290,12 @@ int libesedb_data_definition_read_data(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
-	     pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) pages_cache,
+	if( libesedb_page_store_get_page_at_offset(
+	     io_handle,
+	     file_io_handle,
+	     pages_cache,
 	     data_definition->page_offset,
-	     &element_data_offset,
-	     (intptr_t **) &page,
-	     0,
+	     &page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -326,7 +405,6 @@ int libesedb_data_definition_read_record(
 	static char *function                                    = "libesedb_data_definition_read_record";
 	size_t record_data_size                                  = 0;
 	size_t remaining_definition_data_size                    = 0;
-	off64_t element_data_offset                              = 0;
 	uint16_t data_offset                                     = 0;
 	uint16_t fixed_size_data_type_value_offset               = 0;
 	uint16_t masked_previous_tagged_data_type_offset         = 0;
@@ -413,14 +491,12 @@ int libesedb_data_definition_read_record(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
-	     pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) pages_cache,
+	if( libesedb_page_store_get_page_at_offset(
+	     io_handle,
+	     file_io_handle,
+	     pages_cache,
 	     data_definition->page_offset,
-	     &element_data_offset,
-	     (intptr_t **) &page,
-	     0,
+	     &page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1573,12 +1649,569 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the column catalog definition and fixed size value offset of a specific column entry
+ * The fixed size values are stored in order of the column catalog definitions, hence
+ * the offset is the size of the data definition header and the preceding fixed size values,
+ * which are determined by the table definitions when the column catalog definitions are appended
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_data_definition_get_fixed_size_value_offset(
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     int column_entry,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     uint16_t *fixed_size_value_offset,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *safe_column_catalog_definition = NULL;
+	libesedb_table_definition_t *column_table_definition          = NULL;
+	static char *function                                         = "libesedb_data_definition_get_fixed_size_value_offset";
+	uint32_t safe_fixed_size_value_offset                         = 0;
+	int column_catalog_definition_index                           = 0;
+	int number_of_column_catalog_definitions                      = 0;
+	int number_of_template_table_column_catalog_definitions       = 0;
+
+	if( column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( fixed_size_value_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fixed size value offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_table_definition != NULL )
+	{
+		if( libesedb_table_definition_get_number_of_column_catalog_definitions(
+		     template_table_definition,
+		     &number_of_template_table_column_catalog_definitions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of columns from template table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libesedb_table_definition_get_number_of_column_catalog_definitions(
+	     table_definition,
+	     &number_of_column_catalog_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of columns from table.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_column_catalog_definitions += number_of_template_table_column_catalog_definitions;
+
+	if( ( column_entry < 0 )
+	 || ( column_entry >= number_of_column_catalog_definitions ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column entry: %d value out of bounds.",
+		 function,
+		 column_entry );
+
+		return( -1 );
+	}
+	if( column_entry < number_of_template_table_column_catalog_definitions )
+	{
+		column_catalog_definition_index = column_entry;
+		column_table_definition         = template_table_definition;
+	}
+	else
+	{
+		column_catalog_definition_index = column_entry - number_of_template_table_column_catalog_definitions;
+		column_table_definition         = table_definition;
+
+		if( template_table_definition != NULL )
+		{
+			safe_fixed_size_value_offset = template_table_definition->fixed_size_values_size;
+		}
+	}
+	if( libesedb_table_definition_get_column_catalog_definition_by_index(
+	     column_table_definition,
+	     column_catalog_definition_index,
+	     &safe_column_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column catalog definition: %d.",
+		 function,
+		 column_entry );
+
+		return( -1 );
+	}
+	if( safe_column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing column catalog definition: %d.",
+		 function,
+		 column_entry );
+
+		return( -1 );
+	}
+	if( column_table_definition->fixed_size_value_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table definition - missing fixed size value offsets.",
+		 function );
+
+		return( -1 );
+	}
+	safe_fixed_size_value_offset += column_table_definition->fixed_size_value_offsets[ column_catalog_definition_index ];
+
+	if( safe_fixed_size_value_offset > (uint32_t) ( UINT16_MAX - sizeof( esedb_data_definition_header_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid fixed size value offset value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*column_catalog_definition = safe_column_catalog_definition;
+	*fixed_size_value_offset   = (uint16_t) ( sizeof( esedb_data_definition_header_t ) + safe_fixed_size_value_offset );
+
+	return( 1 );
+}
+
+/* Retrieves the value data of a specific column from the record data
+ * The fixed size value offset is only used for fixed size columns
+ * The value data references the record data and is not decompressed
+ * Returns 1 if successful, 0 if the column value is NULL or -1 on error
+ */
+int libesedb_data_definition_get_record_value_data(
+     libesedb_io_handle_t *io_handle,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     libesedb_catalog_definition_t *column_catalog_definition,
+     uint16_t fixed_size_value_offset,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     uint8_t *value_flags,
+     libcerror_error_t **error )
+{
+	const uint8_t *tagged_data_types_data       = NULL;
+	static char *function                       = "libesedb_data_definition_get_record_value_data";
+	size_t remaining_data_size                  = 0;
+	size_t tagged_data_types_offset             = 0;
+	size_t tagged_data_type_value_offset        = 0;
+	size_t variable_size_data_type_value_offset = 0;
+	uint32_t column_identifier                  = 0;
+	uint16_t current_variable_size_data_type    = 0;
+	uint16_t next_tagged_data_type_offset       = 0;
+	uint16_t previous_size                      = 0;
+	uint16_t tagged_data_type_identifier        = 0;
+	uint16_t tagged_data_type_offset            = 0;
+	uint16_t tagged_data_type_offset_bitmask    = 0x3fff;
+	uint16_t tagged_data_type_offset_data_size  = 0;
+	uint16_t tagged_data_type_size              = 0;
+	uint16_t tagged_data_type_value_size        = 0;
+	uint16_t variable_size_data_type_size       = 0;
+	uint16_t variable_size_data_types_offset    = 0;
+	uint16_t entry_offset                       = 0;
+	uint8_t last_fixed_size_data_type           = 0;
+	uint8_t last_variable_size_data_type        = 0;
+	uint8_t has_value_flags                     = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_data_size < sizeof( esedb_data_definition_header_t ) )
+	 || ( record_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value flags.",
+		 function );
+
+		return( -1 );
+	}
+	column_identifier = column_catalog_definition->identifier;
+
+	last_fixed_size_data_type    = ( (esedb_data_definition_header_t *) record_data )->last_fixed_size_data_type;
+	last_variable_size_data_type = ( (esedb_data_definition_header_t *) record_data )->last_variable_size_data_type;
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (esedb_data_definition_header_t *) record_data )->variable_size_data_types_offset,
+	 variable_size_data_types_offset );
+
+	*value_flags = 0;
+
+	if( column_identifier <= 127 )
+	{
+		if( column_identifier > (uint32_t) last_fixed_size_data_type )
+		{
+			return( 0 );
+		}
+		if( ( column_catalog_definition->size > record_data_size )
+		 || ( (size_t) fixed_size_value_offset > ( record_data_size - column_catalog_definition->size ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid fixed size data type size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		*value_data      = &( record_data[ fixed_size_value_offset ] );
+		*value_data_size = (size_t) column_catalog_definition->size;
+
+		return( 1 );
+	}
+	variable_size_data_type_value_offset = (size_t) variable_size_data_types_offset;
+
+	if( last_variable_size_data_type > 127 )
+	{
+		variable_size_data_type_value_offset += ( last_variable_size_data_type - 127 ) * 2;
+	}
+	if( variable_size_data_type_value_offset > record_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid variable size data types offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( current_variable_size_data_type = 128;
+	     current_variable_size_data_type <= (uint16_t) last_variable_size_data_type;
+	     current_variable_size_data_type++ )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( record_data[ variable_size_data_types_offset + ( ( current_variable_size_data_type - 128 ) * 2 ) ] ),
+		 variable_size_data_type_size );
+
+		/* The MSB signifies that the variable size data type is empty
+		 */
+		if( ( variable_size_data_type_size & 0x8000 ) != 0 )
+		{
+			if( column_identifier == (uint32_t) current_variable_size_data_type )
+			{
+				return( 0 );
+			}
+			continue;
+		}
+		if( ( variable_size_data_type_size < previous_size )
+		 || ( (size_t) ( variable_size_data_type_size - previous_size ) > ( record_data_size - variable_size_data_type_value_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid variable size data type size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( column_identifier == (uint32_t) current_variable_size_data_type )
+		{
+			*value_data      = &( record_data[ variable_size_data_type_value_offset ] );
+			*value_data_size = (size_t) ( variable_size_data_type_size - previous_size );
+
+			return( 1 );
+		}
+		variable_size_data_type_value_offset += variable_size_data_type_size - previous_size;
+		previous_size                         = variable_size_data_type_size;
+	}
+	if( column_identifier <= 255 )
+	{
+		return( 0 );
+	}
+	/* The tagged data types follow the variable size data type values
+	 */
+	tagged_data_types_offset = variable_size_data_type_value_offset;
+	tagged_data_types_data   = &( record_data[ tagged_data_types_offset ] );
+	remaining_data_size      = record_data_size - tagged_data_types_offset;
+
+	if( ( io_handle->format_version == 0x620 )
+	 && ( io_handle->format_revision <= 2 ) )
+	{
+		while( remaining_data_size >= 4 )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( tagged_data_types_data[ tagged_data_type_value_offset ] ),
+			 tagged_data_type_identifier );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 &( tagged_data_types_data[ tagged_data_type_value_offset + 2 ] ),
+			 tagged_data_type_size );
+
+			tagged_data_type_value_offset += 4;
+			remaining_data_size           -= 4;
+
+			has_value_flags = 0;
+
+			if( ( tagged_data_type_size & 0x8000 ) != 0 )
+			{
+				if( ( remaining_data_size < 1 )
+				 || ( ( tagged_data_type_size & 0x5fff ) == 0 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid tagged data type size value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				has_value_flags       = 1;
+				tagged_data_type_size = ( tagged_data_type_size & 0x5fff ) - 1;
+			}
+			if( (size_t) tagged_data_type_size > ( remaining_data_size - has_value_flags ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid tagged data type size value exceeds remaining data size.",
+				 function );
+
+				return( -1 );
+			}
+			if( (uint32_t) tagged_data_type_identifier == column_identifier )
+			{
+				if( has_value_flags != 0 )
+				{
+					*value_flags = tagged_data_types_data[ tagged_data_type_value_offset ];
+				}
+				if( tagged_data_type_size == 0 )
+				{
+					return( 0 );
+				}
+				*value_data      = &( tagged_data_types_data[ tagged_data_type_value_offset + has_value_flags ] );
+				*value_data_size = (size_t) tagged_data_type_size;
+
+				return( 1 );
+			}
+			tagged_data_type_value_offset += has_value_flags + tagged_data_type_size;
+			remaining_data_size           -= has_value_flags + tagged_data_type_size;
+		}
+		return( 0 );
+	}
+	if( remaining_data_size == 0 )
+	{
+		return( 0 );
+	}
+	if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+	 && ( io_handle->page_size >= 16384 ) )
+	{
+		tagged_data_type_offset_bitmask = 0x7fff;
+	}
+	if( remaining_data_size < 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid tagged data types data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The offset of the first tagged data type is the size of the tagged data type offsets array
+	 */
+	byte_stream_copy_to_uint16_little_endian(
+	 &( tagged_data_types_data[ 2 ] ),
+	 tagged_data_type_offset );
+
+	tagged_data_type_offset_data_size = tagged_data_type_offset & 0x3fff;
+
+	if( ( tagged_data_type_offset_data_size < 4 )
+	 || ( (size_t) tagged_data_type_offset_data_size > remaining_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid tagged data type offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_offset = 0;
+	     ( entry_offset + 4 ) <= tagged_data_type_offset_data_size;
+	     entry_offset += 4 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( tagged_data_types_data[ entry_offset ] ),
+		 tagged_data_type_identifier );
+
+		/* The tagged data types are stored in order of identifier
+		 */
+		if( (uint32_t) tagged_data_type_identifier > column_identifier )
+		{
+			break;
+		}
+		if( (uint32_t) tagged_data_type_identifier != column_identifier )
+		{
+			continue;
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( tagged_data_types_data[ entry_offset + 2 ] ),
+		 tagged_data_type_offset );
+
+		if( ( entry_offset + 8 ) <= tagged_data_type_offset_data_size )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( tagged_data_types_data[ entry_offset + 6 ] ),
+			 next_tagged_data_type_offset );
+
+			next_tagged_data_type_offset &= tagged_data_type_offset_bitmask;
+		}
+		else
+		{
+			next_tagged_data_type_offset = (uint16_t) remaining_data_size;
+		}
+		if( ( (size_t) next_tagged_data_type_offset > remaining_data_size )
+		 || ( ( tagged_data_type_offset & tagged_data_type_offset_bitmask ) > next_tagged_data_type_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid tagged data type offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		tagged_data_type_value_offset = (size_t) ( tagged_data_type_offset & tagged_data_type_offset_bitmask );
+		tagged_data_type_value_size   = next_tagged_data_type_offset - (uint16_t) tagged_data_type_value_offset;
+
+		if( tagged_data_type_value_size == 0 )
+		{
+			return( 0 );
+		}
+		if( ( tagged_data_type_offset_bitmask == 0x7fff )
+		 || ( ( tagged_data_type_offset & 0x4000 ) != 0 ) )
+		{
+			*value_flags = tagged_data_types_data[ tagged_data_type_value_offset ];
+
+			tagged_data_type_value_offset += 1;
+			tagged_data_type_value_size   -= 1;
+		}
+		*value_data      = &( tagged_data_types_data[ tagged_data_type_value_offset ] );
+		*value_data_size = (size_t) tagged_data_type_value_size;
+
+		return( 1 );
+	}
+	return( 0 );
+}
+
 /* Reads the long value
  * Returns 1 if successful or -1 on error
  */
 int libesedb_data_definition_read_long_value(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
      libfdata_vector_t *pages_vector,
      libfcache_cache_t *pages_cache,
      libcerror_error_t **error )
@@ -1587,7 +2220,6 @@ int libesedb_data_definition_read_long_value(
 	libesedb_page_value_t *page_value = NULL;
 	static char *function             = "libesedb_data_definition_read_long_value";
 	size_t long_value_data_size       = 0;
-	off64_t element_data_offset       = 0;
 	uint16_t data_offset              = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -1606,14 +2238,12 @@ int libesedb_data_definition_read_long_value(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
-	     pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) pages_cache,
+	if( libesedb_page_store_get_page_at_offset(
+	     io_handle,
+	     file_io_handle,
+	     pages_cache,
 	     data_definition->page_offset,
-	     &element_data_offset,
-	     (intptr_t **) &page,
-	     0,
+	     &page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1746,6 +2376,7 @@ int libesedb_data_definition_read_long_value(
 }
 
 /* Reads the long value segment
+ * The column flags are used to determine if the segment data can be Xpress10 compressed
  * Returns 1 if successful or -1 on error
  */
 int libesedb_data_definition_read_long_value_segment(
@@ -1754,6 +2385,7 @@ int libesedb_data_definition_read_long_value_segment(
      libesedb_io_handle_t *io_handle,
      libfdata_vector_t *pages_vector,
      libfcache_cache_t *pages_cache,
+     uint32_t column_flags,
      uint32_t long_value_segment_offset,
      libfdata_list_t *data_segments_list,
      uint32_t *next_long_value_segment_offset,
@@ -1763,10 +2395,11 @@ int libesedb_data_definition_read_long_value_segment(
 	libesedb_page_value_t *page_value      = NULL;
 	static char *function                  = "libesedb_data_definition_read_long_value_segment";
 	uint8_t *long_value_segment_data       = NULL;
-	off64_t element_data_offset            = 0;
 	off64_t long_value_segment_data_offset = 0;
 	size64_t data_size                     = 0;
 	size_t long_value_segment_data_size    = 0;
+	size_t uncompressed_data_size          = 0;
+	uint32_t element_flags                 = 0;
 	uint32_t uncompressed_segment_size     = 0;
 	uint16_t data_offset                   = 0;
 	int element_index                      = 0;
@@ -1808,14 +2441,12 @@ int libesedb_data_definition_read_long_value_segment(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
-	     pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) pages_cache,
+	if( libesedb_page_store_get_page_at_offset(
+	     io_handle,
+	     file_io_handle,
+	     pages_cache,
 	     data_definition->page_offset,
-	     &element_data_offset,
-	     (intptr_t **) &page,
-	     0,
+	     &page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1943,22 +2574,37 @@ int libesedb_data_definition_read_long_value_segment(
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
 	if( ( long_value_segment_data_size > 1 )
-	 && ( long_value_segment_data[ 0 ] == 0x18 ) )
+	 && ( LIBESEDB_COMPRESSION_IS_LONG_VALUE_COMPRESSED( long_value_segment_data[ 0 ], column_flags ) != 0 ) )
 	{
-		if( long_value_segment_data_size < 3 )
+		if( libesedb_compression_decompress_get_size(
+		     long_value_segment_data,
+		     long_value_segment_data_size,
+		     &uncompressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve uncompressed long value segment data size.",
+			 function );
+
+			return( -1 );
+		}
+		if( uncompressed_data_size > (size_t) UINT32_MAX )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid long value segment data size value out of bounds.",
+			 "%s: invalid uncompressed long value segment data size value out of bounds.",
 			 function );
 
 			return( -1 );
 		}
-		byte_stream_copy_to_uint16_little_endian(
-		 &( long_value_segment_data[ 1 ] ),
-		 uncompressed_segment_size );
+		uncompressed_segment_size = (uint32_t) uncompressed_data_size;
+
+		element_flags = LIBFDATA_RANGE_FLAG_IS_COMPRESSED;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -2010,7 +2656,7 @@ int libesedb_data_definition_read_long_value_segment(
 	     0,
 	     long_value_segment_data_offset,
 	     (size64_t) long_value_segment_data_size,
-	     0,
+	     element_flags,
 	     (size64_t) uncompressed_segment_size,
 	     error ) != 1 )
 	{
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_catalog_definition.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
@@ -70,6 +71,11 @@ int libesedb_data_definition_free(
      libesedb_data_definition_t **data_definition,
      libcerror_error_t **error );
 
+int libesedb_data_definition_clone(
+     libesedb_data_definition_t **destination_data_definition,
+     libesedb_data_definition_t *source_data_definition,
+     libcerror_error_t **error );
+
 int libesedb_data_definition_read_data(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
@@ -92,9 +98,29 @@ int libesedb_data_definition_read_record(
      uint8_t *record_flags,
      libcerror_error_t **error );
 
+int libesedb_data_definition_get_fixed_size_value_offset(
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     int column_entry,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     uint16_t *fixed_size_value_offset,
+     libcerror_error_t **error );
+
+int libesedb_data_definition_get_record_value_data(
+     libesedb_io_handle_t *io_handle,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     libesedb_catalog_definition_t *column_catalog_definition,
+     uint16_t fixed_size_value_offset,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     uint8_t *value_flags,
+     libcerror_error_t **error );
+
 int libesedb_data_definition_read_long_value(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
      libfdata_vector_t *pages_vector,
      libfcache_cache_t *pages_cache,
      libcerror_error_t **error );
@@ -105,6 +131,7 @@ int libesedb_data_definition_read_long_value_segment(
      libesedb_io_handle_t *io_handle,
      libfdata_vector_t *pages_vector,
      libfcache_cache_t *pages_cache,
+     uint32_t column_flags,
      uint32_t long_value_segment_offset,
      libfdata_list_t *data_segments_list,
      uint32_t *next_long_value_segment_offset,
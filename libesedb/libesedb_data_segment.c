@@ -24,10 +24,12 @@
 #include <types.h>
 
 #include "libesedb_data_segment.h"
+#include "libesedb_data_segments_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_long_value_cache.h"
 #include "libesedb_unused.h"
 
 /* Creates a data segment
@@ -287,7 +289,7 @@ int libesedb_data_segment_get_data(
  * Returns 1 if successful or -1 on error
  */
 int libesedb_data_segment_read_element_data(
-     intptr_t *data_handle LIBESEDB_ATTRIBUTE_UNUSED,
+     libesedb_data_segments_handle_t *data_segments_handle,
      libbfio_handle_t *file_io_handle,
      libfdata_list_element_t *element,
      libfdata_cache_t *cache,
@@ -299,10 +301,12 @@ int libesedb_data_segment_read_element_data(
      libcerror_error_t **error )
 {
 	libesedb_data_segment_t *data_segment = NULL;
+	const uint8_t *cached_data            = NULL;
 	static char *function                 = "libesedb_data_segment_read_element_data";
+	size_t cached_data_size               = 0;
 	ssize_t read_count                    = 0;
+	int result                            = 0;
 
-	LIBESEDB_UNREFERENCED_PARAMETER( data_handle )
 	LIBESEDB_UNREFERENCED_PARAMETER( element_file_index )
 	LIBESEDB_UNREFERENCED_PARAMETER( element_flags )
 	LIBESEDB_UNREFERENCED_PARAMETER( read_flags )
@@ -332,48 +336,124 @@ int libesedb_data_segment_read_element_data(
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	/* The segment data is shared between long value objects by the file level long value cache
+	 */
+	if( ( data_segments_handle != NULL )
+	 && ( data_segments_handle->long_value_cache != NULL ) )
 	{
-		libcnotify_printf(
-		 "%s: reading data segment at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-		 function,
-		 element_offset,
-		 element_offset );
+		result = libesedb_long_value_cache_get_data(
+		          data_segments_handle->long_value_cache,
+		          data_segments_handle->table_identifier,
+		          data_segments_handle->long_value_key,
+		          data_segments_handle->long_value_key_size,
+		          element_offset,
+		          &cached_data,
+		          &cached_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data segment from long value cache.",
+			 function );
+
+			goto on_error;
+		}
+		else if( ( result != 0 )
+		      && ( cached_data_size == data_segment->data_size ) )
+		{
+			if( memory_copy(
+			     data_segment->data,
+			     cached_data,
+			     cached_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy cached data segment.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			result = 0;
+		}
 	}
-#endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-		      file_io_handle,
-		      data_segment->data,
-		      data_segment->data_size,
-		      element_offset,
-		      error );
-
-	if( read_count == -1 )
+	if( result == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read data segment at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 element_offset,
-		 element_offset );
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading data segment at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+			 function,
+			 element_offset,
+			 element_offset );
+		}
+#endif
+		read_count = libbfio_handle_read_buffer_at_offset(
+			      file_io_handle,
+			      data_segment->data,
+			      data_segment->data_size,
+			      element_offset,
+			      error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data segment at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 element_offset,
+			 element_offset );
 
-		goto on_error;
-	}
+			goto on_error;
+		}
 #if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: data segment:\n",
-		 function );
-		libcnotify_print_data(
-		 data_segment->data,
-		 data_segment->data_size,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-	}
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: data segment:\n",
+			 function );
+			libcnotify_print_data(
+			 data_segment->data,
+			 data_segment->data_size,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		}
 #endif
+		if( ( data_segments_handle != NULL )
+		 && ( data_segments_handle->long_value_cache != NULL )
+		 && ( data_segment->data_size > 0 ) )
+		{
+			if( libesedb_long_value_cache_set_data(
+			     data_segments_handle->long_value_cache,
+			     data_segments_handle->table_identifier,
+			     data_segments_handle->long_value_key,
+			     data_segments_handle->long_value_key_size,
+			     element_offset,
+			     data_segment->data,
+			     data_segment->data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set data segment in long value cache.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
 	if( libfdata_list_element_set_element_value(
 	     element,
 	     (intptr_t *) file_io_handle,
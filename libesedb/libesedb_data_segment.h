@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_data_segments_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfdata.h"
@@ -67,7 +68,7 @@ int libesedb_data_segment_get_data(
      libcerror_error_t **error );
 
 int libesedb_data_segment_read_element_data(
-     intptr_t *data_handle,
+     libesedb_data_segments_handle_t *data_segments_handle,
      libbfio_handle_t *file_io_handle,
      libfdata_list_element_t *element,
      libfdata_cache_t *cache,
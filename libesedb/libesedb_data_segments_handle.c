@@ -0,0 +1,181 @@
+/*
+ * Data segments handle functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_data_segments_handle.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_long_value_cache.h"
+
+/* Creates a data segments handle
+ * Make sure the value data_segments_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_data_segments_handle_initialize(
+     libesedb_data_segments_handle_t **data_segments_handle,
+     libesedb_long_value_cache_t *long_value_cache,
+     uint32_t table_identifier,
+     const uint8_t *long_value_key,
+     size_t long_value_key_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_data_segments_handle_initialize";
+
+	if( data_segments_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data segments handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_segments_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data segments handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( long_value_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value key.",
+		 function );
+
+		return( -1 );
+	}
+	if( long_value_key_size > 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid long value key size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*data_segments_handle = memory_allocate_structure(
+	                         libesedb_data_segments_handle_t );
+
+	if( *data_segments_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data segments handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *data_segments_handle,
+	     0,
+	     sizeof( libesedb_data_segments_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data segments handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( long_value_key_size > 0 )
+	{
+		if( memory_copy(
+		     ( *data_segments_handle )->long_value_key,
+		     long_value_key,
+		     long_value_key_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy long value key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *data_segments_handle )->long_value_cache    = long_value_cache;
+	( *data_segments_handle )->table_identifier    = table_identifier;
+	( *data_segments_handle )->long_value_key_size = long_value_key_size;
+
+	return( 1 );
+
+on_error:
+	if( *data_segments_handle != NULL )
+	{
+		memory_free(
+		 *data_segments_handle );
+
+		*data_segments_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a data segments handle
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_data_segments_handle_free(
+     libesedb_data_segments_handle_t **data_segments_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_data_segments_handle_free";
+
+	if( data_segments_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data segments handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_segments_handle != NULL )
+	{
+		/* The long_value_cache reference is freed elsewhere
+		 */
+		memory_free(
+		 *data_segments_handle );
+
+		*data_segments_handle = NULL;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,73 @@
+/*
+ * Data segments handle functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_DATA_SEGMENTS_HANDLE_H )
+#define _LIBESEDB_DATA_SEGMENTS_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+#include "libesedb_long_value_cache.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_data_segments_handle libesedb_data_segments_handle_t;
+
+struct libesedb_data_segments_handle
+{
+	/* The long value cache
+	 */
+	libesedb_long_value_cache_t *long_value_cache;
+
+	/* The table identifier
+	 */
+	uint32_t table_identifier;
+
+	/* The long value key
+	 */
+	uint8_t long_value_key[ 8 ];
+
+	/* The long value key size
+	 */
+	size_t long_value_key_size;
+};
+
+int libesedb_data_segments_handle_initialize(
+     libesedb_data_segments_handle_t **data_segments_handle,
+     libesedb_long_value_cache_t *long_value_cache,
+     uint32_t table_identifier,
+     const uint8_t *long_value_key,
+     size_t long_value_key_size,
+     libcerror_error_t **error );
+
+int libesedb_data_segments_handle_free(
+     libesedb_data_segments_handle_t **data_segments_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_DATA_SEGMENTS_HANDLE_H ) */
+
@@ -23,8 +23,6 @@
 #include <memory.h>
 #include <types.h>
 
-#include "libesedb_block_descriptor.h"
-#include "libesedb_block_tree.h"
 #include "libesedb_database.h"
 #include "libesedb_debug.h"
 #include "libesedb_definitions.h"
@@ -34,6 +32,7 @@
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_page.h"
+#include "libesedb_page_store.h"
 #include "libesedb_page_value.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_page_tree_value.h"
@@ -137,17 +136,16 @@ int libesedb_database_initialize(
 
 		goto on_error;
 	}
-	if( libesedb_block_tree_initialize(
-	     &( ( *database )->page_block_tree ),
-	     io_handle->file_size,
-	     io_handle->page_size,
+	if( libesedb_page_bitmap_initialize(
+	     &( ( *database )->page_bitmap ),
+	     io_handle->last_page_number,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create page block tree.",
+		 "%s: unable to create page bitmap.",
 		 function );
 
 		goto on_error;
@@ -207,16 +205,15 @@ int libesedb_database_free(
 
 			result = -1;
 		}
-		if( libesedb_block_tree_free(
-		     &( ( *database )->page_block_tree ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_block_descriptor_free,
+		if( libesedb_page_bitmap_free(
+		     &( ( *database )->page_bitmap ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free page block tree.",
+			 "%s: unable to free page bitmap.",
 			 function );
 
 			result = -1;
@@ -461,7 +458,6 @@ int libesedb_database_read_file_io_handle(
 {
 	libesedb_page_t *page        = NULL;
 	static char *function        = "libesedb_database_read_file_io_handle";
-	off64_t page_offset          = 0;
 	uint32_t leaf_page_number    = 0;
 	int current_leaf_value_index = 0;
 
@@ -515,13 +511,10 @@ int libesedb_database_read_file_io_handle(
 	}
 	while( leaf_page_number != 0 )
 	{
-		page_offset = ( leaf_page_number + 1 ) * database->page_tree->io_handle->page_size;
-
 		if( libesedb_page_tree_check_if_page_block_first_read(
 		     database->page_tree,
-		     database->page_block_tree,
+		     database->page_bitmap,
 		     leaf_page_number,
-		     page_offset,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -549,13 +542,12 @@ int libesedb_database_read_file_io_handle(
 
 			return( -1 );
 		}
-		if( libfdata_vector_get_element_value_by_index(
-		     database->page_tree->pages_vector,
-		     (intptr_t *) file_io_handle,
-		     (libfdata_cache_t *) database->page_tree->pages_cache,
-		     (int) leaf_page_number - 1,
-		     (intptr_t **) &page,
-		     0,
+		if( libesedb_page_store_get_page_by_number(
+		     database->page_tree->io_handle,
+		     file_io_handle,
+		     database->page_tree->pages_cache,
+		     leaf_page_number,
+		     &page,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -25,12 +25,12 @@
 #include <common.h>
 #include <types.h>
 
-#include "libesedb_block_tree.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_page_bitmap.h"
 #include "libesedb_page_tree.h"
 
 #if defined( __cplusplus )
@@ -45,9 +45,10 @@ struct libesedb_database
 	 */
 	libesedb_page_tree_t *page_tree;
 
-	/* The page block tree
+	/* The page bitmap
+	 * Used to detect loops in the leaf page chain
 	 */
-	libesedb_block_tree_t *page_block_tree;
+	libesedb_page_bitmap_t *page_bitmap;
 };
 
 int libesedb_database_initialize(
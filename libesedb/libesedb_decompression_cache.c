@@ -0,0 +1,371 @@
+/*
+ * Decompression cache functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_compression.h"
+#include "libesedb_decompression_cache.h"
+#include "libesedb_definitions.h"
+#include "libesedb_libcerror.h"
+
+/* Creates a decompression cache
+ * Make sure the value decompression_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_decompression_cache_initialize(
+     libesedb_decompression_cache_t **decompression_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_decompression_cache_initialize";
+	int entry_index       = 0;
+
+	if( decompression_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompression cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decompression_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decompression cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*decompression_cache = memory_allocate_structure(
+	                        libesedb_decompression_cache_t );
+
+	if( *decompression_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decompression cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *decompression_cache,
+	     0,
+	     sizeof( libesedb_decompression_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decompression cache.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < LIBESEDB_DECOMPRESSION_CACHE_NUMBER_OF_ENTRIES;
+	     entry_index++ )
+	{
+		( *decompression_cache )->entries[ entry_index ].value_entry = -1;
+	}
+	return( 1 );
+
+on_error:
+	if( *decompression_cache != NULL )
+	{
+		memory_free(
+		 *decompression_cache );
+
+		*decompression_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a decompression cache
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_decompression_cache_free(
+     libesedb_decompression_cache_t **decompression_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_decompression_cache_free";
+	int entry_index       = 0;
+
+	if( decompression_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompression cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decompression_cache != NULL )
+	{
+		for( entry_index = 0;
+		     entry_index < LIBESEDB_DECOMPRESSION_CACHE_NUMBER_OF_ENTRIES;
+		     entry_index++ )
+		{
+			if( ( *decompression_cache )->entries[ entry_index ].data != NULL )
+			{
+				memory_free(
+				 ( *decompression_cache )->entries[ entry_index ].data );
+			}
+		}
+		memory_free(
+		 *decompression_cache );
+
+		*decompression_cache = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the decompression cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_decompression_cache_get_statistics(
+     libesedb_decompression_cache_t *decompression_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_decompression_cache_get_statistics";
+
+	if( decompression_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompression cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_hits   = decompression_cache->number_of_hits;
+	*number_of_misses = decompression_cache->number_of_misses;
+
+	return( 1 );
+}
+
+/* Retrieves the decompressed data of a specific value entry
+ * The compressed data is decompressed when the value entry is not cached,
+ * this replaces the least recently added entry when the cache is full
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_decompression_cache_get_data(
+     libesedb_decompression_cache_t *decompression_cache,
+     int value_entry,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libesedb_decompression_cache_entry_t *cache_entry = NULL;
+	uint8_t *uncompressed_data                        = NULL;
+	static char *function                             = "libesedb_decompression_cache_get_data";
+	size_t uncompressed_data_size                     = 0;
+	int entry_index                                   = 0;
+
+	if( decompression_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompression cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_entry < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid value entry value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < LIBESEDB_DECOMPRESSION_CACHE_NUMBER_OF_ENTRIES;
+	     entry_index++ )
+	{
+		cache_entry = &( decompression_cache->entries[ entry_index ] );
+
+		if( cache_entry->value_entry == value_entry )
+		{
+			decompression_cache->number_of_hits += 1;
+
+			*data      = cache_entry->data;
+			*data_size = cache_entry->data_size;
+
+			return( 1 );
+		}
+	}
+	if( libesedb_compression_decompress_get_size(
+	     compressed_data,
+	     compressed_data_size,
+	     &uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable retrieve uncompressed data size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( uncompressed_data_size == 0 )
+	 || ( uncompressed_data_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * uncompressed_data_size );
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_compression_decompress(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable decompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	decompression_cache->number_of_misses += 1;
+
+	cache_entry = &( decompression_cache->entries[ decompression_cache->next_entry_index ] );
+
+	if( cache_entry->data != NULL )
+	{
+		memory_free(
+		 cache_entry->data );
+	}
+	cache_entry->value_entry = value_entry;
+	cache_entry->data        = uncompressed_data;
+	cache_entry->data_size   = uncompressed_data_size;
+
+	decompression_cache->next_entry_index += 1;
+
+	if( decompression_cache->next_entry_index >= LIBESEDB_DECOMPRESSION_CACHE_NUMBER_OF_ENTRIES )
+	{
+		decompression_cache->next_entry_index = 0;
+	}
+	*data      = cache_entry->data;
+	*data_size = cache_entry->data_size;
+
+	return( 1 );
+
+on_error:
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,101 @@
+/*
+ * Decompression cache functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_DECOMPRESSION_CACHE_H )
+#define _LIBESEDB_DECOMPRESSION_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_definitions.h"
+#include "libesedb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_decompression_cache_entry libesedb_decompression_cache_entry_t;
+
+struct libesedb_decompression_cache_entry
+{
+	/* The value entry or -1 if not set
+	 */
+	int value_entry;
+
+	/* The (decompressed) data
+	 */
+	uint8_t *data;
+
+	/* The (decompressed) data size
+	 */
+	size_t data_size;
+};
+
+typedef struct libesedb_decompression_cache libesedb_decompression_cache_t;
+
+struct libesedb_decompression_cache
+{
+	/* The entries
+	 */
+	libesedb_decompression_cache_entry_t entries[ LIBESEDB_DECOMPRESSION_CACHE_NUMBER_OF_ENTRIES ];
+
+	/* The index of the entry that is replaced next
+	 */
+	int next_entry_index;
+
+	/* The number of cache hits
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of cache misses
+	 */
+	uint64_t number_of_misses;
+};
+
+int libesedb_decompression_cache_initialize(
+     libesedb_decompression_cache_t **decompression_cache,
+     libcerror_error_t **error );
+
+int libesedb_decompression_cache_free(
+     libesedb_decompression_cache_t **decompression_cache,
+     libcerror_error_t **error );
+
+int libesedb_decompression_cache_get_statistics(
+     libesedb_decompression_cache_t *decompression_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+int libesedb_decompression_cache_get_data(
+     libesedb_decompression_cache_t *decompression_cache,
+     int value_entry,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_DECOMPRESSION_CACHE_H ) */
+
@@ -26,6 +26,7 @@
 #include <wide_string.h>
 
 #include "libesedb_catalog.h"
+#include "libesedb_catalog_cache.h"
 #include "libesedb_database.h"
 #include "libesedb_debug.h"
 #include "libesedb_definitions.h"
@@ -38,7 +39,9 @@
 #include "libesedb_libcnotify.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_long_value_cache.h"
 #include "libesedb_page.h"
+#include "libesedb_page_buffer_pool.h"
 #include "libesedb_table.h"
 #include "libesedb_table_definition.h"
 
@@ -532,6 +535,169 @@ on_error:
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+/* Opens a file from memory
+ * The page data is referenced in the buffer instead of being copied,
+ * hence the buffer must remain valid and unmodified until the file is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_open_memory(
+     libesedb_file_t *file,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle        = NULL;
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_open_memory";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBESEDB_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBESEDB_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBESEDB_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	/* The memory range file IO handle is only used to read the file header
+	 * and other data outside the pages
+	 */
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     (uint8_t *) buffer,
+	     buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->io_handle->memory_data      = buffer;
+	internal_file->io_handle->memory_data_size = buffer_size;
+
+	if( libesedb_file_open_file_io_handle(
+	     file,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file from memory.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->file_io_handle_created_in_library = 1;
+
+	return( 1 );
+
+on_error:
+	internal_file->io_handle->memory_data      = NULL;
+	internal_file->io_handle->memory_data_size = 0;
+
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Opens a file using a Basic File IO (bfio) handle
  * Returns 1 if successful or -1 on error
  */
@@ -842,12 +1008,15 @@ int libesedb_file_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	libesedb_file_header_t *file_header = NULL;
-	static char *function               = "libesedb_file_open_read";
-	size64_t file_size                  = 0;
-	off64_t file_offset                 = 0;
-	int result                          = 0;
-	int segment_index                   = 0;
+	libesedb_catalog_cache_t *catalog_cache = NULL;
+	libesedb_file_header_t *file_header     = NULL;
+	static char *function                   = "libesedb_file_open_read";
+	size64_t file_size                      = 0;
+	off64_t file_offset                     = 0;
+	int catalog_cache_result                = 0;
+	int number_of_table_definitions         = 0;
+	int result                              = 0;
+	int segment_index                       = 0;
 
 	if( internal_file == NULL )
 	{
@@ -983,6 +1152,8 @@ int libesedb_file_open_read(
 	internal_file->io_handle->page_size                = file_header->page_size;
 	internal_file->io_handle->creation_format_version  = file_header->creation_format_version;
 	internal_file->io_handle->creation_format_revision = file_header->creation_format_revision;
+	internal_file->io_handle->file_header_checksum     = file_header->checksum;
+	internal_file->io_handle->database_time            = file_header->database_time;
 
 	if( libesedb_file_header_free(
 	     &file_header,
@@ -1217,6 +1388,21 @@ int libesedb_file_open_read(
 
 		goto on_error;
 	}
+	if( libesedb_page_buffer_pool_initialize(
+	     &( internal_file->io_handle->page_buffer_pool ),
+	     (size_t) internal_file->io_handle->page_size,
+	     LIBESEDB_PAGE_BUFFER_POOL_MAXIMUM_NUMBER_OF_BUFFERS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page buffer pool.",
+		 function );
+
+		goto on_error;
+	}
 /* TODO add clone function ? */
 	if( libfdata_vector_initialize(
 	     &( internal_file->pages_vector ),
@@ -1316,6 +1502,46 @@ int libesedb_file_open_read(
 			 "Reading the catalog:\n" );
 		}
 #endif
+		if( internal_file->catalog_cache_file_io_handle != NULL )
+		{
+			if( libesedb_catalog_cache_initialize(
+			     &catalog_cache,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create catalog cache.",
+				 function );
+
+				goto on_error;
+			}
+			catalog_cache_result = libesedb_catalog_cache_read_file_io_handle(
+			                        catalog_cache,
+			                        internal_file->catalog_cache_file_io_handle,
+			                        internal_file->io_handle,
+			                        error );
+
+			/* The catalog is read from the file when the catalog cache cannot be read
+			 */
+			if( catalog_cache_result == -1 )
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					if( ( error != NULL )
+					 && ( *error != NULL ) )
+					{
+						libcnotify_print_error_backtrace(
+						 *error );
+					}
+				}
+#endif
+				libcerror_error_free(
+				 error );
+			}
+		}
 		if( libesedb_catalog_initialize(
 		     &( internal_file->catalog ),
 		     internal_file->io_handle,
@@ -1333,10 +1559,23 @@ int libesedb_file_open_read(
 
 			goto on_error;
 		}
-		if( libesedb_catalog_read_file_io_handle(
-		     internal_file->catalog,
-		     file_io_handle,
-		     error ) != 1 )
+		internal_file->catalog->read_on_demand = internal_file->read_catalog_on_demand;
+
+		if( catalog_cache_result == 1 )
+		{
+			result = libesedb_catalog_read_catalog_cache(
+			          internal_file->catalog,
+			          catalog_cache,
+			          error );
+		}
+		else
+		{
+			result = libesedb_catalog_read_file_io_handle(
+			          internal_file->catalog,
+			          file_io_handle,
+			          error );
+		}
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1344,55 +1583,193 @@ int libesedb_file_open_read(
 			 LIBCERROR_IO_ERROR_READ_FAILED,
 			 "%s: unable to read catalog.",
 			 function );
-
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "Reading the backup catalog:\n" );
 		}
-#endif
-		if( libesedb_catalog_initialize(
-		     &( internal_file->backup_catalog ),
-		     internal_file->io_handle,
-		     LIBESEDB_PAGE_NUMBER_CATALOG_BACKUP,
-		     internal_file->pages_vector,
-		     internal_file->pages_cache,
-		     error ) != 1 )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create backup catalog.",
-			 function );
+			result = libesedb_catalog_get_number_of_table_definitions(
+			          internal_file->catalog,
+			          &number_of_table_definitions,
+			          error );
 
-			goto on_error;
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of table definitions in catalog.",
+				 function );
+			}
+			/* A valid catalog contains at least the definition of the catalog table
+			 */
+			else if( number_of_table_definitions == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: invalid catalog - missing table definitions.",
+				 function );
+
+				result = -1;
+			}
 		}
-		if( libesedb_catalog_read_file_io_handle(
-		     internal_file->backup_catalog,
-		     file_io_handle,
-		     error ) != 1 )
+		if( result != 1 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read backup catalog.",
-			 function );
+			/* The backup catalog is used when the catalog cannot be read
+			 */
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
 
-			goto on_error;
+			if( libesedb_catalog_free(
+			     &( internal_file->catalog ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free catalog.",
+				 function );
+
+				goto on_error;
+			}
 		}
-/* TODO compare contents of catalogs ? */
-	}
-	internal_file->io_handle->abort = 0;
+		/* The catalog cache is written when it could not be used and the catalog was read
+		 */
+		else if( ( catalog_cache != NULL )
+		      && ( catalog_cache_result != 1 ) )
+		{
+			result = libesedb_catalog_write_catalog_cache(
+			          internal_file->catalog,
+			          file_io_handle,
+			          catalog_cache,
+			          error );
 
-	return( 1 );
+			if( result == 1 )
+			{
+				result = libesedb_catalog_cache_write_file_io_handle(
+				          catalog_cache,
+				          internal_file->catalog_cache_file_io_handle,
+				          internal_file->io_handle,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write catalog cache.",
+				 function );
 
-on_error:
-	if( internal_file->backup_catalog != NULL )
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					if( ( error != NULL )
+					 && ( *error != NULL ) )
+					{
+						libcnotify_print_error_backtrace(
+						 *error );
+					}
+				}
+#endif
+				libcerror_error_free(
+				 error );
+			}
+		}
+		if( catalog_cache != NULL )
+		{
+			if( libesedb_catalog_cache_free(
+			     &catalog_cache,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free catalog cache.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( ( internal_file->catalog == NULL )
+		 || ( internal_file->read_backup_catalog != 0 ) )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "Reading the backup catalog:\n" );
+			}
+#endif
+			if( libesedb_catalog_initialize(
+			     &( internal_file->backup_catalog ),
+			     internal_file->io_handle,
+			     LIBESEDB_PAGE_NUMBER_CATALOG_BACKUP,
+			     internal_file->pages_vector,
+			     internal_file->pages_cache,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create backup catalog.",
+				 function );
+
+				goto on_error;
+			}
+			if( internal_file->catalog == NULL )
+			{
+				internal_file->backup_catalog->read_on_demand = internal_file->read_catalog_on_demand;
+			}
+			if( libesedb_catalog_read_file_io_handle(
+			     internal_file->backup_catalog,
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read backup catalog.",
+				 function );
+
+				goto on_error;
+			}
+			if( internal_file->catalog == NULL )
+			{
+				internal_file->catalog        = internal_file->backup_catalog;
+				internal_file->backup_catalog = NULL;
+			}
+		}
+/* TODO compare contents of catalogs ? */
+	}
+	internal_file->io_handle->abort = 0;
+
+	return( 1 );
+
+on_error:
+	if( catalog_cache != NULL )
+	{
+		libesedb_catalog_cache_free(
+		 &catalog_cache,
+		 NULL );
+	}
+	if( internal_file->backup_catalog != NULL )
 	{
 		libesedb_catalog_free(
 		 &( internal_file->backup_catalog ),
@@ -1422,6 +1799,12 @@ on_error:
 		 &( internal_file->pages_vector ),
 		 NULL );
 	}
+	if( internal_file->io_handle->page_buffer_pool != NULL )
+	{
+		libesedb_page_buffer_pool_free(
+		 &( internal_file->io_handle->page_buffer_pool ),
+		 NULL );
+	}
 	if( file_header != NULL )
 	{
 		libesedb_file_header_free(
@@ -1663,6 +2046,386 @@ int libesedb_file_get_page_size(
 	return( 1 );
 }
 
+/* Retrieves the maximum size of the long value cache
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_long_value_cache_size(
+     libesedb_file_t *file,
+     size64_t *maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_long_value_cache_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_long_value_cache_get_maximum_cache_size(
+	     internal_file->io_handle->long_value_cache,
+	     maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum long value cache size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the maximum size of the long value cache
+ * The long value cache contains the long value segment data shared by all
+ * the tables of the file, a maximum size of 0 disables the cache
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_set_long_value_cache_size(
+     libesedb_file_t *file,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_long_value_cache_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_long_value_cache_set_maximum_cache_size(
+	     internal_file->io_handle->long_value_cache,
+	     maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum long value cache size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the long value cache statistics
+ * The number of hits and misses are counted since the file was created
+ * and the cache size is the size of the currently cached data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_long_value_cache_statistics(
+     libesedb_file_t *file,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     size64_t *cache_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_long_value_cache_statistics";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_long_value_cache_get_statistics(
+	     internal_file->io_handle->long_value_cache,
+	     number_of_hits,
+	     number_of_misses,
+	     cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve long value cache statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the value to indicate the catalog is read on demand
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_catalog_read_on_demand(
+     libesedb_file_t *file,
+     uint8_t *read_on_demand,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_catalog_read_on_demand";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( read_on_demand == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read on demand.",
+		 function );
+
+		return( -1 );
+	}
+	*read_on_demand = internal_file->read_catalog_on_demand;
+
+	return( 1 );
+}
+
+/* Sets the value to indicate the catalog is read on demand
+ * If set only the table definitions are read when the file is opened,
+ * the column and index definitions of a table are read when the table is first retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_set_catalog_read_on_demand(
+     libesedb_file_t *file,
+     uint8_t read_on_demand,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_catalog_read_on_demand";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->catalog != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - catalog already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_on_demand != 0 )
+	{
+		internal_file->read_catalog_on_demand = 1;
+	}
+	else
+	{
+		internal_file->read_catalog_on_demand = 0;
+	}
+	return( 1 );
+}
+
+/* Retrieves the value to indicate the backup catalog is always read
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_read_backup_catalog(
+     libesedb_file_t *file,
+     uint8_t *read_backup_catalog,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_read_backup_catalog";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( read_backup_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read backup catalog.",
+		 function );
+
+		return( -1 );
+	}
+	*read_backup_catalog = internal_file->read_backup_catalog;
+
+	return( 1 );
+}
+
+/* Sets the value to indicate the backup catalog is always read
+ * By default the backup catalog is only read when the catalog cannot be read
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_set_read_backup_catalog(
+     libesedb_file_t *file,
+     uint8_t read_backup_catalog,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_read_backup_catalog";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->catalog != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - catalog already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_backup_catalog != 0 )
+	{
+		internal_file->read_backup_catalog = 1;
+	}
+	else
+	{
+		internal_file->read_backup_catalog = 0;
+	}
+	return( 1 );
+}
+
+/* Sets the catalog cache using a Basic File IO (bfio) handle
+ * The file IO handle must be opened for reading and writing and must remain opened until the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_set_catalog_cache_file_io_handle(
+     libesedb_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_catalog_cache_file_io_handle";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->catalog != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - catalog already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->catalog_cache_file_io_handle = file_io_handle;
+
+	return( 1 );
+}
+
 /* Retrieves the number of tables
  * Returns 1 if successful or -1 on error
  */
@@ -1811,10 +2574,13 @@ int libesedb_file_get_table(
 	}
 	if( table_definition->table_catalog_definition->template_name != NULL )
 	{
+		/* Template table names are resolved case-insensitively
+		 */
 		if( libesedb_catalog_get_table_definition_by_utf8_name(
 		     internal_file->catalog,
 		     table_definition->table_catalog_definition->template_name,
 		     table_definition->table_catalog_definition->template_name_size,
+		     1,
 		     &template_table_definition,
 		     error ) != 1 )
 		{
@@ -1828,6 +2594,39 @@ int libesedb_file_get_table(
 			return( -1 );
 		}
 	}
+	if( libesedb_catalog_read_table_definition(
+	     internal_file->catalog,
+	     internal_file->file_io_handle,
+	     table_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_table_definition != NULL )
+	{
+		if( libesedb_catalog_read_table_definition(
+		     internal_file->catalog,
+		     internal_file->file_io_handle,
+		     template_table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read template table definition.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( libesedb_table_initialize(
 	     table,
 	     internal_file->file_io_handle,
@@ -1903,6 +2702,7 @@ int libesedb_file_get_table_by_utf8_name(
 	          internal_file->catalog,
 	          utf8_string,
 	          utf8_string_length,
+	          0,
 	          &table_definition,
 	          error );
 
@@ -1943,10 +2743,13 @@ int libesedb_file_get_table_by_utf8_name(
 		}
 		if( table_definition->table_catalog_definition->template_name != NULL )
 		{
+			/* Template table names are resolved case-insensitively
+			 */
 			if( libesedb_catalog_get_table_definition_by_name(
 			     internal_file->catalog,
 			     table_definition->table_catalog_definition->template_name,
 			     table_definition->table_catalog_definition->template_name_size,
+			     1,
 			     &template_table_definition,
 			     error ) != 1 )
 			{
@@ -1960,6 +2763,39 @@ int libesedb_file_get_table_by_utf8_name(
 				return( -1 );
 			}
 		}
+		if( libesedb_catalog_read_table_definition(
+		     internal_file->catalog,
+		     internal_file->file_io_handle,
+		     table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read table definition.",
+			 function );
+
+			return( -1 );
+		}
+		if( template_table_definition != NULL )
+		{
+			if( libesedb_catalog_read_table_definition(
+			     internal_file->catalog,
+			     internal_file->file_io_handle,
+			     template_table_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read template table definition.",
+				 function );
+
+				return( -1 );
+			}
+		}
 		if( libesedb_table_initialize(
 		     table,
 		     internal_file->file_io_handle,
@@ -2036,6 +2872,7 @@ int libesedb_file_get_table_by_utf16_name(
 	          internal_file->catalog,
 	          utf16_string,
 	          utf16_string_length,
+	          0,
 	          &table_definition,
 	          error );
 
@@ -2076,10 +2913,13 @@ int libesedb_file_get_table_by_utf16_name(
 		}
 		if( table_definition->table_catalog_definition->template_name != NULL )
 		{
+			/* Template table names are resolved case-insensitively
+			 */
 			if( libesedb_catalog_get_table_definition_by_name(
 			     internal_file->catalog,
 			     table_definition->table_catalog_definition->template_name,
 			     table_definition->table_catalog_definition->template_name_size,
+			     1,
 			     &template_table_definition,
 			     error ) != 1 )
 			{
@@ -2093,6 +2933,39 @@ int libesedb_file_get_table_by_utf16_name(
 				return( -1 );
 			}
 		}
+		if( libesedb_catalog_read_table_definition(
+		     internal_file->catalog,
+		     internal_file->file_io_handle,
+		     table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read table definition.",
+			 function );
+
+			return( -1 );
+		}
+		if( template_table_definition != NULL )
+		{
+			if( libesedb_catalog_read_table_definition(
+			     internal_file->catalog,
+			     internal_file->file_io_handle,
+			     template_table_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read template table definition.",
+				 function );
+
+				return( -1 );
+			}
+		}
 		if( libesedb_table_initialize(
 		     table,
 		     internal_file->file_io_handle,
@@ -77,6 +77,18 @@ struct libesedb_internal_file
 	/* The backup catalog
 	 */
 	libesedb_catalog_t *backup_catalog;
+
+	/* Value to indicate the catalog is read on demand
+	 */
+	uint8_t read_catalog_on_demand;
+
+	/* Value to indicate the backup catalog is always read
+	 */
+	uint8_t read_backup_catalog;
+
+	/* The catalog cache file IO handle
+	 */
+	libbfio_handle_t *catalog_cache_file_io_handle;
 };
 
 LIBESEDB_EXTERN \
@@ -112,6 +124,14 @@ int libesedb_file_open_wide(
 
 #endif
 
+LIBESEDB_EXTERN \
+int libesedb_file_open_memory(
+     libesedb_file_t *file,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     int access_flags,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_file_open_file_io_handle(
      libesedb_file_t *file,
@@ -155,6 +175,56 @@ int libesedb_file_get_page_size(
      uint32_t *page_size,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_file_get_long_value_cache_size(
+     libesedb_file_t *file,
+     size64_t *maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_long_value_cache_size(
+     libesedb_file_t *file,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_get_long_value_cache_statistics(
+     libesedb_file_t *file,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     size64_t *cache_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_get_catalog_read_on_demand(
+     libesedb_file_t *file,
+     uint8_t *read_on_demand,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_catalog_read_on_demand(
+     libesedb_file_t *file,
+     uint8_t read_on_demand,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_get_read_backup_catalog(
+     libesedb_file_t *file,
+     uint8_t *read_backup_catalog,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_read_backup_catalog(
+     libesedb_file_t *file,
+     uint8_t read_backup_catalog,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_catalog_cache_file_io_handle(
+     libesedb_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_file_get_number_of_tables(
      libesedb_file_t *file,
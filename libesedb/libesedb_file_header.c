@@ -227,6 +227,10 @@ int libesedb_file_header_read_data(
 	 ( (esedb_file_header_t *) data )->checksum,
 	 stored_xor32_checksum );
 
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (esedb_file_header_t *) data )->database_time,
+	 file_header->database_time );
+
 	byte_stream_copy_to_uint32_little_endian(
 	 ( (esedb_file_header_t *) data )->format_version,
 	 file_header->format_version );
@@ -720,6 +724,8 @@ int libesedb_file_header_read_data(
 
 		return( -1 );
 	}
+	file_header->checksum = stored_xor32_checksum;
+
 /* TODO add more values to internal structures */
 
 	return( 1 );
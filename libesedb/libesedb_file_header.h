@@ -36,6 +36,10 @@ typedef struct libesedb_file_header libesedb_file_header_t;
 
 struct libesedb_file_header
 {
+	/* The checksum
+	 */
+	uint32_t checksum;
+
 	/* The file type
 	 */
 	uint32_t file_type;
@@ -56,6 +60,10 @@ struct libesedb_file_header
 	 */
 	uint32_t format_version;
 
+	/* The database time
+	 */
+	uint64_t database_time;
+
 	/* The database state
 	 */
 	uint32_t database_state;
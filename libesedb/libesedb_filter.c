@@ -0,0 +1,1552 @@
+/*
+ * Record filter functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_compression.h"
+#include "libesedb_data_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_filter.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_table_definition.h"
+#include "libesedb_types.h"
+
+/* Creates a comparison filter
+ * Make sure the value filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_filter_initialize_comparison(
+     libesedb_internal_filter_t **internal_filter,
+     int column_entry,
+     int comparison_operator,
+     int value_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_filter_initialize_comparison";
+
+	if( internal_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *internal_filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_entry < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid column entry value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_type == LIBESEDB_FILTER_VALUE_TYPE_NONE )
+	{
+		if( ( comparison_operator != LIBESEDB_COMPARISON_OPERATOR_IS_NULL )
+		 && ( comparison_operator != LIBESEDB_COMPARISON_OPERATOR_IS_NOT_NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported comparison operator: %d.",
+			 function,
+			 comparison_operator );
+
+			return( -1 );
+		}
+	}
+	else if( ( comparison_operator < LIBESEDB_COMPARISON_OPERATOR_EQUAL )
+	      || ( comparison_operator > LIBESEDB_COMPARISON_OPERATOR_GREATER_EQUAL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported comparison operator: %d.",
+		 function,
+		 comparison_operator );
+
+		return( -1 );
+	}
+	*internal_filter = memory_allocate_structure(
+	                    libesedb_internal_filter_t );
+
+	if( *internal_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *internal_filter,
+	     0,
+	     sizeof( libesedb_internal_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear filter.",
+		 function );
+
+		goto on_error;
+	}
+	( *internal_filter )->filter_type         = LIBESEDB_FILTER_TYPE_COMPARISON;
+	( *internal_filter )->column_entry        = column_entry;
+	( *internal_filter )->comparison_operator = comparison_operator;
+	( *internal_filter )->value_type          = value_type;
+
+	return( 1 );
+
+on_error:
+	if( *internal_filter != NULL )
+	{
+		memory_free(
+		 *internal_filter );
+
+		*internal_filter = NULL;
+	}
+	return( -1 );
+}
+
+/* Creates a filter that compares an integer column value
+ * The integer value is compared against boolean, integer, currency and date and time (FILETIME) column values
+ * Make sure the value filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_filter_initialize_integer(
+     libesedb_filter_t **filter,
+     int column_entry,
+     int comparison_operator,
+     int64_t value,
+     libcerror_error_t **error )
+{
+	libesedb_internal_filter_t *internal_filter = NULL;
+	static char *function                       = "libesedb_filter_initialize_integer";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_filter_initialize_comparison(
+	     &internal_filter,
+	     column_entry,
+	     comparison_operator,
+	     LIBESEDB_FILTER_VALUE_TYPE_INTEGER,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create comparison filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter->integer_value = value;
+
+	*filter = (libesedb_filter_t *) internal_filter;
+
+	return( 1 );
+}
+
+/* Creates a filter that compares a floating point column value
+ * Make sure the value filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_filter_initialize_floating_point(
+     libesedb_filter_t **filter,
+     int column_entry,
+     int comparison_operator,
+     double value,
+     libcerror_error_t **error )
+{
+	libesedb_internal_filter_t *internal_filter = NULL;
+	static char *function                       = "libesedb_filter_initialize_floating_point";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_filter_initialize_comparison(
+	     &internal_filter,
+	     column_entry,
+	     comparison_operator,
+	     LIBESEDB_FILTER_VALUE_TYPE_FLOATING_POINT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create comparison filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter->floating_point_value = value;
+
+	*filter = (libesedb_filter_t *) internal_filter;
+
+	return( 1 );
+}
+
+/* Creates a filter that compares the data of a column value
+ * The data is compared byte-wise as it is stored in the record, text values
+ * are therefore compared in their stored codepage or UTF-16 little-endian representation
+ * Make sure the value filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_filter_initialize_binary_data(
+     libesedb_filter_t **filter,
+     int column_entry,
+     int comparison_operator,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_filter_t *internal_filter = NULL;
+	static char *function                       = "libesedb_filter_initialize_binary_data";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_filter_initialize_comparison(
+	     &internal_filter,
+	     column_entry,
+	     comparison_operator,
+	     LIBESEDB_FILTER_VALUE_TYPE_BINARY_DATA,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create comparison filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( data_size > 0 )
+	{
+		internal_filter->value_data = (uint8_t *) memory_allocate(
+		                                           sizeof( uint8_t ) * data_size );
+
+		if( internal_filter->value_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     internal_filter->value_data,
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value data.",
+			 function );
+
+			goto on_error;
+		}
+		internal_filter->value_data_size = data_size;
+	}
+	*filter = (libesedb_filter_t *) internal_filter;
+
+	return( 1 );
+
+on_error:
+	if( internal_filter != NULL )
+	{
+		if( internal_filter->value_data != NULL )
+		{
+			memory_free(
+			 internal_filter->value_data );
+		}
+		memory_free(
+		 internal_filter );
+	}
+	return( -1 );
+}
+
+/* Creates a filter that tests if a column value is NULL or not
+ * Make sure the value filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_filter_initialize_null(
+     libesedb_filter_t **filter,
+     int column_entry,
+     int comparison_operator,
+     libcerror_error_t **error )
+{
+	libesedb_internal_filter_t *internal_filter = NULL;
+	static char *function                       = "libesedb_filter_initialize_null";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_filter_initialize_comparison(
+	     &internal_filter,
+	     column_entry,
+	     comparison_operator,
+	     LIBESEDB_FILTER_VALUE_TYPE_NONE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create comparison filter.",
+		 function );
+
+		return( -1 );
+	}
+	*filter = (libesedb_filter_t *) internal_filter;
+
+	return( 1 );
+}
+
+/* Creates a logical (AND or OR) filter
+ * The filter takes over management of the left and right sub filters
+ * Make sure the value filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_filter_initialize_logical(
+     libesedb_filter_t **filter,
+     int filter_type,
+     libesedb_filter_t *left_filter,
+     libesedb_filter_t *right_filter,
+     libcerror_error_t **error )
+{
+	libesedb_internal_filter_t *internal_filter = NULL;
+	static char *function                       = "libesedb_filter_initialize_logical";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filter_type != LIBESEDB_FILTER_TYPE_AND )
+	 && ( filter_type != LIBESEDB_FILTER_TYPE_OR ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported filter type: %d.",
+		 function,
+		 filter_type );
+
+		return( -1 );
+	}
+	if( left_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid left filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( right_filter == NULL )
+	 || ( right_filter == left_filter ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid right filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = memory_allocate_structure(
+	                   libesedb_internal_filter_t );
+
+	if( internal_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_filter,
+	     0,
+	     sizeof( libesedb_internal_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear filter.",
+		 function );
+
+		goto on_error;
+	}
+	internal_filter->filter_type  = filter_type;
+	internal_filter->left_filter  = left_filter;
+	internal_filter->right_filter = right_filter;
+
+	*filter = (libesedb_filter_t *) internal_filter;
+
+	return( 1 );
+
+on_error:
+	if( internal_filter != NULL )
+	{
+		memory_free(
+		 internal_filter );
+	}
+	return( -1 );
+}
+
+/* Creates a filter that matches if both the left and right sub filters match
+ * The filter takes over management of the left and right sub filters
+ * Make sure the value filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_filter_initialize_and(
+     libesedb_filter_t **filter,
+     libesedb_filter_t *left_filter,
+     libesedb_filter_t *right_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_filter_initialize_and";
+
+	if( libesedb_filter_initialize_logical(
+	     filter,
+	     LIBESEDB_FILTER_TYPE_AND,
+	     left_filter,
+	     right_filter,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create AND filter.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a filter that matches if either the left or right sub filter matches
+ * The filter takes over management of the left and right sub filters
+ * Make sure the value filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_filter_initialize_or(
+     libesedb_filter_t **filter,
+     libesedb_filter_t *left_filter,
+     libesedb_filter_t *right_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_filter_initialize_or";
+
+	if( libesedb_filter_initialize_logical(
+	     filter,
+	     LIBESEDB_FILTER_TYPE_OR,
+	     left_filter,
+	     right_filter,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create OR filter.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees a filter including its sub filters
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_filter_free(
+     libesedb_filter_t **filter,
+     libcerror_error_t **error )
+{
+	libesedb_internal_filter_t *internal_filter = NULL;
+	static char *function                       = "libesedb_filter_free";
+	int result                                  = 1;
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filter != NULL )
+	{
+		internal_filter = (libesedb_internal_filter_t *) *filter;
+		*filter         = NULL;
+
+		if( internal_filter->left_filter != NULL )
+		{
+			if( libesedb_filter_free(
+			     &( internal_filter->left_filter ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free left filter.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_filter->right_filter != NULL )
+		{
+			if( libesedb_filter_free(
+			     &( internal_filter->right_filter ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free right filter.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_filter->value_data != NULL )
+		{
+			memory_free(
+			 internal_filter->value_data );
+		}
+		memory_free(
+		 internal_filter );
+	}
+	return( result );
+}
+
+/* Binds a filter to the column catalog definitions of a table
+ * This determines the column catalog definition and fixed size value offset
+ * of every comparison so they do not need to be looked up per record
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_filter_bind(
+     libesedb_internal_filter_t *internal_filter,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	static char *function                                    = "libesedb_filter_bind";
+	uint16_t fixed_size_value_offset                         = 0;
+	int supported_column_type                                = 0;
+
+	if( internal_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_filter->filter_type != LIBESEDB_FILTER_TYPE_COMPARISON )
+	{
+		if( libesedb_filter_bind(
+		     (libesedb_internal_filter_t *) internal_filter->left_filter,
+		     table_definition,
+		     template_table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to bind left filter.",
+			 function );
+
+			return( -1 );
+		}
+		if( libesedb_filter_bind(
+		     (libesedb_internal_filter_t *) internal_filter->right_filter,
+		     table_definition,
+		     template_table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to bind right filter.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	internal_filter->column_catalog_definition = NULL;
+	internal_filter->fixed_size_value_offset   = 0;
+
+	if( libesedb_data_definition_get_fixed_size_value_offset(
+	     table_definition,
+	     template_table_definition,
+	     internal_filter->column_entry,
+	     &column_catalog_definition,
+	     &fixed_size_value_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve fixed size value offset of column: %d.",
+		 function,
+		 internal_filter->column_entry );
+
+		return( -1 );
+	}
+	switch( internal_filter->value_type )
+	{
+		case LIBESEDB_FILTER_VALUE_TYPE_INTEGER:
+			switch( column_catalog_definition->column_type )
+			{
+				case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+				case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+				case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+				case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+				case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+				case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+				case LIBESEDB_COLUMN_TYPE_CURRENCY:
+				case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+				case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+					supported_column_type = 1;
+					break;
+
+				default:
+					break;
+			}
+			break;
+
+		case LIBESEDB_FILTER_VALUE_TYPE_FLOATING_POINT:
+			switch( column_catalog_definition->column_type )
+			{
+				case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+				case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+					supported_column_type = 1;
+					break;
+
+				default:
+					break;
+			}
+			break;
+
+		default:
+			supported_column_type = 1;
+			break;
+	}
+	if( supported_column_type == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type: %" PRIu32 " for filter value type.",
+		 function,
+		 column_catalog_definition->column_type );
+
+		return( -1 );
+	}
+	internal_filter->column_catalog_definition = column_catalog_definition;
+	internal_filter->fixed_size_value_offset   = fixed_size_value_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the value data of the column of a comparison filter from the record data
+ * The value data references the record data and is not decompressed
+ * Returns 1 if successful, 0 if the column value is NULL or -1 on error
+ */
+int libesedb_filter_get_column_value_data(
+     libesedb_internal_filter_t *internal_filter,
+     libesedb_io_handle_t *io_handle,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     uint8_t *value_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_filter_get_column_value_data";
+	int result            = 0;
+
+	if( internal_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_data_definition_get_record_value_data(
+	          io_handle,
+	          record_data,
+	          record_data_size,
+	          internal_filter->column_catalog_definition,
+	          internal_filter->fixed_size_value_offset,
+	          value_data,
+	          value_data_size,
+	          value_flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d value data.",
+		 function,
+		 internal_filter->column_entry );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Compares an integer column value with the integer value of the filter
+ * Returns 1 if successful, 0 if the value cannot be compared or -1 on error
+ */
+int libesedb_filter_compare_integer_value(
+     libesedb_internal_filter_t *internal_filter,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     int *compare_result,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_filter_compare_integer_value";
+	uint64_t value_64bit  = 0;
+	int64_t value         = 0;
+	uint32_t value_32bit  = 0;
+	uint16_t value_16bit  = 0;
+
+	if( internal_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_filter->column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid filter - missing column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compare_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compare result.",
+		 function );
+
+		return( -1 );
+	}
+	switch( internal_filter->column_catalog_definition->column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			if( value_data_size != 1 )
+			{
+				return( 0 );
+			}
+			value = ( value_data[ 0 ] != 0 ) ? 1 : 0;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			if( value_data_size != 1 )
+			{
+				return( 0 );
+			}
+			value = (int64_t) value_data[ 0 ];
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			if( value_data_size != 2 )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 value_data,
+			 value_16bit );
+
+			if( internal_filter->column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED )
+			{
+				value = (int64_t) ( (int16_t) value_16bit );
+			}
+			else
+			{
+				value = (int64_t) value_16bit;
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			if( value_data_size != 4 )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 value_data,
+			 value_32bit );
+
+			if( internal_filter->column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED )
+			{
+				value = (int64_t) ( (int32_t) value_32bit );
+			}
+			else
+			{
+				value = (int64_t) value_32bit;
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			if( value_data_size != 8 )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint64_little_endian(
+			 value_data,
+			 value_64bit );
+
+			value = (int64_t) value_64bit;
+			break;
+
+		default:
+			return( 0 );
+	}
+	if( value < internal_filter->integer_value )
+	{
+		*compare_result = -1;
+	}
+	else if( value > internal_filter->integer_value )
+	{
+		*compare_result = 1;
+	}
+	else
+	{
+		*compare_result = 0;
+	}
+	return( 1 );
+}
+
+/* Compares a floating point column value with the floating point value of the filter
+ * Returns 1 if successful, 0 if the value cannot be compared or -1 on error
+ */
+int libesedb_filter_compare_floating_point_value(
+     libesedb_internal_filter_t *internal_filter,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     int *compare_result,
+     libcerror_error_t **error )
+{
+	byte_stream_float32_t value_float32;
+	byte_stream_float64_t value_float64;
+
+	static char *function = "libesedb_filter_compare_floating_point_value";
+	double value          = 0.0;
+
+	if( internal_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_filter->column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid filter - missing column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compare_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compare result.",
+		 function );
+
+		return( -1 );
+	}
+	switch( internal_filter->column_catalog_definition->column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			if( value_data_size != 4 )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 value_data,
+			 value_float32.integer );
+
+			value = (double) value_float32.floating_point;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			if( value_data_size != 8 )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint64_little_endian(
+			 value_data,
+			 value_float64.integer );
+
+			value = value_float64.floating_point;
+			break;
+
+		default:
+			return( 0 );
+	}
+	if( value < internal_filter->floating_point_value )
+	{
+		*compare_result = -1;
+	}
+	else if( value > internal_filter->floating_point_value )
+	{
+		*compare_result = 1;
+	}
+	else if( value == internal_filter->floating_point_value )
+	{
+		*compare_result = 0;
+	}
+	else
+	{
+		/* NaN is unordered and cannot be compared
+		 */
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Compares the data of a column value with the data of the filter
+ * Compressed data is decompressed before it is compared
+ * Returns 1 if successful, 0 if the value cannot be compared or -1 on error
+ */
+int libesedb_filter_compare_binary_data_value(
+     libesedb_internal_filter_t *internal_filter,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     uint8_t value_flags,
+     int *compare_result,
+     libcerror_error_t **error )
+{
+	uint8_t *uncompressed_data    = NULL;
+	static char *function         = "libesedb_filter_compare_binary_data_value";
+	size_t compare_size           = 0;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	if( internal_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_data == NULL )
+	 && ( value_data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compare_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compare result.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( value_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
+	 && ( value_data_size > 0 ) )
+	{
+		if( libesedb_compression_decompress_get_size(
+		     value_data,
+		     value_data_size,
+		     &uncompressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve uncompressed data size.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( uncompressed_data_size == 0 )
+		 || ( uncompressed_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid uncompressed data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		uncompressed_data = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * uncompressed_data_size );
+
+		if( uncompressed_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create uncompressed data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_compression_decompress(
+		     value_data,
+		     value_data_size,
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to decompress data.",
+			 function );
+
+			goto on_error;
+		}
+		value_data      = uncompressed_data;
+		value_data_size = uncompressed_data_size;
+	}
+	compare_size = value_data_size;
+
+	if( compare_size > internal_filter->value_data_size )
+	{
+		compare_size = internal_filter->value_data_size;
+	}
+	if( compare_size > 0 )
+	{
+		result = memory_compare(
+		          value_data,
+		          internal_filter->value_data,
+		          compare_size );
+	}
+	if( result < 0 )
+	{
+		*compare_result = -1;
+	}
+	else if( result > 0 )
+	{
+		*compare_result = 1;
+	}
+	else if( value_data_size < internal_filter->value_data_size )
+	{
+		*compare_result = -1;
+	}
+	else if( value_data_size > internal_filter->value_data_size )
+	{
+		*compare_result = 1;
+	}
+	else
+	{
+		*compare_result = 0;
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( 1 );
+
+on_error:
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( -1 );
+}
+
+/* Determines the result of a comparison operator
+ * The compare result is -1 if the value is less than, 0 if the value is equal to
+ * or 1 if the value is greater than the filter value
+ * Returns 1 if the operator holds or 0 if not
+ */
+int libesedb_filter_get_operator_result(
+     int comparison_operator,
+     int compare_result )
+{
+	switch( comparison_operator )
+	{
+		case LIBESEDB_COMPARISON_OPERATOR_EQUAL:
+			return( compare_result == 0 );
+
+		case LIBESEDB_COMPARISON_OPERATOR_NOT_EQUAL:
+			return( compare_result != 0 );
+
+		case LIBESEDB_COMPARISON_OPERATOR_LESS:
+			return( compare_result < 0 );
+
+		case LIBESEDB_COMPARISON_OPERATOR_LESS_EQUAL:
+			return( compare_result <= 0 );
+
+		case LIBESEDB_COMPARISON_OPERATOR_GREATER:
+			return( compare_result > 0 );
+
+		case LIBESEDB_COMPARISON_OPERATOR_GREATER_EQUAL:
+			return( compare_result >= 0 );
+
+		default:
+			break;
+	}
+	return( 0 );
+}
+
+/* Evaluates a (bound) filter against the data of a record
+ * A comparison against a NULL value does not match, neither does a comparison
+ * against a value that cannot be evaluated without materializing the record,
+ * such as a long value or a multi value
+ * Returns 1 if the record matches, 0 if not or -1 on error
+ */
+int libesedb_filter_evaluate(
+     libesedb_internal_filter_t *internal_filter,
+     libesedb_io_handle_t *io_handle,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *value_data = NULL;
+	static char *function     = "libesedb_filter_evaluate";
+	size_t value_data_size    = 0;
+	uint8_t value_flags       = 0;
+	int compare_result        = 0;
+	int result                = 0;
+
+	if( internal_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_filter->filter_type != LIBESEDB_FILTER_TYPE_COMPARISON )
+	{
+		result = libesedb_filter_evaluate(
+		          (libesedb_internal_filter_t *) internal_filter->left_filter,
+		          io_handle,
+		          record_data,
+		          record_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to evaluate left filter.",
+			 function );
+
+			return( -1 );
+		}
+		/* Only evaluate the right filter if it can change the result
+		 */
+		if( ( ( internal_filter->filter_type == LIBESEDB_FILTER_TYPE_AND )
+		  &&  ( result == 0 ) )
+		 || ( ( internal_filter->filter_type == LIBESEDB_FILTER_TYPE_OR )
+		  &&  ( result != 0 ) ) )
+		{
+			return( result );
+		}
+		result = libesedb_filter_evaluate(
+		          (libesedb_internal_filter_t *) internal_filter->right_filter,
+		          io_handle,
+		          record_data,
+		          record_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to evaluate right filter.",
+			 function );
+
+			return( -1 );
+		}
+		return( result );
+	}
+	result = libesedb_filter_get_column_value_data(
+	          internal_filter,
+	          io_handle,
+	          record_data,
+	          record_data_size,
+	          &value_data,
+	          &value_data_size,
+	          &value_flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_filter->comparison_operator == LIBESEDB_COMPARISON_OPERATOR_IS_NULL )
+	{
+		return( result == 0 );
+	}
+	if( internal_filter->comparison_operator == LIBESEDB_COMPARISON_OPERATOR_IS_NOT_NULL )
+	{
+		return( result != 0 );
+	}
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( ( ( value_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) != 0 )
+	 || ( ( value_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) != 0 )
+	 || ( ( value_flags & 0x10 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	switch( internal_filter->value_type )
+	{
+		case LIBESEDB_FILTER_VALUE_TYPE_INTEGER:
+			if( ( value_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
+			{
+				return( 0 );
+			}
+			result = libesedb_filter_compare_integer_value(
+			          internal_filter,
+			          value_data,
+			          value_data_size,
+			          &compare_result,
+			          error );
+			break;
+
+		case LIBESEDB_FILTER_VALUE_TYPE_FLOATING_POINT:
+			if( ( value_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
+			{
+				return( 0 );
+			}
+			result = libesedb_filter_compare_floating_point_value(
+			          internal_filter,
+			          value_data,
+			          value_data_size,
+			          &compare_result,
+			          error );
+			break;
+
+		case LIBESEDB_FILTER_VALUE_TYPE_BINARY_DATA:
+			result = libesedb_filter_compare_binary_data_value(
+			          internal_filter,
+			          value_data,
+			          value_data_size,
+			          value_flags,
+			          &compare_result,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported filter value type: %d.",
+			 function,
+			 internal_filter->value_type );
+
+			return( -1 );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare column value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	return( libesedb_filter_get_operator_result(
+	         internal_filter->comparison_operator,
+	         compare_result ) );
+}
+
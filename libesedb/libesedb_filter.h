@@ -0,0 +1,211 @@
+/*
+ * Record filter functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_FILTER_H )
+#define _LIBESEDB_FILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_extern.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_table_definition.h"
+#include "libesedb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_internal_filter libesedb_internal_filter_t;
+
+struct libesedb_internal_filter
+{
+	/* The filter type
+	 */
+	int filter_type;
+
+	/* The column (record value) entry
+	 */
+	int column_entry;
+
+	/* The comparison operator
+	 */
+	int comparison_operator;
+
+	/* The value type
+	 */
+	int value_type;
+
+	/* The integer value
+	 */
+	int64_t integer_value;
+
+	/* The floating point value
+	 */
+	double floating_point_value;
+
+	/* The value data
+	 */
+	uint8_t *value_data;
+
+	/* The value data size
+	 */
+	size_t value_data_size;
+
+	/* The left sub filter
+	 */
+	libesedb_filter_t *left_filter;
+
+	/* The right sub filter
+	 */
+	libesedb_filter_t *right_filter;
+
+	/* The column catalog definition the filter is bound to
+	 */
+	libesedb_catalog_definition_t *column_catalog_definition;
+
+	/* The offset of the fixed size value in the record data
+	 */
+	uint16_t fixed_size_value_offset;
+};
+
+int libesedb_filter_initialize_comparison(
+     libesedb_internal_filter_t **internal_filter,
+     int column_entry,
+     int comparison_operator,
+     int value_type,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_filter_initialize_integer(
+     libesedb_filter_t **filter,
+     int column_entry,
+     int comparison_operator,
+     int64_t value,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_filter_initialize_floating_point(
+     libesedb_filter_t **filter,
+     int column_entry,
+     int comparison_operator,
+     double value,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_filter_initialize_binary_data(
+     libesedb_filter_t **filter,
+     int column_entry,
+     int comparison_operator,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_filter_initialize_null(
+     libesedb_filter_t **filter,
+     int column_entry,
+     int comparison_operator,
+     libcerror_error_t **error );
+
+int libesedb_filter_initialize_logical(
+     libesedb_filter_t **filter,
+     int filter_type,
+     libesedb_filter_t *left_filter,
+     libesedb_filter_t *right_filter,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_filter_initialize_and(
+     libesedb_filter_t **filter,
+     libesedb_filter_t *left_filter,
+     libesedb_filter_t *right_filter,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_filter_initialize_or(
+     libesedb_filter_t **filter,
+     libesedb_filter_t *left_filter,
+     libesedb_filter_t *right_filter,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_filter_free(
+     libesedb_filter_t **filter,
+     libcerror_error_t **error );
+
+int libesedb_filter_bind(
+     libesedb_internal_filter_t *internal_filter,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libcerror_error_t **error );
+
+int libesedb_filter_get_column_value_data(
+     libesedb_internal_filter_t *internal_filter,
+     libesedb_io_handle_t *io_handle,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     uint8_t *value_flags,
+     libcerror_error_t **error );
+
+int libesedb_filter_compare_integer_value(
+     libesedb_internal_filter_t *internal_filter,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     int *compare_result,
+     libcerror_error_t **error );
+
+int libesedb_filter_compare_floating_point_value(
+     libesedb_internal_filter_t *internal_filter,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     int *compare_result,
+     libcerror_error_t **error );
+
+int libesedb_filter_compare_binary_data_value(
+     libesedb_internal_filter_t *internal_filter,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     uint8_t value_flags,
+     int *compare_result,
+     libcerror_error_t **error );
+
+int libesedb_filter_get_operator_result(
+     int comparison_operator,
+     int compare_result );
+
+int libesedb_filter_evaluate(
+     libesedb_internal_filter_t *internal_filter,
+     libesedb_io_handle_t *io_handle,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_FILTER_H ) */
+
@@ -707,6 +707,7 @@ int libesedb_index_get_record(
 	     internal_index->long_values_pages_cache,
 	     record_data_definition,
 	     internal_index->long_values_page_tree,
+	     NULL,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -33,7 +33,9 @@
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_long_value_cache.h"
 #include "libesedb_page.h"
+#include "libesedb_page_buffer_pool.h"
 #include "libesedb_unused.h"
 
 const uint8_t esedb_file_signature[ 4 ] = { 0xef, 0xcd, 0xab, 0x89 };
@@ -98,6 +100,20 @@ int libesedb_io_handle_initialize(
 
 		goto on_error;
 	}
+	if( libesedb_long_value_cache_initialize(
+	     &( ( *io_handle )->long_value_cache ),
+	     LIBESEDB_DEFAULT_LONG_VALUE_CACHE_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create long value cache.",
+		 function );
+
+		goto on_error;
+	}
 	( *io_handle )->ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
 
 	return( 1 );
@@ -136,6 +152,32 @@ int libesedb_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+		if( libesedb_long_value_cache_free(
+		     &( ( *io_handle )->long_value_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free long value cache.",
+			 function );
+
+			result = -1;
+		}
+		if( libesedb_page_buffer_pool_free(
+		     &( ( *io_handle )->page_buffer_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page buffer pool.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *io_handle );
 
@@ -151,7 +193,8 @@ int libesedb_io_handle_clear(
      libesedb_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_io_handle_clear";
+	libesedb_long_value_cache_t *long_value_cache = NULL;
+	static char *function                         = "libesedb_io_handle_clear";
 
 	if( io_handle == NULL )
 	{
@@ -164,6 +207,42 @@ int libesedb_io_handle_clear(
 
 		return( -1 );
 	}
+	/* The long value cache is retained but its entries belong to the closed file
+	 */
+	if( io_handle->long_value_cache != NULL )
+	{
+		if( libesedb_long_value_cache_empty(
+		     io_handle->long_value_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty long value cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The page buffer pool is recreated when the next file is opened
+	 * since the page size can differ
+	 */
+	if( libesedb_page_buffer_pool_free(
+	     &( io_handle->page_buffer_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	long_value_cache = io_handle->long_value_cache;
+
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -178,7 +257,8 @@ int libesedb_io_handle_clear(
 
 		return( -1 );
 	}
-	io_handle->ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
+	io_handle->long_value_cache = long_value_cache;
+	io_handle->ascii_codepage   = LIBESEDB_CODEPAGE_WINDOWS_1252;
 
 	return( 1 );
 }
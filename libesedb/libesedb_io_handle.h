@@ -28,6 +28,8 @@
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_long_value_cache.h"
+#include "libesedb_page_buffer_pool.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -59,6 +61,14 @@ struct libesedb_io_handle
 	 */
 	uint32_t creation_format_revision;
 
+	/* The file header checksum
+	 */
+	uint32_t file_header_checksum;
+
+	/* The database time
+	 */
+	uint64_t database_time;
+
 	/* The file size
 	 */
 	size64_t file_size;
@@ -83,6 +93,24 @@ struct libesedb_io_handle
 	 */
 	int ascii_codepage;
 
+	/* The long value cache
+	 */
+	libesedb_long_value_cache_t *long_value_cache;
+
+	/* The page buffer pool
+	 */
+	libesedb_page_buffer_pool_t *page_buffer_pool;
+
+	/* The memory data
+	 * Set if the file was opened from memory, in which case page data
+	 * references the memory data instead of being read
+	 */
+	const uint8_t *memory_data;
+
+	/* The memory data size
+	 */
+	size_t memory_data_size;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -29,6 +29,7 @@
 #if defined( HAVE_LOCAL_LIBFCACHE )
 
 #include <libfcache_cache.h>
+#include <libfcache_cache_value.h>
 #include <libfcache_date_time.h>
 #include <libfcache_definitions.h>
 #include <libfcache_types.h>
@@ -34,6 +34,7 @@
 #include "libesedb_libfdata.h"
 #include "libesedb_libfvalue.h"
 #include "libesedb_long_value.h"
+#include "libesedb_long_value_io_handle.h"
 #include "libesedb_record_value.h"
 
 /* Creates a long value
@@ -144,6 +145,7 @@ int libesedb_long_value_initialize(
 	internal_long_value->io_handle                 = io_handle;
 	internal_long_value->column_catalog_definition = column_catalog_definition;
 	internal_long_value->data_segments_list        = data_segments_list;
+	internal_long_value->segment_data_index        = -1;
 
 	*long_value = (libesedb_long_value_t *) internal_long_value;
 
@@ -235,6 +237,11 @@ int libesedb_long_value_free(
 				result = -1;
 			}
 		}
+		if( internal_long_value->segment_data != NULL )
+		{
+			memory_free(
+			 internal_long_value->segment_data );
+		}
 		memory_free(
 		 internal_long_value );
 	}
@@ -623,9 +630,9 @@ int libesedb_long_value_get_record_value(
 				goto on_error;
 			}
 			if( ( data_segment->data_size > 1 )
-			 && ( data_segment->data[ 0 ] == 0x18 ) )
+			 && ( LIBESEDB_COMPRESSION_IS_LONG_VALUE_COMPRESSED( data_segment->data[ 0 ], internal_long_value->column_catalog_definition->flags ) != 0 ) )
 			{
-				if( libesedb_compression_lzxpress_decompress_get_size(
+				if( libesedb_compression_decompress_get_size(
 				     data_segment->data,
 				     data_segment->data_size,
 				     (size_t *) &uncompressed_data_size,
@@ -654,7 +661,7 @@ int libesedb_long_value_get_record_value(
 
 					goto on_error;
 				}
-				if( libesedb_compression_lzxpress_decompress(
+				if( libesedb_compression_decompress(
 				     data_segment->data,
 				     data_segment->data_size,
 				     &( data[ data_offset ] ),
@@ -943,6 +950,89 @@ int libesedb_long_value_get_data_segment(
 	return( 1 );
 }
 
+/* Retrieve the range of the data segment in the file
+ * The range is only available if the data segment is stored uncompressed,
+ * which allows the data to be copied directly from the file
+ * Returns 1 if successful, 0 if the data segment is compressed or -1 on error
+ */
+int libesedb_long_value_get_data_segment_file_range(
+     libesedb_long_value_t *long_value,
+     int data_segment_index,
+     off64_t *file_offset,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_long_value_t *internal_long_value = NULL;
+	static char *function                               = "libesedb_long_value_get_data_segment_file_range";
+	size64_t element_size                               = 0;
+	off64_t element_offset                              = 0;
+	uint32_t element_flags                              = 0;
+	int element_file_index                              = 0;
+
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value = (libesedb_internal_long_value_t *) long_value;
+
+	if( file_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_element_by_index(
+	     internal_long_value->data_segments_list,
+	     data_segment_index,
+	     &element_file_index,
+	     &element_offset,
+	     &element_size,
+	     &element_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data segment: %d.",
+		 function,
+		 data_segment_index );
+
+		return( -1 );
+	}
+	if( ( element_flags & LIBFDATA_RANGE_FLAG_IS_COMPRESSED ) != 0 )
+	{
+		return( 0 );
+	}
+	*file_offset = element_offset;
+	*size        = element_size;
+
+	return( 1 );
+}
+
 /* Retrieves the size of the data as an UTF-8 encoded string
  * The returned size includes the end of string character
  * Returns 1 if successful, 0 if value is NULL or -1 on error
@@ -1377,3 +1467,735 @@ int libesedb_long_value_get_utf16_string(
 	return( result );
 }
 
+/* Retrieves the uncompressed data of a specific data segment
+ * The segment data is managed by the long value and remains valid until the next call
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_get_segment_data(
+     libesedb_internal_long_value_t *internal_long_value,
+     int data_segment_index,
+     const uint8_t **segment_data,
+     size_t *segment_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_data_segment_t *data_segment = NULL;
+	static char *function                 = "libesedb_long_value_get_segment_data";
+	size_t uncompressed_data_size         = 0;
+
+	if( internal_long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment data.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_long_value->segment_data != NULL )
+	 && ( internal_long_value->segment_data_index == data_segment_index ) )
+	{
+		*segment_data      = internal_long_value->segment_data;
+		*segment_data_size = internal_long_value->segment_data_size;
+
+		return( 1 );
+	}
+	if( libfdata_list_get_element_value_by_index(
+	     internal_long_value->data_segments_list,
+	     (intptr_t *) internal_long_value->file_io_handle,
+	     (libfdata_cache_t *) internal_long_value->data_segments_cache,
+	     data_segment_index,
+	     (intptr_t **) &data_segment,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data segment: %d.",
+		 function,
+		 data_segment_index );
+
+		return( -1 );
+	}
+	if( data_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing data segment: %d.",
+		 function,
+		 data_segment_index );
+
+		return( -1 );
+	}
+	if( data_segment->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data segment: %d - missing data.",
+		 function,
+		 data_segment_index );
+
+		return( -1 );
+	}
+	if( ( data_segment->data_size <= 1 )
+	 || ( LIBESEDB_COMPRESSION_IS_LONG_VALUE_COMPRESSED( data_segment->data[ 0 ], internal_long_value->column_catalog_definition->flags ) == 0 ) )
+	{
+		*segment_data      = data_segment->data;
+		*segment_data_size = data_segment->data_size;
+
+		return( 1 );
+	}
+	/* The data segment is LZXPRESS compressed, only the uncompressed data
+	 * of a single data segment is retained
+	 */
+	if( libesedb_compression_decompress_get_size(
+	     data_segment->data,
+	     data_segment->data_size,
+	     &uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable retrieve uncompressed data segment: %d size.",
+		 function,
+		 data_segment_index );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_size == 0 )
+	 || ( uncompressed_data_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data segment: %d size value out of bounds.",
+		 function,
+		 data_segment_index );
+
+		return( -1 );
+	}
+	if( internal_long_value->segment_data != NULL )
+	{
+		memory_free(
+		 internal_long_value->segment_data );
+
+		internal_long_value->segment_data = NULL;
+	}
+	internal_long_value->segment_data_size  = 0;
+	internal_long_value->segment_data_index = -1;
+
+	internal_long_value->segment_data = (uint8_t *) memory_allocate(
+	                                                 sizeof( uint8_t ) * uncompressed_data_size );
+
+	if( internal_long_value->segment_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_compression_decompress(
+	     data_segment->data,
+	     data_segment->data_size,
+	     internal_long_value->segment_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data segment: %d.",
+		 function,
+		 data_segment_index );
+
+		memory_free(
+		 internal_long_value->segment_data );
+
+		internal_long_value->segment_data = NULL;
+
+		return( -1 );
+	}
+	internal_long_value->segment_data_size  = uncompressed_data_size;
+	internal_long_value->segment_data_index = data_segment_index;
+
+	*segment_data      = internal_long_value->segment_data;
+	*segment_data_size = internal_long_value->segment_data_size;
+
+	return( 1 );
+}
+
+/* Reads data at the current offset into a buffer
+ * The data segments are read on demand, hence the data does not need to fit in memory
+ * If the long value is compressed this will return the uncompressed data
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libesedb_long_value_read_buffer(
+         libesedb_long_value_t *long_value,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libesedb_internal_long_value_t *internal_long_value = NULL;
+	const uint8_t *segment_data                         = NULL;
+	static char *function                               = "libesedb_long_value_read_buffer";
+	size_t buffer_offset                                = 0;
+	size_t read_size                                    = 0;
+	size_t segment_data_offset                          = 0;
+	size_t segment_data_size                            = 0;
+	int number_of_data_segments                         = 0;
+
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value = (libesedb_internal_long_value_t *) long_value;
+
+	if( internal_long_value->current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid long value - current offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     internal_long_value->data_segments_list,
+	     &number_of_data_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements from data segments list.",
+		 function );
+
+		return( -1 );
+	}
+	/* The uncompressed size of a data segment is only known after it was read
+	 * hence seeking backwards restarts at the first data segment
+	 */
+	if( internal_long_value->current_offset < internal_long_value->current_segment_offset )
+	{
+		internal_long_value->current_segment_index  = 0;
+		internal_long_value->current_segment_offset = 0;
+	}
+	while( buffer_offset < buffer_size )
+	{
+		if( internal_long_value->current_segment_index >= number_of_data_segments )
+		{
+			break;
+		}
+		if( libesedb_long_value_get_segment_data(
+		     internal_long_value,
+		     internal_long_value->current_segment_index,
+		     &segment_data,
+		     &segment_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data segment: %d data.",
+			 function,
+			 internal_long_value->current_segment_index );
+
+			return( -1 );
+		}
+		if( (size64_t) ( internal_long_value->current_offset - internal_long_value->current_segment_offset ) >= (size64_t) segment_data_size )
+		{
+			internal_long_value->current_segment_offset += (off64_t) segment_data_size;
+			internal_long_value->current_segment_index  += 1;
+
+			continue;
+		}
+		segment_data_offset = (size_t) ( internal_long_value->current_offset - internal_long_value->current_segment_offset );
+
+		read_size = segment_data_size - segment_data_offset;
+
+		if( read_size > ( buffer_size - buffer_offset ) )
+		{
+			read_size = buffer_size - buffer_offset;
+		}
+		if( memory_copy(
+		     &( buffer[ buffer_offset ] ),
+		     &( segment_data[ segment_data_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy segment data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		buffer_offset                       += read_size;
+		internal_long_value->current_offset += (off64_t) read_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Reads data at a specific offset into a buffer
+ * If the long value is compressed this will return the uncompressed data
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libesedb_long_value_read_buffer_at_offset(
+         libesedb_long_value_t *long_value,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libesedb_long_value_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	if( libesedb_long_value_seek_offset(
+	     long_value,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              buffer,
+	              buffer_size,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Seeks a certain offset of the data
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libesedb_long_value_seek_offset(
+         libesedb_long_value_t *long_value,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libesedb_internal_long_value_t *internal_long_value = NULL;
+	static char *function                               = "libesedb_long_value_seek_offset";
+	size64_t size                                       = 0;
+
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value = (libesedb_internal_long_value_t *) long_value;
+
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += internal_long_value->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		if( libesedb_long_value_get_size(
+		     long_value,
+		     &size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size.",
+			 function );
+
+			return( -1 );
+		}
+		offset += (off64_t) size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value->current_offset = offset;
+
+	return( offset );
+}
+
+/* Retrieves the current offset of the data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_get_offset(
+     libesedb_long_value_t *long_value,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libesedb_internal_long_value_t *internal_long_value = NULL;
+	static char *function                               = "libesedb_long_value_get_offset";
+
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value = (libesedb_internal_long_value_t *) long_value;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	*offset = internal_long_value->current_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the data
+ * If the long value is compressed this will return the uncompressed size
+ * Unlike libesedb_long_value_get_data_size the data is not retained in memory
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_get_size(
+     libesedb_long_value_t *long_value,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libesedb_data_segment_t *data_segment               = NULL;
+	libesedb_internal_long_value_t *internal_long_value = NULL;
+	static char *function                               = "libesedb_long_value_get_size";
+	size64_t safe_size                                  = 0;
+	size_t uncompressed_data_size                       = 0;
+	int data_segment_index                              = 0;
+	int number_of_data_segments                         = 0;
+
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value = (libesedb_internal_long_value_t *) long_value;
+
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_long_value->size_is_set == 0 )
+	{
+		if( libfdata_list_get_number_of_elements(
+		     internal_long_value->data_segments_list,
+		     &number_of_data_segments,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of elements from data segments list.",
+			 function );
+
+			return( -1 );
+		}
+		for( data_segment_index = 0;
+		     data_segment_index < number_of_data_segments;
+		     data_segment_index++ )
+		{
+			if( libfdata_list_get_element_value_by_index(
+			     internal_long_value->data_segments_list,
+			     (intptr_t *) internal_long_value->file_io_handle,
+			     (libfdata_cache_t *) internal_long_value->data_segments_cache,
+			     data_segment_index,
+			     (intptr_t **) &data_segment,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data segment: %d.",
+				 function,
+				 data_segment_index );
+
+				return( -1 );
+			}
+			if( ( data_segment == NULL )
+			 || ( data_segment->data == NULL ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: invalid data segment: %d - missing data.",
+				 function,
+				 data_segment_index );
+
+				return( -1 );
+			}
+			if( ( data_segment->data_size > 1 )
+			 && ( LIBESEDB_COMPRESSION_IS_LONG_VALUE_COMPRESSED( data_segment->data[ 0 ], internal_long_value->column_catalog_definition->flags ) != 0 ) )
+			{
+				if( libesedb_compression_decompress_get_size(
+				     data_segment->data,
+				     data_segment->data_size,
+				     &uncompressed_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable retrieve uncompressed data segment: %d size.",
+					 function,
+					 data_segment_index );
+
+					return( -1 );
+				}
+				safe_size += uncompressed_data_size;
+			}
+			else
+			{
+				safe_size += data_segment->data_size;
+			}
+		}
+		internal_long_value->size        = safe_size;
+		internal_long_value->size_is_set = 1;
+	}
+	*size = internal_long_value->size;
+
+	return( 1 );
+}
+
+/* Creates a Basic File IO (bfio) handle to read the data
+ * The handle reads the data segments on demand and has its own offset
+ * The long value must remain available for as long as the handle is used
+ * Make sure the value file_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_get_file_io_handle(
+     libesedb_long_value_t *long_value,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	libesedb_long_value_io_handle_t *long_value_io_handle = NULL;
+	static char *function                                 = "libesedb_long_value_get_file_io_handle";
+
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_long_value_io_handle_initialize(
+	     &long_value_io_handle,
+	     long_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create long value IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     file_io_handle,
+	     (intptr_t *) long_value_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libesedb_long_value_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libesedb_long_value_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libesedb_long_value_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libesedb_long_value_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libesedb_long_value_io_handle_read,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libesedb_long_value_io_handle_write,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libesedb_long_value_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libesedb_long_value_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libesedb_long_value_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libesedb_long_value_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( long_value_io_handle != NULL )
+	{
+		libesedb_long_value_io_handle_free(
+		 &long_value_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
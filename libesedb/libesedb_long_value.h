@@ -66,6 +66,38 @@ struct libesedb_internal_long_value
 	/* The record value
 	 */
 	libfvalue_value_t *record_value;
+
+	/* The current (uncompressed data) offset
+	 */
+	off64_t current_offset;
+
+	/* The current data segment index
+	 */
+	int current_segment_index;
+
+	/* The (uncompressed data) offset of the current data segment
+	 */
+	off64_t current_segment_offset;
+
+	/* The uncompressed segment data
+	 */
+	uint8_t *segment_data;
+
+	/* The uncompressed segment data size
+	 */
+	size_t segment_data_size;
+
+	/* The index of the data segment the uncompressed segment data was read from
+	 */
+	int segment_data_index;
+
+	/* The (uncompressed data) size
+	 */
+	size64_t size;
+
+	/* Value to indicate the size was determined
+	 */
+	uint8_t size_is_set;
 };
 
 int libesedb_long_value_initialize(
@@ -120,6 +152,14 @@ int libesedb_long_value_get_data_segment(
      size_t data_size,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_long_value_get_data_segment_file_range(
+     libesedb_long_value_t *long_value,
+     int data_segment_index,
+     off64_t *file_offset,
+     size64_t *size,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_long_value_get_utf8_string_size(
      libesedb_long_value_t *long_value,
@@ -146,6 +186,53 @@ int libesedb_long_value_get_utf16_string(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+int libesedb_long_value_get_segment_data(
+     libesedb_internal_long_value_t *internal_long_value,
+     int data_segment_index,
+     const uint8_t **segment_data,
+     size_t *segment_data_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+ssize_t libesedb_long_value_read_buffer(
+         libesedb_long_value_t *long_value,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+ssize_t libesedb_long_value_read_buffer_at_offset(
+         libesedb_long_value_t *long_value,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+off64_t libesedb_long_value_seek_offset(
+         libesedb_long_value_t *long_value,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_long_value_get_offset(
+     libesedb_long_value_t *long_value,
+     off64_t *offset,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_long_value_get_size(
+     libesedb_long_value_t *long_value,
+     size64_t *size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_long_value_get_file_io_handle(
+     libesedb_long_value_t *long_value,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,874 @@
+/*
+ * Long value cache functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_definitions.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_long_value_cache.h"
+
+/* Calculates the hash of a long value segment
+ * Returns the hash
+ */
+uint32_t libesedb_long_value_cache_get_hash(
+          uint32_t table_identifier,
+          const uint8_t *long_value_key,
+          size_t long_value_key_size,
+          off64_t segment_offset )
+{
+	uint64_t value_64bit = 0;
+	uint32_t hash        = 0x811c9dc5UL;
+	size_t key_index     = 0;
+	uint8_t byte_index   = 0;
+
+	/* Uses the 32-bit FNV-1a hash
+	 */
+	for( byte_index = 0;
+	     byte_index < 4;
+	     byte_index++ )
+	{
+		hash ^= (uint8_t) ( table_identifier >> ( byte_index * 8 ) );
+		hash *= 0x01000193UL;
+	}
+	for( key_index = 0;
+	     key_index < long_value_key_size;
+	     key_index++ )
+	{
+		hash ^= long_value_key[ key_index ];
+		hash *= 0x01000193UL;
+	}
+	value_64bit = (uint64_t) segment_offset;
+
+	for( byte_index = 0;
+	     byte_index < 8;
+	     byte_index++ )
+	{
+		hash ^= (uint8_t) ( value_64bit >> ( byte_index * 8 ) );
+		hash *= 0x01000193UL;
+	}
+	return( hash );
+}
+
+/* Creates a long value cache
+ * Make sure the value long_value_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_cache_initialize(
+     libesedb_long_value_cache_t **long_value_cache,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_long_value_cache_initialize";
+	size_t buckets_size   = 0;
+
+	if( long_value_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *long_value_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid long value cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*long_value_cache = memory_allocate_structure(
+	                     libesedb_long_value_cache_t );
+
+	if( *long_value_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create long value cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *long_value_cache,
+	     0,
+	     sizeof( libesedb_long_value_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear long value cache.",
+		 function );
+
+		memory_free(
+		 *long_value_cache );
+
+		*long_value_cache = NULL;
+
+		return( -1 );
+	}
+	buckets_size = sizeof( libesedb_long_value_cache_entry_t * ) * LIBESEDB_LONG_VALUE_CACHE_NUMBER_OF_BUCKETS;
+
+	( *long_value_cache )->buckets = (libesedb_long_value_cache_entry_t **) memory_allocate(
+	                                                                          buckets_size );
+
+	if( ( *long_value_cache )->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *long_value_cache )->buckets,
+	     0,
+	     buckets_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		goto on_error;
+	}
+	( *long_value_cache )->maximum_cache_size = maximum_cache_size;
+
+	return( 1 );
+
+on_error:
+	if( *long_value_cache != NULL )
+	{
+		if( ( *long_value_cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *long_value_cache )->buckets );
+		}
+		memory_free(
+		 *long_value_cache );
+
+		*long_value_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a long value cache
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_cache_free(
+     libesedb_long_value_cache_t **long_value_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_long_value_cache_free";
+	int result            = 1;
+
+	if( long_value_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *long_value_cache != NULL )
+	{
+		if( libesedb_long_value_cache_empty(
+		     *long_value_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty long value cache.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 ( *long_value_cache )->buckets );
+
+		memory_free(
+		 *long_value_cache );
+
+		*long_value_cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties a long value cache
+ * The hit and miss counters are retained
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_cache_empty(
+     libesedb_long_value_cache_t *long_value_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_long_value_cache_empty";
+
+	if( long_value_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value cache.",
+		 function );
+
+		return( -1 );
+	}
+	while( long_value_cache->last_entry != NULL )
+	{
+		if( libesedb_long_value_cache_remove_entry(
+		     long_value_cache,
+		     long_value_cache->last_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove cache entry.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Removes and frees an entry of the long value cache
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_cache_remove_entry(
+     libesedb_long_value_cache_t *long_value_cache,
+     libesedb_long_value_cache_entry_t *cache_entry,
+     libcerror_error_t **error )
+{
+	libesedb_long_value_cache_entry_t **bucket_entry = NULL;
+	static char *function                            = "libesedb_long_value_cache_remove_entry";
+
+	if( long_value_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_entry = &( long_value_cache->buckets[ cache_entry->hash % LIBESEDB_LONG_VALUE_CACHE_NUMBER_OF_BUCKETS ] );
+
+	while( *bucket_entry != NULL )
+	{
+		if( *bucket_entry == cache_entry )
+		{
+			*bucket_entry = cache_entry->next_bucket_entry;
+
+			break;
+		}
+		bucket_entry = &( ( *bucket_entry )->next_bucket_entry );
+	}
+	if( cache_entry->previous_entry != NULL )
+	{
+		cache_entry->previous_entry->next_entry = cache_entry->next_entry;
+	}
+	else
+	{
+		long_value_cache->first_entry = cache_entry->next_entry;
+	}
+	if( cache_entry->next_entry != NULL )
+	{
+		cache_entry->next_entry->previous_entry = cache_entry->previous_entry;
+	}
+	else
+	{
+		long_value_cache->last_entry = cache_entry->previous_entry;
+	}
+	long_value_cache->cache_size        -= cache_entry->data_size;
+	long_value_cache->number_of_entries -= 1;
+
+	memory_free(
+	 cache_entry->data );
+
+	memory_free(
+	 cache_entry );
+
+	return( 1 );
+}
+
+/* Retrieves the maximum cache size
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_cache_get_maximum_cache_size(
+     libesedb_long_value_cache_t *long_value_cache,
+     size64_t *maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_long_value_cache_get_maximum_cache_size";
+
+	if( long_value_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum cache size.",
+		 function );
+
+		return( -1 );
+	}
+	*maximum_cache_size = long_value_cache->maximum_cache_size;
+
+	return( 1 );
+}
+
+/* Sets the maximum cache size
+ * Least recently used entries are removed until the cache fits
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_cache_set_maximum_cache_size(
+     libesedb_long_value_cache_t *long_value_cache,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_long_value_cache_set_maximum_cache_size";
+
+	if( long_value_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value cache.",
+		 function );
+
+		return( -1 );
+	}
+	long_value_cache->maximum_cache_size = maximum_cache_size;
+
+	while( long_value_cache->cache_size > maximum_cache_size )
+	{
+		if( libesedb_long_value_cache_remove_entry(
+		     long_value_cache,
+		     long_value_cache->last_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove least recently used cache entry.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_cache_get_statistics(
+     libesedb_long_value_cache_t *long_value_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     size64_t *cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_long_value_cache_get_statistics";
+
+	if( long_value_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache size.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_hits   = long_value_cache->number_of_hits;
+	*number_of_misses = long_value_cache->number_of_misses;
+	*cache_size       = long_value_cache->cache_size;
+
+	return( 1 );
+}
+
+/* Retrieves the entry of a long value segment
+ * Returns the entry or NULL if not cached
+ */
+libesedb_long_value_cache_entry_t *libesedb_long_value_cache_get_entry(
+                                    libesedb_long_value_cache_t *long_value_cache,
+                                    uint32_t table_identifier,
+                                    const uint8_t *long_value_key,
+                                    size_t long_value_key_size,
+                                    off64_t segment_offset )
+{
+	libesedb_long_value_cache_entry_t *cache_entry = NULL;
+	uint32_t hash                                  = 0;
+
+	hash = libesedb_long_value_cache_get_hash(
+	        table_identifier,
+	        long_value_key,
+	        long_value_key_size,
+	        segment_offset );
+
+	cache_entry = long_value_cache->buckets[ hash % LIBESEDB_LONG_VALUE_CACHE_NUMBER_OF_BUCKETS ];
+
+	while( cache_entry != NULL )
+	{
+		if( ( cache_entry->hash == hash )
+		 && ( cache_entry->table_identifier == table_identifier )
+		 && ( cache_entry->segment_offset == segment_offset )
+		 && ( cache_entry->long_value_key_size == long_value_key_size )
+		 && ( memory_compare(
+		       cache_entry->long_value_key,
+		       long_value_key,
+		       long_value_key_size ) == 0 ) )
+		{
+			break;
+		}
+		cache_entry = cache_entry->next_bucket_entry;
+	}
+	return( cache_entry );
+}
+
+/* Retrieves the cached data of a long value segment
+ * The data is owned by the cache and remains valid until the next call
+ * that modifies the cache
+ * Returns 1 if successful, 0 if not cached or -1 on error
+ */
+int libesedb_long_value_cache_get_data(
+     libesedb_long_value_cache_t *long_value_cache,
+     uint32_t table_identifier,
+     const uint8_t *long_value_key,
+     size_t long_value_key_size,
+     off64_t segment_offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libesedb_long_value_cache_entry_t *cache_entry = NULL;
+	static char *function                          = "libesedb_long_value_cache_get_data";
+
+	if( long_value_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( long_value_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value key.",
+		 function );
+
+		return( -1 );
+	}
+	if( long_value_key_size > 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid long value key size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( long_value_cache->maximum_cache_size == 0 )
+	{
+		return( 0 );
+	}
+	cache_entry = libesedb_long_value_cache_get_entry(
+	               long_value_cache,
+	               table_identifier,
+	               long_value_key,
+	               long_value_key_size,
+	               segment_offset );
+
+	if( cache_entry == NULL )
+	{
+		long_value_cache->number_of_misses += 1;
+
+		return( 0 );
+	}
+	long_value_cache->number_of_hits += 1;
+
+	/* Move the entry to the front of the most recently used list
+	 */
+	if( cache_entry->previous_entry != NULL )
+	{
+		cache_entry->previous_entry->next_entry = cache_entry->next_entry;
+
+		if( cache_entry->next_entry != NULL )
+		{
+			cache_entry->next_entry->previous_entry = cache_entry->previous_entry;
+		}
+		else
+		{
+			long_value_cache->last_entry = cache_entry->previous_entry;
+		}
+		cache_entry->previous_entry = NULL;
+		cache_entry->next_entry     = long_value_cache->first_entry;
+
+		long_value_cache->first_entry->previous_entry = cache_entry;
+		long_value_cache->first_entry                 = cache_entry;
+	}
+	*data      = cache_entry->data;
+	*data_size = cache_entry->data_size;
+
+	return( 1 );
+}
+
+/* Sets the data of a long value segment in the cache
+ * The data is copied, least recently used entries are removed to make room
+ * Data that exceeds the maximum cache size is not cached
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_cache_set_data(
+     libesedb_long_value_cache_t *long_value_cache,
+     uint32_t table_identifier,
+     const uint8_t *long_value_key,
+     size_t long_value_key_size,
+     off64_t segment_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libesedb_long_value_cache_entry_t *cache_entry = NULL;
+	static char *function                          = "libesedb_long_value_cache_set_data";
+	uint32_t bucket_index                          = 0;
+
+	if( long_value_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( long_value_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value key.",
+		 function );
+
+		return( -1 );
+	}
+	if( long_value_key_size > 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid long value key size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) data_size > long_value_cache->maximum_cache_size )
+	{
+		return( 1 );
+	}
+	if( libesedb_long_value_cache_get_entry(
+	     long_value_cache,
+	     table_identifier,
+	     long_value_key,
+	     long_value_key_size,
+	     segment_offset ) != NULL )
+	{
+		return( 1 );
+	}
+	while( ( long_value_cache->cache_size + data_size ) > long_value_cache->maximum_cache_size )
+	{
+		if( libesedb_long_value_cache_remove_entry(
+		     long_value_cache,
+		     long_value_cache->last_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove least recently used cache entry.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	cache_entry = memory_allocate_structure(
+	               libesedb_long_value_cache_entry_t );
+
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     cache_entry,
+	     0,
+	     sizeof( libesedb_long_value_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache entry.",
+		 function );
+
+		goto on_error;
+	}
+	cache_entry->data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * data_size );
+
+	if( cache_entry->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache entry data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     cache_entry->data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy cache entry data.",
+		 function );
+
+		goto on_error;
+	}
+	if( long_value_key_size > 0 )
+	{
+		if( memory_copy(
+		     cache_entry->long_value_key,
+		     long_value_key,
+		     long_value_key_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy long value key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	cache_entry->table_identifier    = table_identifier;
+	cache_entry->long_value_key_size = long_value_key_size;
+	cache_entry->segment_offset      = segment_offset;
+	cache_entry->data_size           = data_size;
+	cache_entry->hash                = libesedb_long_value_cache_get_hash(
+	                                    table_identifier,
+	                                    long_value_key,
+	                                    long_value_key_size,
+	                                    segment_offset );
+
+	bucket_index = cache_entry->hash % LIBESEDB_LONG_VALUE_CACHE_NUMBER_OF_BUCKETS;
+
+	cache_entry->next_bucket_entry          = long_value_cache->buckets[ bucket_index ];
+	long_value_cache->buckets[ bucket_index ] = cache_entry;
+
+	cache_entry->next_entry = long_value_cache->first_entry;
+
+	if( long_value_cache->first_entry != NULL )
+	{
+		long_value_cache->first_entry->previous_entry = cache_entry;
+	}
+	else
+	{
+		long_value_cache->last_entry = cache_entry;
+	}
+	long_value_cache->first_entry = cache_entry;
+
+	long_value_cache->cache_size        += data_size;
+	long_value_cache->number_of_entries += 1;
+
+	return( 1 );
+
+on_error:
+	if( cache_entry != NULL )
+	{
+		if( cache_entry->data != NULL )
+		{
+			memory_free(
+			 cache_entry->data );
+		}
+		memory_free(
+		 cache_entry );
+	}
+	return( -1 );
+}
+
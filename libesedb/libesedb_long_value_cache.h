@@ -0,0 +1,190 @@
+/*
+ * Long value cache functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_LONG_VALUE_CACHE_H )
+#define _LIBESEDB_LONG_VALUE_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_long_value_cache_entry libesedb_long_value_cache_entry_t;
+
+struct libesedb_long_value_cache_entry
+{
+	/* The table identifier
+	 */
+	uint32_t table_identifier;
+
+	/* The long value key
+	 */
+	uint8_t long_value_key[ 8 ];
+
+	/* The long value key size
+	 */
+	size_t long_value_key_size;
+
+	/* The segment (data) offset
+	 */
+	off64_t segment_offset;
+
+	/* The hash
+	 */
+	uint32_t hash;
+
+	/* The (segment) data
+	 */
+	uint8_t *data;
+
+	/* The (segment) data size
+	 */
+	size_t data_size;
+
+	/* The next entry in the same bucket
+	 */
+	libesedb_long_value_cache_entry_t *next_bucket_entry;
+
+	/* The previous (more recently used) entry
+	 */
+	libesedb_long_value_cache_entry_t *previous_entry;
+
+	/* The next (less recently used) entry
+	 */
+	libesedb_long_value_cache_entry_t *next_entry;
+};
+
+typedef struct libesedb_long_value_cache libesedb_long_value_cache_t;
+
+struct libesedb_long_value_cache
+{
+	/* The buckets
+	 */
+	libesedb_long_value_cache_entry_t **buckets;
+
+	/* The most recently used entry
+	 */
+	libesedb_long_value_cache_entry_t *first_entry;
+
+	/* The least recently used entry
+	 */
+	libesedb_long_value_cache_entry_t *last_entry;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The cache size
+	 * This is the sum of the data sizes of the entries
+	 */
+	size64_t cache_size;
+
+	/* The maximum cache size
+	 */
+	size64_t maximum_cache_size;
+
+	/* The number of cache hits
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of cache misses
+	 */
+	uint64_t number_of_misses;
+};
+
+uint32_t libesedb_long_value_cache_get_hash(
+          uint32_t table_identifier,
+          const uint8_t *long_value_key,
+          size_t long_value_key_size,
+          off64_t segment_offset );
+
+int libesedb_long_value_cache_initialize(
+     libesedb_long_value_cache_t **long_value_cache,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libesedb_long_value_cache_free(
+     libesedb_long_value_cache_t **long_value_cache,
+     libcerror_error_t **error );
+
+int libesedb_long_value_cache_empty(
+     libesedb_long_value_cache_t *long_value_cache,
+     libcerror_error_t **error );
+
+int libesedb_long_value_cache_remove_entry(
+     libesedb_long_value_cache_t *long_value_cache,
+     libesedb_long_value_cache_entry_t *cache_entry,
+     libcerror_error_t **error );
+
+int libesedb_long_value_cache_get_maximum_cache_size(
+     libesedb_long_value_cache_t *long_value_cache,
+     size64_t *maximum_cache_size,
+     libcerror_error_t **error );
+
+int libesedb_long_value_cache_set_maximum_cache_size(
+     libesedb_long_value_cache_t *long_value_cache,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libesedb_long_value_cache_get_statistics(
+     libesedb_long_value_cache_t *long_value_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     size64_t *cache_size,
+     libcerror_error_t **error );
+
+libesedb_long_value_cache_entry_t *libesedb_long_value_cache_get_entry(
+                                    libesedb_long_value_cache_t *long_value_cache,
+                                    uint32_t table_identifier,
+                                    const uint8_t *long_value_key,
+                                    size_t long_value_key_size,
+                                    off64_t segment_offset );
+
+int libesedb_long_value_cache_get_data(
+     libesedb_long_value_cache_t *long_value_cache,
+     uint32_t table_identifier,
+     const uint8_t *long_value_key,
+     size_t long_value_key_size,
+     off64_t segment_offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libesedb_long_value_cache_set_data(
+     libesedb_long_value_cache_t *long_value_cache,
+     uint32_t table_identifier,
+     const uint8_t *long_value_key,
+     size_t long_value_key_size,
+     off64_t segment_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_LONG_VALUE_CACHE_H ) */
+
@@ -0,0 +1,869 @@
+/*
+ * Long value cursor functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_data_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libfdata.h"
+#include "libesedb_long_value_cursor.h"
+#include "libesedb_page_tree.h"
+#include "libesedb_page_tree_key.h"
+
+/* Creates a long value cursor
+ * Make sure the value long_value_cursor is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_cursor_initialize(
+     libesedb_long_value_cursor_t **long_value_cursor,
+     libesedb_page_tree_t *page_tree,
+     int maximum_number_of_buffered_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_long_value_cursor_initialize";
+
+	if( long_value_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *long_value_cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid long value cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_buffered_values <= 0 )
+	 || ( (size_t) maximum_number_of_buffered_values > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libesedb_page_tree_key_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of buffered values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*long_value_cursor = memory_allocate_structure(
+	                      libesedb_long_value_cursor_t );
+
+	if( *long_value_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create long value cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *long_value_cursor,
+	     0,
+	     sizeof( libesedb_long_value_cursor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear long value cursor.",
+		 function );
+
+		memory_free(
+		 *long_value_cursor );
+
+		*long_value_cursor = NULL;
+
+		return( -1 );
+	}
+	( *long_value_cursor )->buffered_keys = (libesedb_page_tree_key_t **) memory_allocate(
+	                                                                       sizeof( libesedb_page_tree_key_t * ) * maximum_number_of_buffered_values );
+
+	if( ( *long_value_cursor )->buffered_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffered keys.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *long_value_cursor )->buffered_keys,
+	     0,
+	     sizeof( libesedb_page_tree_key_t * ) * maximum_number_of_buffered_values ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffered keys.",
+		 function );
+
+		goto on_error;
+	}
+	( *long_value_cursor )->buffered_data_definitions = (libesedb_data_definition_t **) memory_allocate(
+	                                                                                     sizeof( libesedb_data_definition_t * ) * maximum_number_of_buffered_values );
+
+	if( ( *long_value_cursor )->buffered_data_definitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffered data definitions.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *long_value_cursor )->buffered_data_definitions,
+	     0,
+	     sizeof( libesedb_data_definition_t * ) * maximum_number_of_buffered_values ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffered data definitions.",
+		 function );
+
+		goto on_error;
+	}
+	( *long_value_cursor )->page_tree                         = page_tree;
+	( *long_value_cursor )->maximum_number_of_buffered_values = maximum_number_of_buffered_values;
+
+	return( 1 );
+
+on_error:
+	if( *long_value_cursor != NULL )
+	{
+		if( ( *long_value_cursor )->buffered_data_definitions != NULL )
+		{
+			memory_free(
+			 ( *long_value_cursor )->buffered_data_definitions );
+		}
+		if( ( *long_value_cursor )->buffered_keys != NULL )
+		{
+			memory_free(
+			 ( *long_value_cursor )->buffered_keys );
+		}
+		memory_free(
+		 *long_value_cursor );
+
+		*long_value_cursor = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a long value cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_cursor_free(
+     libesedb_long_value_cursor_t **long_value_cursor,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_long_value_cursor_free";
+	int buffered_value_index = 0;
+	int result               = 1;
+
+	if( long_value_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *long_value_cursor != NULL )
+	{
+		/* The page_tree reference is freed elsewhere
+		 */
+		if( libesedb_long_value_cursor_set_position(
+		     *long_value_cursor,
+		     NULL,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free current leaf value.",
+			 function );
+
+			result = -1;
+		}
+		for( buffered_value_index = 0;
+		     buffered_value_index < ( *long_value_cursor )->maximum_number_of_buffered_values;
+		     buffered_value_index++ )
+		{
+			if( libesedb_page_tree_key_free(
+			     &( ( *long_value_cursor )->buffered_keys[ buffered_value_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free buffered key: %d.",
+				 function,
+				 buffered_value_index );
+
+				result = -1;
+			}
+			if( libesedb_data_definition_free(
+			     &( ( *long_value_cursor )->buffered_data_definitions[ buffered_value_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free buffered data definition: %d.",
+				 function,
+				 buffered_value_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 ( *long_value_cursor )->buffered_data_definitions );
+
+		memory_free(
+		 ( *long_value_cursor )->buffered_keys );
+
+		memory_free(
+		 *long_value_cursor );
+
+		*long_value_cursor = NULL;
+	}
+	return( result );
+}
+
+/* Sets the current leaf value
+ * The cursor takes over management of the key and data definition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_cursor_set_position(
+     libesedb_long_value_cursor_t *long_value_cursor,
+     libesedb_page_tree_key_t *key,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_long_value_cursor_set_position";
+
+	if( long_value_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_key_free(
+	     &( long_value_cursor->key ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_data_definition_free(
+	     &( long_value_cursor->data_definition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free data definition.",
+		 function );
+
+		return( -1 );
+	}
+	long_value_cursor->key             = key;
+	long_value_cursor->data_definition = data_definition;
+
+	return( 1 );
+}
+
+/* Appends a buffered long value
+ * The oldest buffered long value is replaced if the buffer is full
+ * The cursor takes over management of the key and data definition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_cursor_append_buffered_value(
+     libesedb_long_value_cursor_t *long_value_cursor,
+     libesedb_page_tree_key_t *key,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error )
+{
+	static char *function    = "libesedb_long_value_cursor_append_buffered_value";
+	int buffered_value_index = 0;
+
+	if( long_value_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value cursor.",
+		 function );
+
+		return( -1 );
+	}
+	buffered_value_index = long_value_cursor->next_buffered_value_index;
+
+	if( libesedb_page_tree_key_free(
+	     &( long_value_cursor->buffered_keys[ buffered_value_index ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free buffered key: %d.",
+		 function,
+		 buffered_value_index );
+
+		return( -1 );
+	}
+	if( libesedb_data_definition_free(
+	     &( long_value_cursor->buffered_data_definitions[ buffered_value_index ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free buffered data definition: %d.",
+		 function,
+		 buffered_value_index );
+
+		return( -1 );
+	}
+	long_value_cursor->buffered_keys[ buffered_value_index ]             = key;
+	long_value_cursor->buffered_data_definitions[ buffered_value_index ] = data_definition;
+
+	long_value_cursor->next_buffered_value_index = ( buffered_value_index + 1 ) % long_value_cursor->maximum_number_of_buffered_values;
+
+	return( 1 );
+}
+
+/* Retrieves a buffered long value for the specific key
+ * The buffered long value is removed from the buffer
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_long_value_cursor_get_buffered_value_by_key(
+     libesedb_long_value_cursor_t *long_value_cursor,
+     libesedb_page_tree_key_t *key,
+     libesedb_data_definition_t **data_definition,
+     libcerror_error_t **error )
+{
+	static char *function    = "libesedb_long_value_cursor_get_buffered_value_by_key";
+	int buffered_value_index = 0;
+	int compare_result       = 0;
+
+	if( long_value_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	for( buffered_value_index = 0;
+	     buffered_value_index < long_value_cursor->maximum_number_of_buffered_values;
+	     buffered_value_index++ )
+	{
+		if( long_value_cursor->buffered_keys[ buffered_value_index ] == NULL )
+		{
+			continue;
+		}
+		compare_result = libesedb_page_tree_key_compare(
+		                  key,
+		                  long_value_cursor->buffered_keys[ buffered_value_index ],
+		                  error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare key with buffered key: %d.",
+			 function,
+			 buffered_value_index );
+
+			return( -1 );
+		}
+		if( compare_result == LIBFDATA_COMPARE_EQUAL )
+		{
+			if( libesedb_page_tree_key_free(
+			     &( long_value_cursor->buffered_keys[ buffered_value_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free buffered key: %d.",
+				 function,
+				 buffered_value_index );
+
+				return( -1 );
+			}
+			*data_definition = long_value_cursor->buffered_data_definitions[ buffered_value_index ];
+
+			long_value_cursor->buffered_data_definitions[ buffered_value_index ] = NULL;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the leaf value of a long value for the specific key
+ *
+ * The long values are stored in the long values page tree in key order,
+ * when they are requested in (approximately) the same order the leaf values
+ * can be read sequentially by following the leaf page chain. Long values that
+ * are skipped are buffered so they can be retrieved without descending
+ * the page tree when they are requested out of order
+ *
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_long_value_cursor_get_leaf_value_by_key(
+     libesedb_long_value_cursor_t *long_value_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_tree_key_t *key,
+     libesedb_data_definition_t **data_definition,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *buffered_data_definition = NULL;
+	libesedb_data_definition_t *leaf_data_definition     = NULL;
+	libesedb_page_tree_key_t *buffered_key               = NULL;
+	libesedb_page_tree_key_t *leaf_key                   = NULL;
+	static char *function                                = "libesedb_long_value_cursor_get_leaf_value_by_key";
+	size_t key_data_index                                = 0;
+	int compare_result                                   = 0;
+	int number_of_skipped_values                         = 0;
+	int result                                           = 0;
+
+	if( long_value_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key->type != LIBESEDB_KEY_TYPE_LONG_VALUE )
+	 || ( key->data == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported key.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_definition != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data definition value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( long_value_cursor->data_definition != NULL )
+	{
+		result = libesedb_long_value_cursor_get_buffered_value_by_key(
+		          long_value_cursor,
+		          key,
+		          data_definition,
+		          error );
+
+		if( result != 0 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve buffered value.",
+				 function );
+			}
+			return( result );
+		}
+		compare_result = libesedb_page_tree_key_compare(
+		                  key,
+		                  long_value_cursor->key,
+		                  error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare key with current leaf value key.",
+			 function );
+
+			goto on_error;
+		}
+		/* Walk the leaf page chain as long as the long value is ahead
+		 * of the current leaf value and the skipped long values fit in the buffer
+		 */
+		while( ( compare_result == LIBFDATA_COMPARE_GREATER )
+		    && ( number_of_skipped_values < long_value_cursor->maximum_number_of_buffered_values ) )
+		{
+			result = libesedb_page_tree_get_next_leaf_value(
+			          long_value_cursor->page_tree,
+			          file_io_handle,
+			          long_value_cursor->data_definition,
+			          &leaf_key,
+			          &leaf_data_definition,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next leaf value.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			if( libesedb_long_value_cursor_set_position(
+			     long_value_cursor,
+			     leaf_key,
+			     leaf_data_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set current leaf value.",
+				 function );
+
+				goto on_error;
+			}
+			leaf_key             = NULL;
+			leaf_data_definition = NULL;
+
+			compare_result = libesedb_page_tree_key_compare(
+			                  key,
+			                  long_value_cursor->key,
+			                  error );
+
+			if( compare_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare key with current leaf value key.",
+				 function );
+
+				goto on_error;
+			}
+			/* Only buffer the skipped long values, not the long value segments
+			 */
+			if( ( compare_result == LIBFDATA_COMPARE_GREATER )
+			 && ( long_value_cursor->key->data_size == key->data_size ) )
+			{
+				if( libesedb_page_tree_key_clone(
+				     &buffered_key,
+				     long_value_cursor->key,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create buffered key.",
+					 function );
+
+					goto on_error;
+				}
+				if( libesedb_data_definition_clone(
+				     &buffered_data_definition,
+				     long_value_cursor->data_definition,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create buffered data definition.",
+					 function );
+
+					goto on_error;
+				}
+				if( libesedb_long_value_cursor_append_buffered_value(
+				     long_value_cursor,
+				     buffered_key,
+				     buffered_data_definition,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append buffered value.",
+					 function );
+
+					goto on_error;
+				}
+				buffered_key             = NULL;
+				buffered_data_definition = NULL;
+
+				number_of_skipped_values++;
+			}
+		}
+		if( compare_result == LIBFDATA_COMPARE_EQUAL )
+		{
+			if( libesedb_data_definition_clone(
+			     data_definition,
+			     long_value_cursor->data_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create data definition.",
+				 function );
+
+				goto on_error;
+			}
+			return( 1 );
+		}
+	}
+	/* The long value is behind the current leaf value, too far ahead or no
+	 * position was set, descend the page tree and continue from there
+	 */
+	result = libesedb_page_tree_get_leaf_value_by_key(
+	          long_value_cursor->page_tree,
+	          file_io_handle,
+	          key,
+	          &leaf_data_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value by key.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	/* The long value key is stored reversed in the leaf value key
+	 */
+	if( libesedb_page_tree_key_clone(
+	     &leaf_key,
+	     key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create leaf key.",
+		 function );
+
+		goto on_error;
+	}
+	for( key_data_index = 0;
+	     key_data_index < key->data_size;
+	     key_data_index++ )
+	{
+		leaf_key->data[ key_data_index ] = key->data[ key->data_size - key_data_index - 1 ];
+	}
+	leaf_key->type = LIBESEDB_KEY_TYPE_LEAF;
+
+	if( libesedb_data_definition_clone(
+	     data_definition,
+	     leaf_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data definition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_long_value_cursor_set_position(
+	     long_value_cursor,
+	     leaf_key,
+	     leaf_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set current leaf value.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 data_definition,
+		 NULL );
+	}
+	if( buffered_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &buffered_data_definition,
+		 NULL );
+	}
+	if( buffered_key != NULL )
+	{
+		libesedb_page_tree_key_free(
+		 &buffered_key,
+		 NULL );
+	}
+	if( leaf_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &leaf_data_definition,
+		 NULL );
+	}
+	if( leaf_key != NULL )
+	{
+		libesedb_page_tree_key_free(
+		 &leaf_key,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,111 @@
+/*
+ * Long value cursor functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_LONG_VALUE_CURSOR_H )
+#define _LIBESEDB_LONG_VALUE_CURSOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_data_definition.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_page_tree.h"
+#include "libesedb_page_tree_key.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_long_value_cursor libesedb_long_value_cursor_t;
+
+struct libesedb_long_value_cursor
+{
+	/* The long values page tree
+	 */
+	libesedb_page_tree_t *page_tree;
+
+	/* The key of the current leaf value
+	 */
+	libesedb_page_tree_key_t *key;
+
+	/* The data definition of the current leaf value
+	 */
+	libesedb_data_definition_t *data_definition;
+
+	/* The keys of the buffered long values
+	 */
+	libesedb_page_tree_key_t **buffered_keys;
+
+	/* The data definitions of the buffered long values
+	 */
+	libesedb_data_definition_t **buffered_data_definitions;
+
+	/* The maximum number of buffered long values
+	 */
+	int maximum_number_of_buffered_values;
+
+	/* The index of the next buffered long value to replace
+	 */
+	int next_buffered_value_index;
+};
+
+int libesedb_long_value_cursor_initialize(
+     libesedb_long_value_cursor_t **long_value_cursor,
+     libesedb_page_tree_t *page_tree,
+     int maximum_number_of_buffered_values,
+     libcerror_error_t **error );
+
+int libesedb_long_value_cursor_free(
+     libesedb_long_value_cursor_t **long_value_cursor,
+     libcerror_error_t **error );
+
+int libesedb_long_value_cursor_set_position(
+     libesedb_long_value_cursor_t *long_value_cursor,
+     libesedb_page_tree_key_t *key,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error );
+
+int libesedb_long_value_cursor_append_buffered_value(
+     libesedb_long_value_cursor_t *long_value_cursor,
+     libesedb_page_tree_key_t *key,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error );
+
+int libesedb_long_value_cursor_get_buffered_value_by_key(
+     libesedb_long_value_cursor_t *long_value_cursor,
+     libesedb_page_tree_key_t *key,
+     libesedb_data_definition_t **data_definition,
+     libcerror_error_t **error );
+
+int libesedb_long_value_cursor_get_leaf_value_by_key(
+     libesedb_long_value_cursor_t *long_value_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_tree_key_t *key,
+     libesedb_data_definition_t **data_definition,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_LONG_VALUE_CURSOR_H ) */
+
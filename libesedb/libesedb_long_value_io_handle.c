@@ -0,0 +1,518 @@
+/*
+ * Long value IO handle functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_libbfio.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_long_value.h"
+#include "libesedb_long_value_io_handle.h"
+#include "libesedb_unused.h"
+
+/* Creates a long value IO handle
+ * Make sure the value long_value_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_io_handle_initialize(
+     libesedb_long_value_io_handle_t **long_value_io_handle,
+     libesedb_long_value_t *long_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_long_value_io_handle_initialize";
+
+	if( long_value_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *long_value_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid long value IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	*long_value_io_handle = memory_allocate_structure(
+	                         libesedb_long_value_io_handle_t );
+
+	if( *long_value_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create long value IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *long_value_io_handle,
+	     0,
+	     sizeof( libesedb_long_value_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear long value IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *long_value_io_handle )->long_value = long_value;
+
+	return( 1 );
+
+on_error:
+	if( *long_value_io_handle != NULL )
+	{
+		memory_free(
+		 *long_value_io_handle );
+
+		*long_value_io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a long value IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_io_handle_free(
+     libesedb_long_value_io_handle_t **long_value_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_long_value_io_handle_free";
+
+	if( long_value_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *long_value_io_handle != NULL )
+	{
+		/* The long_value reference is freed elsewhere
+		 */
+		memory_free(
+		 *long_value_io_handle );
+
+		*long_value_io_handle = NULL;
+	}
+	return( 1 );
+}
+
+/* Clones (duplicates) the long value IO handle and its attributes
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_io_handle_clone(
+     libesedb_long_value_io_handle_t **destination_long_value_io_handle,
+     libesedb_long_value_io_handle_t *source_long_value_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_long_value_io_handle_clone";
+
+	if( destination_long_value_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination long value IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_long_value_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: destination long value IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_long_value_io_handle == NULL )
+	{
+		*destination_long_value_io_handle = NULL;
+
+		return( 1 );
+	}
+	if( libesedb_long_value_io_handle_initialize(
+	     destination_long_value_io_handle,
+	     source_long_value_io_handle->long_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create long value IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the long value IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_io_handle_open(
+     libesedb_long_value_io_handle_t *long_value_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_long_value_io_handle_open";
+
+	if( long_value_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	long_value_io_handle->current_offset = 0;
+	long_value_io_handle->access_flags   = access_flags;
+
+	return( 1 );
+}
+
+/* Closes the long value IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int libesedb_long_value_io_handle_close(
+     libesedb_long_value_io_handle_t *long_value_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_long_value_io_handle_close";
+
+	if( long_value_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	long_value_io_handle->access_flags = 0;
+
+	return( 0 );
+}
+
+/* Reads a buffer from the long value IO handle
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libesedb_long_value_io_handle_read(
+         libesedb_long_value_io_handle_t *long_value_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libesedb_long_value_io_handle_read";
+	ssize_t read_count    = 0;
+
+	if( long_value_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The long value offset is shared by all handles, hence every read
+	 * is done at the offset of this handle
+	 */
+	read_count = libesedb_long_value_read_buffer_at_offset(
+	              long_value_io_handle->long_value,
+	              buffer,
+	              size,
+	              long_value_io_handle->current_offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer from long value.",
+		 function );
+
+		return( -1 );
+	}
+	long_value_io_handle->current_offset += (off64_t) read_count;
+
+	return( read_count );
+}
+
+/* Writes a buffer to the long value IO handle
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libesedb_long_value_io_handle_write(
+         libesedb_long_value_io_handle_t *long_value_io_handle,
+         const uint8_t *buffer LIBESEDB_ATTRIBUTE_UNUSED,
+         size_t size LIBESEDB_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	static char *function = "libesedb_long_value_io_handle_write";
+
+	LIBESEDB_UNREFERENCED_PARAMETER( buffer )
+	LIBESEDB_UNREFERENCED_PARAMETER( size )
+
+	if( long_value_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: write access currently not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Seeks a certain offset within the long value IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libesedb_long_value_io_handle_seek_offset(
+         libesedb_long_value_io_handle_t *long_value_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libesedb_long_value_io_handle_seek_offset";
+	size64_t size         = 0;
+
+	if( long_value_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += long_value_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		if( libesedb_long_value_get_size(
+		     long_value_io_handle->long_value,
+		     &size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve long value size.",
+			 function );
+
+			return( -1 );
+		}
+		offset += (off64_t) size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	long_value_io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if the long value exists
+ * Returns 1 if the long value exists, 0 if not or -1 on error
+ */
+int libesedb_long_value_io_handle_exists(
+     libesedb_long_value_io_handle_t *long_value_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_long_value_io_handle_exists";
+
+	if( long_value_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( long_value_io_handle->long_value == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Check if the long value IO handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libesedb_long_value_io_handle_is_open(
+     libesedb_long_value_io_handle_t *long_value_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_long_value_io_handle_is_open";
+
+	if( long_value_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( long_value_io_handle->access_flags == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the long value
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_io_handle_get_size(
+     libesedb_long_value_io_handle_t *long_value_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_long_value_io_handle_get_size";
+
+	if( long_value_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_long_value_get_size(
+	     long_value_io_handle->long_value,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve long value size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,111 @@
+/*
+ * Long value IO handle functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_LONG_VALUE_IO_HANDLE_H )
+#define _LIBESEDB_LONG_VALUE_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+#include "libesedb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_long_value_io_handle libesedb_long_value_io_handle_t;
+
+struct libesedb_long_value_io_handle
+{
+	/* The long value
+	 */
+	libesedb_long_value_t *long_value;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The access flags
+	 */
+	int access_flags;
+};
+
+int libesedb_long_value_io_handle_initialize(
+     libesedb_long_value_io_handle_t **long_value_io_handle,
+     libesedb_long_value_t *long_value,
+     libcerror_error_t **error );
+
+int libesedb_long_value_io_handle_free(
+     libesedb_long_value_io_handle_t **long_value_io_handle,
+     libcerror_error_t **error );
+
+int libesedb_long_value_io_handle_clone(
+     libesedb_long_value_io_handle_t **destination_long_value_io_handle,
+     libesedb_long_value_io_handle_t *source_long_value_io_handle,
+     libcerror_error_t **error );
+
+int libesedb_long_value_io_handle_open(
+     libesedb_long_value_io_handle_t *long_value_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libesedb_long_value_io_handle_close(
+     libesedb_long_value_io_handle_t *long_value_io_handle,
+     libcerror_error_t **error );
+
+ssize_t libesedb_long_value_io_handle_read(
+         libesedb_long_value_io_handle_t *long_value_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libesedb_long_value_io_handle_write(
+         libesedb_long_value_io_handle_t *long_value_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libesedb_long_value_io_handle_seek_offset(
+         libesedb_long_value_io_handle_t *long_value_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libesedb_long_value_io_handle_exists(
+     libesedb_long_value_io_handle_t *long_value_io_handle,
+     libcerror_error_t **error );
+
+int libesedb_long_value_io_handle_is_open(
+     libesedb_long_value_io_handle_t *long_value_io_handle,
+     libcerror_error_t **error );
+
+int libesedb_long_value_io_handle_get_size(
+     libesedb_long_value_io_handle_t *long_value_io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_LONG_VALUE_IO_HANDLE_H ) */
+
@@ -0,0 +1,643 @@
+/*
+ * Name hash table functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+#include "libesedb_name_hash_table.h"
+
+/* The name hash is a 32-bit FNV-1a hash of the ASCII characters in the name,
+ * where upper case characters are folded to lower case if case folding is used.
+ * Non-ASCII characters are not part of the hash so that a name in the (ASCII) codepage
+ * of the catalog and the same name as an UTF-8 or UTF-16 string map onto the same hash.
+ * Since different names can map onto the same hash a lookup must compare the names
+ * of the entries that share a hash.
+ */
+#define LIBESEDB_NAME_HASH_TABLE_HASH_INITIAL_VALUE	0x811c9dc5UL
+#define LIBESEDB_NAME_HASH_TABLE_HASH_PRIME		0x01000193UL
+
+#define LIBESEDB_NAME_HASH_TABLE_HASH_UPDATE( hash, character, use_case_folding ) \
+	if( ( character ) < 0x80 ) \
+	{ \
+		if( ( ( use_case_folding ) != 0 ) \
+		 && ( ( character ) >= (uint8_t) 'A' ) \
+		 && ( ( character ) <= (uint8_t) 'Z' ) ) \
+		{ \
+			hash ^= (uint32_t) ( character ) + 0x20; \
+		} \
+		else \
+		{ \
+			hash ^= (uint32_t) ( character ); \
+		} \
+		hash *= LIBESEDB_NAME_HASH_TABLE_HASH_PRIME; \
+	}
+
+/* Creates a name hash table
+ * Make sure the value name_hash_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_name_hash_table_initialize(
+     libesedb_name_hash_table_t **name_hash_table,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_name_hash_table_initialize";
+	int number_of_buckets = 16;
+
+	if( name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_hash_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid name hash table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries <= 0 )
+	 || ( (size_t) number_of_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( int ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use at least 2 buckets per entry to keep the chains short
+	 */
+	while( ( number_of_buckets / 2 ) < number_of_entries )
+	{
+		number_of_buckets *= 2;
+	}
+	*name_hash_table = memory_allocate_structure(
+	                    libesedb_name_hash_table_t );
+
+	if( *name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *name_hash_table,
+	     0,
+	     sizeof( libesedb_name_hash_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear name hash table.",
+		 function );
+
+		memory_free(
+		 *name_hash_table );
+
+		*name_hash_table = NULL;
+
+		return( -1 );
+	}
+	( *name_hash_table )->buckets = (int *) memory_allocate(
+	                                         sizeof( int ) * number_of_buckets );
+
+	if( ( *name_hash_table )->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *name_hash_table )->buckets,
+	     0,
+	     sizeof( int ) * number_of_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		goto on_error;
+	}
+	( *name_hash_table )->next_entries = (int *) memory_allocate(
+	                                              sizeof( int ) * number_of_entries );
+
+	if( ( *name_hash_table )->next_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create next entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *name_hash_table )->next_entries,
+	     0,
+	     sizeof( int ) * number_of_entries ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear next entries.",
+		 function );
+
+		goto on_error;
+	}
+	( *name_hash_table )->number_of_buckets = number_of_buckets;
+	( *name_hash_table )->number_of_entries = number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( *name_hash_table != NULL )
+	{
+		if( ( *name_hash_table )->next_entries != NULL )
+		{
+			memory_free(
+			 ( *name_hash_table )->next_entries );
+		}
+		if( ( *name_hash_table )->buckets != NULL )
+		{
+			memory_free(
+			 ( *name_hash_table )->buckets );
+		}
+		memory_free(
+		 *name_hash_table );
+
+		*name_hash_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a name hash table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_name_hash_table_free(
+     libesedb_name_hash_table_t **name_hash_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_name_hash_table_free";
+
+	if( name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_hash_table != NULL )
+	{
+		if( ( *name_hash_table )->next_entries != NULL )
+		{
+			memory_free(
+			 ( *name_hash_table )->next_entries );
+		}
+		if( ( *name_hash_table )->buckets != NULL )
+		{
+			memory_free(
+			 ( *name_hash_table )->buckets );
+		}
+		memory_free(
+		 *name_hash_table );
+
+		*name_hash_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Calculates the name hash of a byte stream
+ * The byte stream is terminated by the first end-of-string character if any
+ * If use_case_folding is set upper case ASCII characters are folded to lower case
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_name_hash_table_calculate_hash_from_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint8_t use_case_folding,
+     uint32_t *hash,
+     libcerror_error_t **error )
+{
+	static char *function     = "libesedb_name_hash_table_calculate_hash_from_byte_stream";
+	size_t byte_stream_index  = 0;
+	uint32_t safe_hash        = LIBESEDB_NAME_HASH_TABLE_HASH_INITIAL_VALUE;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	for( byte_stream_index = 0;
+	     byte_stream_index < byte_stream_size;
+	     byte_stream_index++ )
+	{
+		if( byte_stream[ byte_stream_index ] == 0 )
+		{
+			break;
+		}
+		LIBESEDB_NAME_HASH_TABLE_HASH_UPDATE(
+		 safe_hash,
+		 byte_stream[ byte_stream_index ],
+		 use_case_folding )
+	}
+	*hash = safe_hash;
+
+	return( 1 );
+}
+
+/* Calculates the name hash of an UTF-8 string
+ * The string is terminated by the first end-of-string character if any
+ * If use_case_folding is set upper case ASCII characters are folded to lower case
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_name_hash_table_calculate_hash_from_utf8_string(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint8_t use_case_folding,
+     uint32_t *hash,
+     libcerror_error_t **error )
+{
+	static char *function    = "libesedb_name_hash_table_calculate_hash_from_utf8_string";
+	size_t utf8_string_index = 0;
+	uint32_t safe_hash       = LIBESEDB_NAME_HASH_TABLE_HASH_INITIAL_VALUE;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	for( utf8_string_index = 0;
+	     utf8_string_index < utf8_string_length;
+	     utf8_string_index++ )
+	{
+		if( utf8_string[ utf8_string_index ] == 0 )
+		{
+			break;
+		}
+		LIBESEDB_NAME_HASH_TABLE_HASH_UPDATE(
+		 safe_hash,
+		 utf8_string[ utf8_string_index ],
+		 use_case_folding )
+	}
+	*hash = safe_hash;
+
+	return( 1 );
+}
+
+/* Calculates the name hash of an UTF-16 string
+ * The string is terminated by the first end-of-string character if any
+ * If use_case_folding is set upper case ASCII characters are folded to lower case
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_name_hash_table_calculate_hash_from_utf16_string(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint8_t use_case_folding,
+     uint32_t *hash,
+     libcerror_error_t **error )
+{
+	static char *function     = "libesedb_name_hash_table_calculate_hash_from_utf16_string";
+	size_t utf16_string_index = 0;
+	uint32_t safe_hash        = LIBESEDB_NAME_HASH_TABLE_HASH_INITIAL_VALUE;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	for( utf16_string_index = 0;
+	     utf16_string_index < utf16_string_length;
+	     utf16_string_index++ )
+	{
+		if( utf16_string[ utf16_string_index ] == 0 )
+		{
+			break;
+		}
+		LIBESEDB_NAME_HASH_TABLE_HASH_UPDATE(
+		 safe_hash,
+		 utf16_string[ utf16_string_index ],
+		 use_case_folding )
+	}
+	*hash = safe_hash;
+
+	return( 1 );
+}
+
+/* Sets an entry in the name hash table
+ * The entry is inserted in front of the entries with the same bucket,
+ * hence entries should be set in reverse order to retrieve them in order
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_name_hash_table_set_entry(
+     libesedb_name_hash_table_t *name_hash_table,
+     int entry_index,
+     uint32_t hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_name_hash_table_set_entry";
+	int bucket_index      = 0;
+
+	if( name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_hash_table->buckets == NULL )
+	 || ( name_hash_table->next_entries == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid name hash table - missing buckets or next entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= name_hash_table->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = (int) ( hash & (uint32_t) ( name_hash_table->number_of_buckets - 1 ) );
+
+	name_hash_table->next_entries[ entry_index ] = name_hash_table->buckets[ bucket_index ];
+	name_hash_table->buckets[ bucket_index ]     = entry_index + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the first entry with a specific hash
+ * Note that the entry can have a different hash that maps onto the same bucket
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libesedb_name_hash_table_get_first_entry_index(
+     libesedb_name_hash_table_t *name_hash_table,
+     uint32_t hash,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_name_hash_table_get_first_entry_index";
+	int bucket_index      = 0;
+
+	if( name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_hash_table->buckets == NULL )
+	 || ( name_hash_table->next_entries == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid name hash table - missing buckets or next entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = (int) ( hash & (uint32_t) ( name_hash_table->number_of_buckets - 1 ) );
+
+	if( name_hash_table->buckets[ bucket_index ] == 0 )
+	{
+		return( 0 );
+	}
+	*entry_index = name_hash_table->buckets[ bucket_index ] - 1;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the next entry with the same hash bucket
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libesedb_name_hash_table_get_next_entry_index(
+     libesedb_name_hash_table_t *name_hash_table,
+     int entry_index,
+     int *next_entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_name_hash_table_get_next_entry_index";
+
+	if( name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_hash_table->buckets == NULL )
+	 || ( name_hash_table->next_entries == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid name hash table - missing buckets or next entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= name_hash_table->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash_table->next_entries[ entry_index ] == 0 )
+	{
+		return( 0 );
+	}
+	*next_entry_index = name_hash_table->next_entries[ entry_index ] - 1;
+
+	return( 1 );
+}
+
@@ -0,0 +1,108 @@
+/*
+ * Name hash table functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_NAME_HASH_TABLE_H )
+#define _LIBESEDB_NAME_HASH_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_name_hash_table libesedb_name_hash_table_t;
+
+struct libesedb_name_hash_table
+{
+	/* The number of buckets, which is a power of 2
+	 */
+	int number_of_buckets;
+
+	/* The buckets, contains the first entry index + 1 or 0 if empty
+	 */
+	int *buckets;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The next entries, contains the next entry index + 1 or 0 if last
+	 */
+	int *next_entries;
+};
+
+int libesedb_name_hash_table_initialize(
+     libesedb_name_hash_table_t **name_hash_table,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int libesedb_name_hash_table_free(
+     libesedb_name_hash_table_t **name_hash_table,
+     libcerror_error_t **error );
+
+int libesedb_name_hash_table_calculate_hash_from_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint8_t use_case_folding,
+     uint32_t *hash,
+     libcerror_error_t **error );
+
+int libesedb_name_hash_table_calculate_hash_from_utf8_string(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint8_t use_case_folding,
+     uint32_t *hash,
+     libcerror_error_t **error );
+
+int libesedb_name_hash_table_calculate_hash_from_utf16_string(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint8_t use_case_folding,
+     uint32_t *hash,
+     libcerror_error_t **error );
+
+int libesedb_name_hash_table_set_entry(
+     libesedb_name_hash_table_t *name_hash_table,
+     int entry_index,
+     uint32_t hash,
+     libcerror_error_t **error );
+
+int libesedb_name_hash_table_get_first_entry_index(
+     libesedb_name_hash_table_t *name_hash_table,
+     uint32_t hash,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libesedb_name_hash_table_get_next_entry_index(
+     libesedb_name_hash_table_t *name_hash_table,
+     int entry_index,
+     int *next_entry_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_NAME_HASH_TABLE_H ) */
+
@@ -28,10 +28,10 @@
 #include "libesedb_debug.h"
 #include "libesedb_definitions.h"
 #include "libesedb_libbfio.h"
-#include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
 #include "libesedb_page.h"
+#include "libesedb_page_buffer_pool.h"
 #include "libesedb_page_header.h"
 #include "libesedb_page_value.h"
 
@@ -115,20 +115,6 @@ int libesedb_page_initialize(
 
 		goto on_error;
 	}
-	if( libcdata_array_initialize(
-	     &( ( *page )->values_array ),
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create values array.",
-		 function );
-
-		goto on_error;
-	}
 	return( 1 );
 
 on_error:
@@ -184,21 +170,30 @@ int libesedb_page_free(
 
 			result = -1;
 		}
-		if( libcdata_array_free(
-		     &( ( *page )->values_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_value_free,
-		     error ) != 1 )
+		if( ( *page )->values != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free values array.",
-			 function );
-
-			result = -1;
+			memory_free(
+			 ( *page )->values );
 		}
-		if( ( *page )->data != NULL )
+		if( ( *page )->page_buffer_pool != NULL )
+		{
+			if( libesedb_page_buffer_pool_release_buffer(
+			     ( *page )->page_buffer_pool,
+			     &( ( *page )->data ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release data.",
+				 function );
+
+				result = -1;
+			}
+		}
+		else if( ( ( *page )->data != NULL )
+		      && ( ( *page )->data_is_referenced == 0 ) )
 		{
 			memory_free(
 			 ( *page )->data );
@@ -340,6 +335,7 @@ int libesedb_page_read_tags(
      libcerror_error_t **error )
 {
 	libesedb_page_value_t *page_value = NULL;
+	libesedb_page_value_t *values     = NULL;
 	const uint8_t *page_tags_data     = NULL;
 	static char *function             = "libesedb_page_read_tags";
 	size_t page_tags_data_size        = 0;
@@ -417,20 +413,30 @@ int libesedb_page_read_tags(
 		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 	}
 #endif
-	if( libcdata_array_resize(
-	     page->values_array,
-	     number_of_page_tags,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_value_free,
-	     error ) != 1 )
+	page->number_of_values = 0;
+
+	/* The page values are stored in a single allocation that is reused
+	 * when the page is read again with the same or a smaller number of page tags
+	 */
+	if( number_of_page_tags > page->number_of_allocated_values )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable to resize page values array.",
-		 function );
+		values = (libesedb_page_value_t *) memory_reallocate(
+		                                    page->values,
+		                                    sizeof( libesedb_page_value_t ) * number_of_page_tags );
 
-		goto on_error;
+		if( values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize page values.",
+			 function );
+
+			goto on_error;
+		}
+		page->values                     = values;
+		page->number_of_allocated_values = number_of_page_tags;
 	}
 	/* Read the page tags back to front
 	 */
@@ -440,19 +446,10 @@ int libesedb_page_read_tags(
 	     page_tags_index < number_of_page_tags;
 	     page_tags_index++ )
 	{
-		if( libesedb_page_value_initialize(
-		     &page_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create page value.",
-			 function );
+		page_value = &( page->values[ page_tags_index ] );
+
+		page_value->data = NULL;
 
-			goto on_error;
-		}
 		byte_stream_copy_to_uint16_little_endian(
 		 page_tags_data,
 		 page_tag_offset );
@@ -511,24 +508,9 @@ int libesedb_page_read_tags(
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-		if( libcdata_array_set_entry_by_index(
-		     page->values_array,
-		     (int) page_tags_index,
-		     (intptr_t *) page_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set page value: %" PRIu16 ".",
-			 function,
-			 page_tags_index );
-
-			goto on_error;
-		}
-		page_value = NULL;
 	}
+	page->number_of_values = number_of_page_tags;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -539,16 +521,7 @@ int libesedb_page_read_tags(
 	return( 1 );
 
 on_error:
-	if( page_value != NULL )
-	{
-		libesedb_page_value_free(
-		 &page_value,
-		 NULL );
-	}
-	libcdata_array_empty(
-	 page->values_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_value_free,
-	 NULL );
+	page->number_of_values = 0;
 
 	return( -1 );
 }
@@ -633,6 +606,8 @@ int libesedb_page_read_values(
 	}
 	number_of_page_tags = page->header->available_page_tag;
 
+	page->number_of_values = 0;
+
 	if( number_of_page_tags == 0 )
 	{
 		return( 1 );
@@ -689,33 +664,8 @@ int libesedb_page_read_values(
 	     page_tags_index < number_of_page_tags;
 	     page_tags_index++ )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     page->values_array,
-		     page_tags_index,
-		     (intptr_t **) &page_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve page value: %" PRIu16 ".",
-			 function,
-			 page_tags_index );
-
-			goto on_error;
-		}
-		if( page_value == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-			 "%s: invalid page value.",
-			 function );
+		page_value = &( page->values[ page_tags_index ] );
 
-			goto on_error;
-		}
 		if( page_value->offset >= page_values_data_size )
 		{
 			libcerror_error_set(
@@ -826,10 +776,7 @@ int libesedb_page_read_values(
 	return( 1 );
 
 on_error:
-	libcdata_array_empty(
-	 page->values_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_value_free,
-	 NULL );
+	page->number_of_values = 0;
 
 	return( -1 );
 }
@@ -899,19 +846,67 @@ int libesedb_page_read_file_io_handle(
 	}
 #endif
 
-	page->data = (uint8_t *) memory_allocate(
-	                          (size_t) io_handle->page_size );
+	/* If the file was opened from memory the page data references the memory data.
+	 * The page values of large pages are modified when read, hence these are copied.
+	 */
+	if( ( io_handle->memory_data != NULL )
+	 && ( ( io_handle->format_revision < LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+	  || ( io_handle->page_size < 16384 ) ) )
+	{
+		if( ( file_offset < 0 )
+		 || ( (size64_t) file_offset > (size64_t) io_handle->memory_data_size )
+		 || ( (size_t) io_handle->page_size > ( io_handle->memory_data_size - (size_t) file_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file offset value out of bounds.",
+			 function );
 
-	if( page->data == NULL )
+			goto on_error;
+		}
+		page->data               = (uint8_t *) &( io_handle->memory_data[ file_offset ] );
+		page->data_is_referenced = 1;
+	}
+	/* Page data is taken from the page buffer pool so that the buffers of
+	 * evicted pages are reused
+	 */
+	else if( ( io_handle->page_buffer_pool != NULL )
+	 && ( io_handle->page_buffer_pool->buffer_size == (size_t) io_handle->page_size ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create page data.",
-		 function );
+		if( libesedb_page_buffer_pool_get_buffer(
+		     io_handle->page_buffer_pool,
+		     &( page->data ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page data from page buffer pool.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		page->page_buffer_pool = io_handle->page_buffer_pool;
+	}
+	else
+	{
+		page->data = (uint8_t *) memory_allocate(
+		                          (size_t) io_handle->page_size );
+
+		if( page->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create page data.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	page->data_size = (size_t) io_handle->page_size;
 
@@ -926,26 +921,29 @@ int libesedb_page_read_file_io_handle(
 		 page->offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              page->data,
-	              page->data_size,
-	              page->offset,
-	              error );
-
-	if( read_count != (ssize_t) page->data_size )
+	if( page->data_is_referenced == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read page: %" PRIu32 " data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 page->page_number,
-		 page->offset,
-		 page->offset );
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              page->data,
+		              page->data_size,
+		              page->offset,
+		              error );
 
-		goto on_error;
+		if( read_count != (ssize_t) page->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page: %" PRIu32 " data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 page->page_number,
+			 page->offset,
+			 page->offset );
+
+			goto on_error;
+		}
 	}
 	if( libesedb_page_header_read_data(
 	     page->header,
@@ -1054,7 +1052,21 @@ int libesedb_page_read_file_io_handle(
 	return( 1 );
 
 on_error:
-	if( page->data != NULL )
+	if( page->page_buffer_pool != NULL )
+	{
+		libesedb_page_buffer_pool_release_buffer(
+		 page->page_buffer_pool,
+		 &( page->data ),
+		 NULL );
+
+		page->page_buffer_pool = NULL;
+	}
+	else if( page->data_is_referenced != 0 )
+	{
+		page->data               = NULL;
+		page->data_is_referenced = 0;
+	}
+	else if( page->data != NULL )
 	{
 		memory_free(
 		 page->data );
@@ -1571,8 +1583,7 @@ int libesedb_page_get_number_of_values(
      uint16_t *number_of_values,
      libcerror_error_t **error )
 {
-	static char *function     = "libesedb_page_get_number_of_values";
-	int page_number_of_values = 0;
+	static char *function = "libesedb_page_get_number_of_values";
 
 	if( page == NULL )
 	{
@@ -1596,32 +1607,7 @@ int libesedb_page_get_number_of_values(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     page->values_array,
-	     &page_number_of_values,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of values.",
-		 function );
-
-		return( -1 );
-	}
-	if( page_number_of_values > (int) UINT16_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid number of page values value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	*number_of_values = (uint16_t) page_number_of_values;
+	*number_of_values = page->number_of_values;
 
 	return( 1 );
 }
@@ -1648,22 +1634,30 @@ int libesedb_page_get_value_by_index(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     page->values_array,
-	     (int) value_index,
-	     (intptr_t **) page_value,
-	     error ) != 1 )
+	if( value_index >= page->number_of_values )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve page value: %" PRIu16 ".",
-		 function,
-		 value_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value index value out of bounds.",
+		 function );
 
 		return( -1 );
 	}
+	if( page_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page value.",
+		 function );
+
+		return( -1 );
+	}
+	*page_value = &( page->values[ value_index ] );
+
 	return( 1 );
 }
 
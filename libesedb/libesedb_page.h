@@ -29,6 +29,7 @@
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
+#include "libesedb_page_buffer_pool.h"
 #include "libesedb_page_header.h"
 #include "libesedb_page_value.h"
 
@@ -60,9 +61,25 @@ struct libesedb_page
 	 */
 	size_t data_size;
 
-	/* The values array
+	/* The page buffer pool the data was taken from
 	 */
-	libcdata_array_t *values_array;
+	libesedb_page_buffer_pool_t *page_buffer_pool;
+
+	/* Value to indicate the data references the memory data of the IO handle
+	 */
+	uint8_t data_is_referenced;
+
+	/* The values
+	 */
+	libesedb_page_value_t *values;
+
+	/* The number of values
+	 */
+	uint16_t number_of_values;
+
+	/* The number of allocated values
+	 */
+	uint16_t number_of_allocated_values;
 };
 
 int libesedb_page_initialize(
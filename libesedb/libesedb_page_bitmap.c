@@ -0,0 +1,283 @@
+/*
+ * Page bitmap functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_definitions.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_page_bitmap.h"
+
+/* Creates a page bitmap
+ * Make sure the value page_bitmap is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_bitmap_initialize(
+     libesedb_page_bitmap_t **page_bitmap,
+     uint32_t maximum_page_number,
+     libcerror_error_t **error )
+{
+	static char *function     = "libesedb_page_bitmap_initialize";
+	size_t chunks_size        = 0;
+	uint32_t number_of_chunks = 0;
+
+	if( page_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_bitmap != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page bitmap value already set.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_chunks = ( maximum_page_number / LIBESEDB_PAGE_BITMAP_NUMBER_OF_PAGES_PER_CHUNK ) + 1;
+
+	chunks_size = sizeof( uint8_t * ) * number_of_chunks;
+
+	*page_bitmap = memory_allocate_structure(
+	                libesedb_page_bitmap_t );
+
+	if( *page_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *page_bitmap,
+	     0,
+	     sizeof( libesedb_page_bitmap_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page bitmap.",
+		 function );
+
+		memory_free(
+		 *page_bitmap );
+
+		*page_bitmap = NULL;
+
+		return( -1 );
+	}
+	( *page_bitmap )->chunks = (uint8_t **) memory_allocate(
+	                                         chunks_size );
+
+	if( ( *page_bitmap )->chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *page_bitmap )->chunks,
+	     0,
+	     chunks_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunks.",
+		 function );
+
+		goto on_error;
+	}
+	( *page_bitmap )->maximum_page_number = maximum_page_number;
+	( *page_bitmap )->number_of_chunks    = number_of_chunks;
+
+	return( 1 );
+
+on_error:
+	if( *page_bitmap != NULL )
+	{
+		if( ( *page_bitmap )->chunks != NULL )
+		{
+			memory_free(
+			 ( *page_bitmap )->chunks );
+		}
+		memory_free(
+		 *page_bitmap );
+
+		*page_bitmap = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a page bitmap
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_bitmap_free(
+     libesedb_page_bitmap_t **page_bitmap,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_bitmap_free";
+	uint32_t chunk_index  = 0;
+
+	if( page_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_bitmap != NULL )
+	{
+		for( chunk_index = 0;
+		     chunk_index < ( *page_bitmap )->number_of_chunks;
+		     chunk_index++ )
+		{
+			if( ( *page_bitmap )->chunks[ chunk_index ] != NULL )
+			{
+				memory_free(
+				 ( *page_bitmap )->chunks[ chunk_index ] );
+			}
+		}
+		memory_free(
+		 ( *page_bitmap )->chunks );
+
+		memory_free(
+		 *page_bitmap );
+
+		*page_bitmap = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the bit of a page number
+ * Returns 1 if successful, 0 if the bit was already set or -1 on error
+ */
+int libesedb_page_bitmap_set_page_number(
+     libesedb_page_bitmap_t *page_bitmap,
+     uint32_t page_number,
+     libcerror_error_t **error )
+{
+	uint8_t *chunk        = NULL;
+	static char *function = "libesedb_page_bitmap_set_page_number";
+	uint32_t bit_index    = 0;
+	uint32_t chunk_index  = 0;
+	uint8_t bit_mask      = 0;
+
+	if( page_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_number > page_bitmap->maximum_page_number )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_index = page_number / LIBESEDB_PAGE_BITMAP_NUMBER_OF_PAGES_PER_CHUNK;
+	bit_index   = page_number % LIBESEDB_PAGE_BITMAP_NUMBER_OF_PAGES_PER_CHUNK;
+
+	chunk = page_bitmap->chunks[ chunk_index ];
+
+	if( chunk == NULL )
+	{
+		chunk = (uint8_t *) memory_allocate(
+		                     LIBESEDB_PAGE_BITMAP_NUMBER_OF_PAGES_PER_CHUNK / 8 );
+
+		if( chunk == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunk: %" PRIu32 ".",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     chunk,
+		     0,
+		     LIBESEDB_PAGE_BITMAP_NUMBER_OF_PAGES_PER_CHUNK / 8 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear chunk: %" PRIu32 ".",
+			 function,
+			 chunk_index );
+
+			memory_free(
+			 chunk );
+
+			return( -1 );
+		}
+		page_bitmap->chunks[ chunk_index ] = chunk;
+	}
+	bit_mask = (uint8_t) ( 1 << ( bit_index % 8 ) );
+
+	if( ( chunk[ bit_index / 8 ] & bit_mask ) != 0 )
+	{
+		return( 0 );
+	}
+	chunk[ bit_index / 8 ] |= bit_mask;
+
+	return( 1 );
+}
+
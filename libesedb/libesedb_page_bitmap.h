@@ -0,0 +1,72 @@
+/*
+ * Page bitmap functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_PAGE_BITMAP_H )
+#define _LIBESEDB_PAGE_BITMAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_page_bitmap libesedb_page_bitmap_t;
+
+struct libesedb_page_bitmap
+{
+	/* The maximum page number
+	 */
+	uint32_t maximum_page_number;
+
+	/* The chunks
+	 * Every chunk contains the bits of LIBESEDB_PAGE_BITMAP_NUMBER_OF_PAGES_PER_CHUNK pages
+	 * and is allocated when the first of its bits is set
+	 */
+	uint8_t **chunks;
+
+	/* The number of chunks
+	 */
+	uint32_t number_of_chunks;
+};
+
+int libesedb_page_bitmap_initialize(
+     libesedb_page_bitmap_t **page_bitmap,
+     uint32_t maximum_page_number,
+     libcerror_error_t **error );
+
+int libesedb_page_bitmap_free(
+     libesedb_page_bitmap_t **page_bitmap,
+     libcerror_error_t **error );
+
+int libesedb_page_bitmap_set_page_number(
+     libesedb_page_bitmap_t *page_bitmap,
+     uint32_t page_number,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_PAGE_BITMAP_H ) */
+
@@ -0,0 +1,395 @@
+/*
+ * Page buffer pool functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_definitions.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_page_buffer_pool.h"
+
+/* Creates a page buffer pool
+ * Make sure the value page_buffer_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_buffer_pool_initialize(
+     libesedb_page_buffer_pool_t **page_buffer_pool,
+     size_t buffer_size,
+     int maximum_number_of_buffers,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_buffer_pool_initialize";
+
+	if( page_buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_buffer_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page buffer pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBESEDB_PAGE_BUFFER_POOL_ALIGNMENT ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_buffers <= 0 )
+	 || ( (size_t) maximum_number_of_buffers > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint8_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of buffers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*page_buffer_pool = memory_allocate_structure(
+	                     libesedb_page_buffer_pool_t );
+
+	if( *page_buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page buffer pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *page_buffer_pool,
+	     0,
+	     sizeof( libesedb_page_buffer_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page buffer pool.",
+		 function );
+
+		memory_free(
+		 *page_buffer_pool );
+
+		*page_buffer_pool = NULL;
+
+		return( -1 );
+	}
+	( *page_buffer_pool )->buffers = (uint8_t **) memory_allocate(
+	                                               sizeof( uint8_t * ) * maximum_number_of_buffers );
+
+	if( ( *page_buffer_pool )->buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffers.",
+		 function );
+
+		goto on_error;
+	}
+	( *page_buffer_pool )->buffer_size               = buffer_size;
+	( *page_buffer_pool )->maximum_number_of_buffers = maximum_number_of_buffers;
+
+	return( 1 );
+
+on_error:
+	if( *page_buffer_pool != NULL )
+	{
+		memory_free(
+		 *page_buffer_pool );
+
+		*page_buffer_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a page buffer pool
+ * If buffers of the pool are still in use the pool is detached instead
+ * and freed when the last buffer is released
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_buffer_pool_free(
+     libesedb_page_buffer_pool_t **page_buffer_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_buffer_pool_free";
+	int buffer_index      = 0;
+
+	if( page_buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_buffer_pool != NULL )
+	{
+		for( buffer_index = 0;
+		     buffer_index < ( *page_buffer_pool )->number_of_buffers;
+		     buffer_index++ )
+		{
+			libesedb_page_buffer_pool_free_aligned_buffer(
+			 ( *page_buffer_pool )->buffers[ buffer_index ] );
+		}
+		memory_free(
+		 ( *page_buffer_pool )->buffers );
+
+		( *page_buffer_pool )->buffers           = NULL;
+		( *page_buffer_pool )->number_of_buffers = 0;
+
+		if( ( *page_buffer_pool )->number_of_used_buffers > 0 )
+		{
+			( *page_buffer_pool )->is_detached = 1;
+		}
+		else
+		{
+			memory_free(
+			 *page_buffer_pool );
+		}
+		*page_buffer_pool = NULL;
+	}
+	return( 1 );
+}
+
+/* Allocates a buffer aligned to LIBESEDB_PAGE_BUFFER_POOL_ALIGNMENT
+ * The distance to the start of the allocation is stored in the byte before the aligned buffer
+ * Returns a pointer to the aligned buffer or NULL on error
+ */
+uint8_t *libesedb_page_buffer_pool_allocate_aligned_buffer(
+          size_t buffer_size )
+{
+	uint8_t *allocated_buffer = NULL;
+	size_t alignment_padding  = 0;
+
+	allocated_buffer = (uint8_t *) memory_allocate(
+	                                buffer_size + LIBESEDB_PAGE_BUFFER_POOL_ALIGNMENT );
+
+	if( allocated_buffer == NULL )
+	{
+		return( NULL );
+	}
+	alignment_padding = LIBESEDB_PAGE_BUFFER_POOL_ALIGNMENT - (size_t) ( (intptr_t) allocated_buffer % LIBESEDB_PAGE_BUFFER_POOL_ALIGNMENT );
+
+	allocated_buffer[ alignment_padding - 1 ] = (uint8_t) alignment_padding;
+
+	return( &( allocated_buffer[ alignment_padding ] ) );
+}
+
+/* Frees a buffer allocated by libesedb_page_buffer_pool_allocate_aligned_buffer
+ */
+void libesedb_page_buffer_pool_free_aligned_buffer(
+      uint8_t *buffer )
+{
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer - buffer[ -1 ] );
+	}
+}
+
+/* Retrieves a buffer from the pool
+ * An unused buffer is reused or a new buffer is allocated if none is available
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_buffer_pool_get_buffer(
+     libesedb_page_buffer_pool_t *page_buffer_pool,
+     uint8_t **buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_buffer_pool_get_buffer";
+
+	if( page_buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_buffer_pool->is_detached != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page buffer pool - pool is detached.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_buffer_pool->number_of_used_buffers == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid page buffer pool - number of used buffers value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_buffer_pool->number_of_buffers > 0 )
+	{
+		page_buffer_pool->number_of_buffers -= 1;
+
+		*buffer = page_buffer_pool->buffers[ page_buffer_pool->number_of_buffers ];
+	}
+	else
+	{
+		*buffer = libesedb_page_buffer_pool_allocate_aligned_buffer(
+		           page_buffer_pool->buffer_size );
+
+		if( *buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	page_buffer_pool->number_of_used_buffers += 1;
+
+	return( 1 );
+}
+
+/* Releases a buffer back to the pool
+ * The buffer is freed if the pool is full or detached
+ * A detached pool is freed when its last buffer is released
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_buffer_pool_release_buffer(
+     libesedb_page_buffer_pool_t *page_buffer_pool,
+     uint8_t **buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_buffer_pool_release_buffer";
+
+	if( page_buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer == NULL )
+	{
+		return( 1 );
+	}
+	if( page_buffer_pool->number_of_used_buffers <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page buffer pool - number of used buffers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	page_buffer_pool->number_of_used_buffers -= 1;
+
+	if( ( page_buffer_pool->is_detached == 0 )
+	 && ( page_buffer_pool->number_of_buffers < page_buffer_pool->maximum_number_of_buffers ) )
+	{
+		page_buffer_pool->buffers[ page_buffer_pool->number_of_buffers ] = *buffer;
+
+		page_buffer_pool->number_of_buffers += 1;
+	}
+	else
+	{
+		libesedb_page_buffer_pool_free_aligned_buffer(
+		 *buffer );
+	}
+	*buffer = NULL;
+
+	if( ( page_buffer_pool->is_detached != 0 )
+	 && ( page_buffer_pool->number_of_used_buffers == 0 ) )
+	{
+		memory_free(
+		 page_buffer_pool );
+	}
+	return( 1 );
+}
+
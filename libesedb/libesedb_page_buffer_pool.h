@@ -0,0 +1,95 @@
+/*
+ * Page buffer pool functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_PAGE_BUFFER_POOL_H )
+#define _LIBESEDB_PAGE_BUFFER_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_page_buffer_pool libesedb_page_buffer_pool_t;
+
+struct libesedb_page_buffer_pool
+{
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The unused buffers
+	 */
+	uint8_t **buffers;
+
+	/* The number of unused buffers
+	 */
+	int number_of_buffers;
+
+	/* The maximum number of unused buffers
+	 */
+	int maximum_number_of_buffers;
+
+	/* The number of buffers in use
+	 */
+	int number_of_used_buffers;
+
+	/* Value to indicate the pool was freed by its owner
+	 * while buffers were still in use
+	 */
+	uint8_t is_detached;
+};
+
+int libesedb_page_buffer_pool_initialize(
+     libesedb_page_buffer_pool_t **page_buffer_pool,
+     size_t buffer_size,
+     int maximum_number_of_buffers,
+     libcerror_error_t **error );
+
+int libesedb_page_buffer_pool_free(
+     libesedb_page_buffer_pool_t **page_buffer_pool,
+     libcerror_error_t **error );
+
+uint8_t *libesedb_page_buffer_pool_allocate_aligned_buffer(
+          size_t buffer_size );
+
+void libesedb_page_buffer_pool_free_aligned_buffer(
+      uint8_t *buffer );
+
+int libesedb_page_buffer_pool_get_buffer(
+     libesedb_page_buffer_pool_t *page_buffer_pool,
+     uint8_t **buffer,
+     libcerror_error_t **error );
+
+int libesedb_page_buffer_pool_release_buffer(
+     libesedb_page_buffer_pool_t *page_buffer_pool,
+     uint8_t **buffer,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_PAGE_BUFFER_POOL_H ) */
+
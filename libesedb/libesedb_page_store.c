@@ -0,0 +1,327 @@
+/*
+ * Page store functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_definitions.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libfcache.h"
+#include "libesedb_page.h"
+#include "libesedb_page_store.h"
+
+/* Retrieves a page by its page number
+ * The page is looked up directly in the pages cache, the cache entry index
+ * and the page offset are derived from the page number
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_store_get_page_by_number(
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfcache_cache_t *pages_cache,
+     uint32_t page_number,
+     libesedb_page_t **page,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *safe_page           = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libesedb_page_store_get_page_by_number";
+	off64_t cache_value_offset           = 0;
+	off64_t page_offset                  = 0;
+	int64_t cache_value_timestamp        = 0;
+	int cache_entry_index                = 0;
+	int cache_value_file_index           = 0;
+	int number_of_cache_entries          = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->page_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing page size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_number == 0 )
+	 || ( page_number > io_handle->last_page_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_get_number_of_entries(
+	     pages_cache,
+	     &number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_cache_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of cache entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The page number is relative to the start of the page data
+	 * that starts after the (shadow) file header
+	 */
+	page_offset = ( (off64_t) page_number + 1 ) * io_handle->page_size;
+
+	cache_entry_index = (int) ( ( page_number - 1 ) % (uint32_t) number_of_cache_entries );
+
+	if( libfcache_cache_get_value_by_index(
+	     pages_cache,
+	     cache_entry_index,
+	     &cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value: %d.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( cache_value != NULL )
+	{
+		if( libfcache_cache_value_get_identifier(
+		     cache_value,
+		     &cache_value_file_index,
+		     &cache_value_offset,
+		     &cache_value_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value identifier.",
+			 function );
+
+			return( -1 );
+		}
+		/* Pages are stored with timestamp 0 which is never used by a vector
+		 */
+		if( ( cache_value_file_index == 0 )
+		 && ( cache_value_offset == page_offset )
+		 && ( cache_value_timestamp == 0 ) )
+		{
+			if( libfcache_cache_value_get_value(
+			     cache_value,
+			     (intptr_t **) &safe_page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page from cache value.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( safe_page == NULL )
+	{
+		if( libesedb_page_initialize(
+		     &safe_page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create page.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_page_read_file_io_handle(
+		     safe_page,
+		     io_handle,
+		     file_io_handle,
+		     page_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		if( libfcache_cache_set_value_by_index(
+		     pages_cache,
+		     cache_entry_index,
+		     0,
+		     page_offset,
+		     0,
+		     (intptr_t *) safe_page,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_free,
+		     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set page in cache entry: %d.",
+			 function,
+			 cache_entry_index );
+
+			goto on_error;
+		}
+	}
+	*page = safe_page;
+
+	return( 1 );
+
+on_error:
+	if( safe_page != NULL )
+	{
+		libesedb_page_free(
+		 &safe_page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a page by its offset relative to the start of the page data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_store_get_page_at_offset(
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfcache_cache_t *pages_cache,
+     off64_t page_offset,
+     libesedb_page_t **page,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_store_get_page_at_offset";
+	uint32_t page_number  = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->page_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing page size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_offset < 0 )
+	 || ( (size64_t) page_offset >= ( (size64_t) io_handle->last_page_number * io_handle->page_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	page_number = (uint32_t) ( page_offset / io_handle->page_size ) + 1;
+
+	if( libesedb_page_store_get_page_by_number(
+	     io_handle,
+	     file_io_handle,
+	     pages_cache,
+	     page_number,
+	     page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -1,5 +1,5 @@
 /*
- * Block descriptor functions
+ * Page store functions
  *
  * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
  *
@@ -19,38 +19,41 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#if !defined( _LIBESEDB_BLOCK_DESCRIPTOR_H )
-#define _LIBESEDB_BLOCK_DESCRIPTOR_H
+#if !defined( _LIBESEDB_PAGE_STORE_H )
+#define _LIBESEDB_PAGE_STORE_H
 
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_io_handle.h"
+#include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
+#include "libesedb_libfcache.h"
+#include "libesedb_page.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
-typedef struct libesedb_block_descriptor libesedb_block_descriptor_t;
-
-struct libesedb_block_descriptor
-{
-	/* The page number
-	 */
-	uint32_t page_number;
-};
-
-int libesedb_block_descriptor_initialize(
-     libesedb_block_descriptor_t **block_descriptor,
+int libesedb_page_store_get_page_by_number(
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfcache_cache_t *pages_cache,
+     uint32_t page_number,
+     libesedb_page_t **page,
      libcerror_error_t **error );
 
-int libesedb_block_descriptor_free(
-     libesedb_block_descriptor_t **block_descriptor,
+int libesedb_page_store_get_page_at_offset(
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfcache_cache_t *pages_cache,
+     off64_t page_offset,
+     libesedb_page_t **page,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
 }
 #endif
 
-#endif /* !defined( _LIBESEDB_BLOCK_DESCRIPTOR_H ) */
+#endif /* !defined( _LIBESEDB_PAGE_STORE_H ) */
 
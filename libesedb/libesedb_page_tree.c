@@ -24,9 +24,6 @@
 #include <memory.h>
 #include <types.h>
 
-#include "libesedb_block_descriptor.h"
-#include "libesedb_block_tree.h"
-#include "libesedb_block_tree_node.h"
 #include "libesedb_data_definition.h"
 #include "libesedb_debug.h"
 #include "libesedb_definitions.h"
@@ -38,6 +35,7 @@
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_page.h"
+#include "libesedb_page_store.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_page_tree_key.h"
 #include "libesedb_page_tree_value.h"
@@ -148,17 +146,16 @@ int libesedb_page_tree_initialize(
 
 		return( -1 );
 	}
-	if( libesedb_block_tree_initialize(
-	     &( ( *page_tree )->page_block_tree ),
-	     io_handle->file_size,
-	     io_handle->page_size,
+	if( libesedb_page_bitmap_initialize(
+	     &( ( *page_tree )->page_bitmap ),
+	     io_handle->last_page_number,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create page block tree.",
+		 "%s: unable to create page bitmap.",
 		 function );
 
 		goto on_error;
@@ -191,11 +188,10 @@ int libesedb_page_tree_initialize(
 on_error:
 	if( *page_tree != NULL )
 	{
-		if( ( *page_tree )->page_block_tree != NULL )
+		if( ( *page_tree )->page_bitmap != NULL )
 		{
-			libesedb_block_tree_free(
-			 &( ( *page_tree )->page_block_tree ),
-			 (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_block_descriptor_free,
+			libesedb_page_bitmap_free(
+			 &( ( *page_tree )->page_bitmap ),
 			 NULL );
 		}
 		memory_free(
@@ -262,16 +258,15 @@ int libesedb_page_tree_free(
 
 			result = -1;
 		}
-		if( libesedb_block_tree_free(
-		     &( ( *page_tree )->page_block_tree ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_block_descriptor_free,
+		if( libesedb_page_bitmap_free(
+		     &( ( *page_tree )->page_bitmap ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free page block tree.",
+			 "%s: unable to free page bitmap.",
 			 function );
 
 			result = -1;
@@ -289,17 +284,12 @@ int libesedb_page_tree_free(
  */
 int libesedb_page_tree_check_if_page_block_first_read(
      libesedb_page_tree_t *page_tree,
-     libesedb_block_tree_t *page_block_tree,
+     libesedb_page_bitmap_t *page_bitmap,
      uint32_t page_number,
-     off64_t page_offset,
      libcerror_error_t **error )
 {
-	libesedb_block_descriptor_t *existing_block_descriptor = NULL;
-	libesedb_block_descriptor_t *new_block_descriptor      = NULL;
-	libesedb_block_tree_node_t *leaf_block_tree_node       = NULL;
-	static char *function                                  = "libesedb_page_tree_check_if_page_block_first_read";
-	int leaf_value_index                                   = 0;
-	int result                                             = 0;
+	static char *function = "libesedb_page_tree_check_if_page_block_first_read";
+	int result            = 0;
 
 	if( page_tree == NULL )
 	{
@@ -312,28 +302,9 @@ int libesedb_page_tree_check_if_page_block_first_read(
 
 		return( -1 );
 	}
-	if( libesedb_block_descriptor_initialize(
-	     &new_block_descriptor,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create block descriptor.",
-		 function );
-
-		goto on_error;
-	}
-	new_block_descriptor->page_number = page_number;
-
-	result = libesedb_block_tree_insert_block_descriptor_by_offset(
-	          page_block_tree,
-	          page_offset,
-	          new_block_descriptor,
-	          &leaf_value_index,
-	          &leaf_block_tree_node,
-	          &existing_block_descriptor,
+	result = libesedb_page_bitmap_set_page_number(
+	          page_bitmap,
+	          page_number,
 	          error );
 
 	if( result == -1 )
@@ -341,11 +312,12 @@ int libesedb_page_tree_check_if_page_block_first_read(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to insert block descriptor in page block tree.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set page number: %" PRIu32 " in page bitmap.",
+		 function,
+		 page_number );
 
-		goto on_error;
+		return( -1 );
 	}
 	else if( result == 0 )
 	{
@@ -357,20 +329,9 @@ int libesedb_page_tree_check_if_page_block_first_read(
 		 function,
 		 page_number );
 
-		goto on_error;
+		return( -1 );
 	}
-	new_block_descriptor = NULL;
-
 	return( 1 );
-
-on_error:
-	if( new_block_descriptor != NULL )
-	{
-		libesedb_block_descriptor_free(
-		 &new_block_descriptor,
-		 NULL );
-	}
-	return( -1 );
 }
 
 /* Reads the root page header
@@ -1180,13 +1141,12 @@ int libesedb_page_tree_get_first_leaf_page_number_from_page(
 		if( ( child_page_number > 0 )
 		 && ( child_page_number <= page_tree->io_handle->last_page_number ) )
 		{
-			if( libfdata_vector_get_element_value_by_index(
-			     page_tree->pages_vector,
-			     (intptr_t *) file_io_handle,
-			     (libfdata_cache_t *) page_tree->pages_cache,
-			     (int) child_page_number - 1,
-			     (intptr_t **) &child_page,
-			     0,
+			if( libesedb_page_store_get_page_by_number(
+			     page_tree->io_handle,
+			     file_io_handle,
+			     page_tree->pages_cache,
+			     child_page_number,
+			     &child_page,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -1277,7 +1237,6 @@ int libesedb_page_tree_get_get_first_leaf_page_number(
 {
 	libesedb_page_t *page          = NULL;
 	static char *function          = "libesedb_page_tree_get_get_first_leaf_page_number";
-	off64_t page_offset            = 0;
 	uint32_t last_leaf_page_number = 0;
 	uint32_t page_flags            = 0;
 	uint32_t safe_leaf_page_number = 0;
@@ -1315,13 +1274,12 @@ int libesedb_page_tree_get_get_first_leaf_page_number(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_by_index(
-	     page_tree->pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) page_tree->pages_cache,
-	     (int) page_tree->root_page_number - 1,
-	     (intptr_t **) &page,
-	     0,
+	if( libesedb_page_store_get_page_by_number(
+	     page_tree->io_handle,
+	     file_io_handle,
+	     page_tree->pages_cache,
+	     page_tree->root_page_number,
+	     &page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1419,13 +1377,10 @@ int libesedb_page_tree_get_get_first_leaf_page_number(
 	}
 	while( safe_leaf_page_number != 0 )
 	{
-		page_offset = ( safe_leaf_page_number + 1 ) * page_tree->io_handle->page_size;
-
 		if( libesedb_page_tree_check_if_page_block_first_read(
 		     page_tree,
-		     page_tree->page_block_tree,
+		     page_tree->page_bitmap,
 		     safe_leaf_page_number,
-		     page_offset,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1453,13 +1408,12 @@ int libesedb_page_tree_get_get_first_leaf_page_number(
 
 			return( -1 );
 		}
-		if( libfdata_vector_get_element_value_by_index(
-		     page_tree->pages_vector,
-		     (intptr_t *) file_io_handle,
-		     (libfdata_cache_t *) page_tree->pages_cache,
-		     (int) safe_leaf_page_number - 1,
-		     (intptr_t **) &page,
-		     0,
+		if( libesedb_page_store_get_page_by_number(
+		     page_tree->io_handle,
+		     file_io_handle,
+		     page_tree->pages_cache,
+		     safe_leaf_page_number,
+		     &page,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1673,6 +1627,123 @@ int libesedb_page_tree_get_number_of_leaf_values_from_leaf_page(
 	return( 1 );
 }
 
+/* Sets the leaf page descriptors of the page tree
+ * This function is used to seed the page tree with leaf page descriptors read from a catalog cache
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_set_leaf_page_descriptors(
+     libesedb_page_tree_t *page_tree,
+     libesedb_leaf_page_descriptor_t *leaf_page_descriptors,
+     int number_of_leaf_page_descriptors,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *upper_node                               = NULL;
+	libesedb_leaf_page_descriptor_t *existing_leaf_page_descriptor = NULL;
+	libesedb_leaf_page_descriptor_t *leaf_page_descriptor          = NULL;
+	static char *function                                          = "libesedb_page_tree_set_leaf_page_descriptors";
+	int leaf_page_descriptor_index                                 = 0;
+	int value_index                                                = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->number_of_leaf_values != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page tree - number of leaf values value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_page_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf page descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_leaf_page_descriptors <= 0 )
+	 || ( number_of_leaf_page_descriptors > LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of leaf page descriptors value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( leaf_page_descriptor_index = 0;
+	     leaf_page_descriptor_index < number_of_leaf_page_descriptors;
+	     leaf_page_descriptor_index++ )
+	{
+		if( libesedb_leaf_page_descriptor_initialize(
+		     &leaf_page_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create leaf page descriptor.",
+			 function );
+
+			goto on_error;
+		}
+		leaf_page_descriptor->page_number            = leaf_page_descriptors[ leaf_page_descriptor_index ].page_number;
+		leaf_page_descriptor->first_leaf_value_index = leaf_page_descriptors[ leaf_page_descriptor_index ].first_leaf_value_index;
+		leaf_page_descriptor->last_leaf_value_index  = leaf_page_descriptors[ leaf_page_descriptor_index ].last_leaf_value_index;
+
+		if( libcdata_btree_insert_value(
+		     page_tree->leaf_page_descriptors_tree,
+		     &value_index,
+		     (intptr_t *) leaf_page_descriptor,
+		     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libesedb_leaf_page_descriptor_compare,
+		     &upper_node,
+		     (intptr_t **) &existing_leaf_page_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable insert leaf page descriptor into tree.",
+			 function );
+
+			goto on_error;
+		}
+		leaf_page_descriptor = NULL;
+	}
+	page_tree->number_of_leaf_values = leaf_page_descriptors[ number_of_leaf_page_descriptors - 1 ].last_leaf_value_index + 1;
+
+	return( 1 );
+
+on_error:
+	if( leaf_page_descriptor != NULL )
+	{
+		libesedb_leaf_page_descriptor_free(
+		 &leaf_page_descriptor,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Determines the number of leaf values
  * Returns 1 if successful or -1 on error
  */
@@ -1715,6 +1786,31 @@ int libesedb_page_tree_get_number_of_leaf_values(
 
 		return( -1 );
 	}
+	/* The leaf page descriptors of a table page tree can be provided by a catalog cache
+	 */
+	if( ( page_tree->number_of_leaf_values == -1 )
+	 && ( page_tree->table_definition != NULL )
+	 && ( page_tree->table_definition->leaf_page_descriptors != NULL )
+	 && ( page_tree->table_definition->table_catalog_definition != NULL )
+	 && ( page_tree->object_identifier == page_tree->table_definition->table_catalog_definition->identifier )
+	 && ( page_tree->root_page_number == page_tree->table_definition->table_catalog_definition->father_data_page_number ) )
+	{
+		if( libesedb_page_tree_set_leaf_page_descriptors(
+		     page_tree,
+		     page_tree->table_definition->leaf_page_descriptors,
+		     page_tree->table_definition->number_of_leaf_page_descriptors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set leaf page descriptors.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( page_tree->number_of_leaf_values == -1 )
 	{
 		page_tree->number_of_leaf_values = 0;
@@ -1762,13 +1858,12 @@ int libesedb_page_tree_get_number_of_leaf_values(
 
 				goto on_error;
 			}
-			if( libfdata_vector_get_element_value_by_index(
-			     page_tree->pages_vector,
-			     (intptr_t *) file_io_handle,
-			     (libfdata_cache_t *) page_tree->pages_cache,
-			     (int) leaf_page_number - 1,
-			     (intptr_t **) &page,
-			     0,
+			if( libesedb_page_store_get_page_by_number(
+			     page_tree->io_handle,
+			     file_io_handle,
+			     page_tree->pages_cache,
+			     leaf_page_number,
+			     &page,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -2225,13 +2320,12 @@ int libesedb_page_tree_get_leaf_value_by_index_from_page(
 			if( ( child_page_number > 0 )
 			 && ( child_page_number <= page_tree->io_handle->last_page_number ) )
 			{
-				if( libfdata_vector_get_element_value_by_index(
-				     page_tree->pages_vector,
-				     (intptr_t *) file_io_handle,
-				     (libfdata_cache_t *) child_page_cache,
-				     (int) child_page_number - 1,
-				     (intptr_t **) &child_page,
-				     0,
+				if( libesedb_page_store_get_page_by_number(
+				     page_tree->io_handle,
+				     file_io_handle,
+				     child_page_cache,
+				     child_page_number,
+				     &child_page,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -2494,13 +2588,12 @@ int libesedb_page_tree_get_leaf_value_by_index(
 
 		goto on_error;
 	}
-	if( libfdata_vector_get_element_value_by_index(
-	     page_tree->pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) base_page_cache,
-	     (int) base_page_number - 1,
-	     (intptr_t **) &base_page,
-	     0,
+	if( libesedb_page_store_get_page_by_number(
+	     page_tree->io_handle,
+	     file_io_handle,
+	     base_page_cache,
+	     base_page_number,
+	     &base_page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2962,13 +3055,12 @@ int libesedb_page_tree_get_leaf_value_by_key_from_page(
 			if( ( child_page_number > 0 )
 			 && ( child_page_number <= page_tree->io_handle->last_page_number ) )
 			{
-				if( libfdata_vector_get_element_value_by_index(
-				     page_tree->pages_vector,
-				     (intptr_t *) file_io_handle,
-				     (libfdata_cache_t *) child_page_cache,
-				     (int) child_page_number - 1,
-				     (intptr_t **) &child_page,
-				     0,
+				if( libesedb_page_store_get_page_by_number(
+				     page_tree->io_handle,
+				     file_io_handle,
+				     child_page_cache,
+				     child_page_number,
+				     &child_page,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -3135,13 +3227,12 @@ int libesedb_page_tree_get_leaf_value_by_key(
 
 		goto on_error;
 	}
-	if( libfdata_vector_get_element_value_by_index(
-	     page_tree->pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) root_page_cache,
-	     (int) page_tree->root_page_number - 1,
-	     (intptr_t **) &root_page,
-	     0,
+	if( libesedb_page_store_get_page_by_number(
+	     page_tree->io_handle,
+	     file_io_handle,
+	     root_page_cache,
+	     page_tree->root_page_number,
+	     &root_page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3232,6 +3323,378 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the leaf value that follows a specific leaf value in key order
+ * The leaf value is read from the same leaf page or by following the next page number
+ * of the leaf pages, which avoids a descent of the tree from the root page
+ * This function creates a new key and data definition
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_page_tree_get_next_leaf_value(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_data_definition_t *data_definition,
+     libesedb_page_tree_key_t **next_leaf_value_key,
+     libesedb_data_definition_t **next_data_definition,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page                       = NULL;
+	libesedb_page_tree_key_t *page_value_key    = NULL;
+	libesedb_page_tree_value_t *page_tree_value = NULL;
+	libesedb_page_value_t *page_value           = NULL;
+	static char *function                       = "libesedb_page_tree_get_next_leaf_value";
+	uint32_t number_of_leaf_pages               = 0;
+	uint32_t page_flags                         = 0;
+	uint32_t page_number                        = 0;
+	uint16_t data_offset                        = 0;
+	uint16_t number_of_page_values              = 0;
+	uint16_t page_value_index                   = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_leaf_value_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next leaf value key.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *next_leaf_value_key != NULL )
+	 || ( *next_data_definition != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid next leaf value key or data definition value already set.",
+		 function );
+
+		return( -1 );
+	}
+	page_number      = data_definition->page_number;
+	page_value_index = data_definition->page_value_index + 1;
+
+	while( page_number != 0 )
+	{
+		/* Guard against a loop in the leaf page chain
+		 */
+		if( number_of_leaf_pages > page_tree->io_handle->last_page_number )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of leaf pages value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_leaf_pages++;
+
+#if ( SIZEOF_INT <= 4 )
+		if( ( page_number > page_tree->io_handle->last_page_number )
+		 || ( page_number > (uint32_t) INT_MAX ) )
+#else
+		if( ( page_number > page_tree->io_handle->last_page_number )
+		 || ( (int) page_number > INT_MAX ) )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid page number value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_page_store_get_page_by_number(
+		     page_tree->io_handle,
+		     file_io_handle,
+		     page_tree->pages_cache,
+		     page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		if( libesedb_page_validate_page(
+		     page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported page.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_page_get_flags(
+		     page,
+		     &page_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page flags.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported page: %" PRIu32 " - not a leaf page.",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		if( libesedb_page_get_number_of_values(
+		     page,
+		     &number_of_page_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of page values.",
+			 function );
+
+			goto on_error;
+		}
+		while( page_value_index < number_of_page_values )
+		{
+			if( libesedb_page_get_value_by_index(
+			     page,
+			     page_value_index,
+			     &page_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			if( page_value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) == 0 )
+			{
+				break;
+			}
+			page_value_index++;
+		}
+		if( page_value_index < number_of_page_values )
+		{
+			if( libesedb_page_tree_value_initialize(
+			     &page_tree_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create page tree value.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_page_tree_value_read_data(
+			     page_tree_value,
+			     page_value->data,
+			     (size_t) page_value->size,
+			     page_value->flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read page tree value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			if( libesedb_page_tree_get_key(
+			     page_tree,
+			     page_tree_value,
+			     page,
+			     page_flags,
+			     page_value_index,
+			     &page_value_key,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve key of page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			if( libesedb_data_definition_initialize(
+			     next_data_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create data definition.",
+				 function );
+
+				goto on_error;
+			}
+			data_offset = page_value->offset + 2 + page_tree_value->local_key_size;
+
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
+			{
+				data_offset += 2;
+			}
+			( *next_data_definition )->page_value_index = page_value_index;
+			( *next_data_definition )->page_offset      = page->offset - ( 2 * page_tree->io_handle->page_size );
+			( *next_data_definition )->page_number      = page->page_number;
+			( *next_data_definition )->data_offset      = data_offset;
+			( *next_data_definition )->data_size        = page_tree_value->data_size;
+
+			if( libesedb_page_tree_value_free(
+			     &page_tree_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free page tree value.",
+				 function );
+
+				goto on_error;
+			}
+			*next_leaf_value_key = page_value_key;
+
+			return( 1 );
+		}
+		if( libesedb_page_get_next_page_number(
+		     page,
+		     &page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next page number.",
+			 function );
+
+			goto on_error;
+		}
+		/* The first page value contains the page header
+		 */
+		page_value_index = 1;
+	}
+	return( 0 );
+
+on_error:
+	if( *next_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 next_data_definition,
+		 NULL );
+	}
+	if( page_value_key != NULL )
+	{
+		libesedb_page_tree_key_free(
+		 &page_value_key,
+		 NULL );
+	}
+	if( page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &page_tree_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
 #ifdef TODO
 /* TODO refactor */
 
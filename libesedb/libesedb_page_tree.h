@@ -25,15 +25,16 @@
 #include <common.h>
 #include <types.h>
 
-#include "libesedb_block_tree.h"
 #include "libesedb_data_definition.h"
 #include "libesedb_io_handle.h"
+#include "libesedb_leaf_page_descriptor.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_page.h"
+#include "libesedb_page_bitmap.h"
 #include "libesedb_page_tree_key.h"
 #include "libesedb_page_tree_value.h"
 #include "libesedb_page_value.h"
@@ -52,9 +53,10 @@ struct libesedb_page_tree
 	 */
 	libesedb_io_handle_t *io_handle;
 
-	/* The page block tree
+	/* The page bitmap
+	 * Used to detect loops in the leaf page chain
 	 */
-	libesedb_block_tree_t *page_block_tree;
+	libesedb_page_bitmap_t *page_bitmap;
 
 	/* The object identifier
 	 */
@@ -110,9 +112,8 @@ int libesedb_page_tree_free(
 
 int libesedb_page_tree_check_if_page_block_first_read(
      libesedb_page_tree_t *page_tree,
-     libesedb_block_tree_t *page_block_tree,
+     libesedb_page_bitmap_t *page_bitmap,
      uint32_t page_number,
-     off64_t page_offset,
      libcerror_error_t **error );
 
 int libesedb_page_tree_read_root_page_header(
@@ -154,6 +155,12 @@ int libesedb_page_tree_get_number_of_leaf_values_from_leaf_page(
      int *number_of_leaf_values,
      libcerror_error_t **error );
 
+int libesedb_page_tree_set_leaf_page_descriptors(
+     libesedb_page_tree_t *page_tree,
+     libesedb_leaf_page_descriptor_t *leaf_page_descriptors,
+     int number_of_leaf_page_descriptors,
+     libcerror_error_t **error );
+
 int libesedb_page_tree_get_number_of_leaf_values(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
@@ -193,6 +200,14 @@ int libesedb_page_tree_get_leaf_value_by_key(
      libesedb_data_definition_t **data_definition,
      libcerror_error_t **error );
 
+int libesedb_page_tree_get_next_leaf_value(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_data_definition_t *data_definition,
+     libesedb_page_tree_key_t **next_leaf_value_key,
+     libesedb_data_definition_t **next_data_definition,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
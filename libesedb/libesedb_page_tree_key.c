@@ -138,6 +138,92 @@ int libesedb_page_tree_key_free(
 	return( 1 );
 }
 
+/* Clones a page tree key
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_key_clone(
+     libesedb_page_tree_key_t **destination_page_tree_key,
+     libesedb_page_tree_key_t *source_page_tree_key,
+     libcerror_error_t **error )
+{
+	libesedb_page_tree_key_t *safe_page_tree_key = NULL;
+	static char *function                        = "libesedb_page_tree_key_clone";
+
+	if( destination_page_tree_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination page tree key.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_page_tree_key != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination page tree key value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_page_tree_key == NULL )
+	{
+		*destination_page_tree_key = NULL;
+
+		return( 1 );
+	}
+	if( libesedb_page_tree_key_initialize(
+	     &safe_page_tree_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination page tree key.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_page_tree_key->data_size > 0 )
+	{
+		if( libesedb_page_tree_key_set_data(
+		     safe_page_tree_key,
+		     source_page_tree_key->data,
+		     source_page_tree_key->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set data in destination page tree key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	safe_page_tree_key->type = source_page_tree_key->type;
+
+	*destination_page_tree_key = safe_page_tree_key;
+
+	return( 1 );
+
+on_error:
+	if( safe_page_tree_key != NULL )
+	{
+		libesedb_page_tree_key_free(
+		 &safe_page_tree_key,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Sets data
  * Returns 1 if successful or -1 on error
  */
@@ -56,6 +56,11 @@ int libesedb_page_tree_key_free(
      libesedb_page_tree_key_t **page_tree_key,
      libcerror_error_t **error );
 
+int libesedb_page_tree_key_clone(
+     libesedb_page_tree_key_t **destination_page_tree_key,
+     libesedb_page_tree_key_t *source_page_tree_key,
+     libcerror_error_t **error );
+
 int libesedb_page_tree_key_set_data(
      libesedb_page_tree_key_t *page_tree_key,
      const uint8_t *data,
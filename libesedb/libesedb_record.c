@@ -19,6 +19,7 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <byte_stream.h>
 #include <common.h>
 #include <memory.h>
 #include <types.h>
@@ -26,6 +27,7 @@
 #include "libesedb_compression.h"
 #include "libesedb_data_definition.h"
 #include "libesedb_data_segment.h"
+#include "libesedb_data_segments_handle.h"
 #include "libesedb_definitions.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
@@ -36,6 +38,7 @@
 #include "libesedb_libfdata.h"
 #include "libesedb_libfvalue.h"
 #include "libesedb_long_value.h"
+#include "libesedb_long_value_cursor.h"
 #include "libesedb_multi_value.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_page_tree_key.h"
@@ -44,6 +47,8 @@
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
 
+#include "esedb_page_values.h"
+
 /* Creates a record
  * Make sure the value record is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -60,10 +65,14 @@ int libesedb_record_initialize(
      libfcache_cache_t *long_values_pages_cache,
      libesedb_data_definition_t *data_definition,
      libesedb_page_tree_t *long_values_page_tree,
+     libesedb_long_value_cursor_t *long_value_cursor,
      libcerror_error_t **error )
 {
 	libesedb_internal_record_t *internal_record = NULL;
+	uint8_t *record_data                        = NULL;
 	static char *function                       = "libesedb_record_initialize";
+	size_t record_data_size                     = 0;
+	size_t fixed_size_data_size                 = 0;
 
 	if( record == NULL )
 	{
@@ -175,6 +184,71 @@ int libesedb_record_initialize(
 
 		goto on_error;
 	}
+	/* The page of the record data was read by libesedb_data_definition_read_record
+	 * and is retrieved from the pages cache
+	 */
+	if( libesedb_data_definition_read_data(
+	     data_definition,
+	     file_io_handle,
+	     io_handle,
+	     pages_vector,
+	     pages_cache,
+	     &record_data,
+	     &record_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record data.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( record_data != NULL )
+	 && ( record_data_size >= sizeof( esedb_data_definition_header_t ) ) )
+	{
+		fixed_size_data_size = sizeof( esedb_data_definition_header_t ) + table_definition->fixed_size_values_size;
+
+		if( template_table_definition != NULL )
+		{
+			fixed_size_data_size += template_table_definition->fixed_size_values_size;
+		}
+		if( fixed_size_data_size < record_data_size )
+		{
+			record_data_size = fixed_size_data_size;
+		}
+		internal_record->fixed_size_data = (uint8_t *) memory_allocate(
+		                                                sizeof( uint8_t ) * record_data_size );
+
+		if( internal_record->fixed_size_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create fixed size data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     internal_record->fixed_size_data,
+		     record_data,
+		     record_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy fixed size data.",
+			 function );
+
+			goto on_error;
+		}
+		internal_record->fixed_size_data_size = record_data_size;
+	}
 	internal_record->file_io_handle            = file_io_handle;
 	internal_record->io_handle                 = io_handle;
 	internal_record->table_definition          = table_definition;
@@ -185,6 +259,7 @@ int libesedb_record_initialize(
 	internal_record->long_values_pages_cache   = long_values_pages_cache;
 	internal_record->data_definition           = data_definition;
 	internal_record->long_values_page_tree     = long_values_page_tree;
+	internal_record->long_value_cursor         = long_value_cursor;
 
 	*record = (libesedb_record_t *) internal_record;
 
@@ -193,6 +268,11 @@ int libesedb_record_initialize(
 on_error:
 	if( internal_record != NULL )
 	{
+		if( internal_record->fixed_size_data != NULL )
+		{
+			memory_free(
+			 internal_record->fixed_size_data );
+		}
 		if( internal_record->values_array != NULL )
 		{
 			/* Note that if libesedb_data_definition_read_record fails values_array
@@ -237,8 +317,8 @@ int libesedb_record_free(
 		*record         = NULL;
 
 		/* The io_handle, file_io_handle, table_definition, template_table_definition, pages_vector,
-		 * pages_cache, * long_values_pages_vector, long_values_pages_cache and long_values_page_tree
-		 * references are freed elsewhere
+		 * pages_cache, * long_values_pages_vector, long_values_pages_cache, long_values_page_tree
+		 * and long_value_cursor references are freed elsewhere
 		 */
 		if( internal_record->data_definition != NULL )
 		{
@@ -256,6 +336,27 @@ int libesedb_record_free(
 				result = -1;
 			}
 		}
+		if( internal_record->decompression_cache != NULL )
+		{
+			if( libesedb_decompression_cache_free(
+			     &( internal_record->decompression_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free decompression cache.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_record->fixed_size_data != NULL )
+		{
+			memory_free(
+			 internal_record->fixed_size_data );
+		}
 		if( libcdata_array_free(
 		     &( internal_record->values_array ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_free,
@@ -407,6 +508,138 @@ int libesedb_record_get_column_catalog_definition(
 	return( 1 );
 }
 
+/* Retrieves the decompressed data of a LZXPRESS compressed value of the specific entry
+ * The decompressed data is cached in the record so that a value is decompressed only once
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libesedb_record_get_decompressed_value_data(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libfvalue_value_t *record_value,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *entry_data    = NULL;
+	static char *function  = "libesedb_record_get_decompressed_value_data";
+	size_t entry_data_size = 0;
+	uint32_t data_flags    = 0;
+	int encoding           = 0;
+	int result             = 0;
+
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfvalue_value_has_data(
+	          record_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if record value has data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_get_data_flags(
+	     record_value,
+	     &data_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( data_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) == 0 )
+	 || ( ( data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) != 0 ) )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_get_entry_data(
+	     record_value,
+	     0,
+	     &entry_data,
+	     &entry_data_size,
+	     &encoding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record value entry data.",
+		 function );
+
+		return( -1 );
+	}
+	/* 7-bit compressed data is decoded directly into the string
+	 * and does not benefit from caching
+	 */
+	if( ( entry_data == NULL )
+	 || ( entry_data_size < 1 )
+	 || ( LIBESEDB_COMPRESSION_IS_7BIT_COMPRESSED( entry_data[ 0 ] ) != 0 ) )
+	{
+		return( 0 );
+	}
+	if( internal_record->decompression_cache == NULL )
+	{
+		if( libesedb_decompression_cache_initialize(
+		     &( internal_record->decompression_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create decompression cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libesedb_decompression_cache_get_data(
+	     internal_record->decompression_cache,
+	     value_entry,
+	     entry_data,
+	     entry_data_size,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve decompressed data of value: %d.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the column identifier of the specific entry
  * Returns 1 if successful or -1 on error
  */
@@ -905,19 +1138,20 @@ int libesedb_record_get_value(
 	return( 1 );
 }
 
-/* Retrieves the value data flags of the specific entry
- * Returns 1 if successful or -1 on error
+/* Retrieves the value entry of a specific column identifier
+ * Returns 1 if successful, 0 if no such value or -1 on error
  */
-int libesedb_record_get_value_data_flags(
+int libesedb_record_get_value_entry_by_column_identifier(
      libesedb_record_t *record,
-     int value_entry,
-     uint8_t *value_data_flags,
+     uint32_t column_identifier,
+     int *value_entry,
      libcerror_error_t **error )
 {
 	libesedb_internal_record_t *internal_record = NULL;
-	libfvalue_value_t *record_value             = NULL;
-	static char *function                       = "libesedb_record_get_value_data_flags";
-	uint32_t data_flags                         = 0;
+	static char *function                       = "libesedb_record_get_value_entry_by_column_identifier";
+	int definition_index                        = 0;
+	int result                                  = 0;
+	int template_table_number_of_columns        = 0;
 
 	if( record == NULL )
 	{
@@ -932,83 +1166,255 @@ int libesedb_record_get_value_data_flags(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
-	if( value_data_flags == NULL )
+	if( internal_record->table_definition == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value data flags.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing table definition.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
-	     value_entry,
-	     (intptr_t **) &record_value,
-	     error ) != 1 )
+	if( value_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
-		 function,
-		 value_entry );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value entry.",
+		 function );
 
 		return( -1 );
 	}
-	if( libfvalue_value_get_data_flags(
-	     record_value,
-	     &data_flags,
-	     error ) != 1 )
+	if( internal_record->template_table_definition != NULL )
+	{
+		result = libesedb_table_definition_get_column_catalog_definition_index_by_identifier(
+		          internal_record->template_table_definition,
+		          column_identifier,
+		          &definition_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition index from template table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			*value_entry = definition_index;
+
+			return( 1 );
+		}
+		if( libesedb_table_definition_get_number_of_column_catalog_definitions(
+		     internal_record->template_table_definition,
+		     &template_table_number_of_columns,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of columns from template table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = libesedb_table_definition_get_column_catalog_definition_index_by_identifier(
+	          internal_record->table_definition,
+	          column_identifier,
+	          &definition_index,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d data flags.",
-		 function,
-		 value_entry );
+		 "%s: unable to retrieve column catalog definition index from table.",
+		 function );
 
 		return( -1 );
 	}
-	*value_data_flags = (uint8_t) data_flags;
-
-	return( 1 );
+	else if( result != 0 )
+	{
+		*value_entry = template_table_number_of_columns + definition_index;
+	}
+	return( result );
 }
 
-/* Retrieves the value data size of the specific entry
- * Returns 1 if successful or -1 on error
+/* Retrieves the value of a specific column identifier
+ * The value data is not copied and remains managed by the record
+ * Returns 1 if successful, 0 if no such value or -1 on error
  */
-int libesedb_record_get_value_data_size(
+int libesedb_record_get_value_by_column_identifier(
      libesedb_record_t *record,
-     int value_entry,
+     uint32_t column_identifier,
+     uint8_t **value_data,
      size_t *value_data_size,
+     uint8_t *value_flags,
      libcerror_error_t **error )
 {
-	libesedb_internal_record_t *internal_record = NULL;
-	libfvalue_value_t *record_value             = NULL;
-	static char *function                       = "libesedb_record_get_value_data_size";
+	static char *function = "libesedb_record_get_value_by_column_identifier";
+	int result            = 0;
+	int value_entry       = 0;
+
+	result = libesedb_record_get_value_entry_by_column_identifier(
+	          record,
+	          column_identifier,
+	          &value_entry,
+	          error );
 
-	if( record == NULL )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value entry of column identifier: %" PRIu32 ".",
+		 function,
+		 column_identifier );
 
 		return( -1 );
 	}
-	internal_record = (libesedb_internal_record_t *) record;
-
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
-	     value_entry,
-	     (intptr_t **) &record_value,
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libesedb_record_get_value(
+	     record,
+	     value_entry,
+	     value_data,
+	     value_data_size,
+	     value_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the value data flags of the specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_get_value_data_flags(
+     libesedb_record_t *record,
+     int value_entry,
+     uint8_t *value_data_flags,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_t *internal_record = NULL;
+	libfvalue_value_t *record_value             = NULL;
+	static char *function                       = "libesedb_record_get_value_data_flags";
+	uint32_t data_flags                         = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libesedb_internal_record_t *) record;
+
+	if( value_data_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_record->values_array,
+	     value_entry,
+	     (intptr_t **) &record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d from values array.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	if( libfvalue_value_get_data_flags(
+	     record_value,
+	     &data_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d data flags.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	*value_data_flags = (uint8_t) data_flags;
+
+	return( 1 );
+}
+
+/* Retrieves the value data size of the specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_get_value_data_size(
+     libesedb_record_t *record,
+     int value_entry,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_t *internal_record = NULL;
+	libfvalue_value_t *record_value             = NULL;
+	static char *function                       = "libesedb_record_get_value_data_size";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libesedb_internal_record_t *) record;
+
+	if( libcdata_array_get_entry_by_index(
+	     internal_record->values_array,
+	     value_entry,
+	     (intptr_t **) &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1101,6 +1507,172 @@ int libesedb_record_get_value_data(
 	return( 1 );
 }
 
+/* Retrieves the data of a fixed size value of the specific entry
+ * Fixed size columns are read directly from the fixed size data of the record, other columns
+ * and values whose size differs from the expected value size are not decoded
+ * directly, in which case the value data is set to NULL and the record value
+ * should be used instead
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int libesedb_record_get_fixed_size_value_data(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     size_t value_size,
+     libfvalue_value_t **record_value,
+     const uint8_t **value_data,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	uint8_t *data                                            = NULL;
+	static char *function                                    = "libesedb_record_get_fixed_size_value_data";
+	size_t data_size                                         = 0;
+	uint32_t data_flags                                      = 0;
+	uint16_t fixed_size_value_offset                         = 0;
+	int encoding                                             = 0;
+
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_data_definition_get_fixed_size_value_offset(
+	     internal_record->table_definition,
+	     internal_record->template_table_definition,
+	     value_entry,
+	     &column_catalog_definition,
+	     &fixed_size_value_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d fixed size value offset.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	if( ( column_catalog_definition->identifier <= 127 )
+	 && ( column_catalog_definition->size == value_size )
+	 && ( internal_record->fixed_size_data != NULL ) )
+	{
+		if( column_catalog_definition->identifier > (uint32_t) ( (esedb_data_definition_header_t *) internal_record->fixed_size_data )->last_fixed_size_data_type )
+		{
+			return( 0 );
+		}
+		if( ( value_size > internal_record->fixed_size_data_size )
+		 || ( (size_t) fixed_size_value_offset > ( internal_record->fixed_size_data_size - value_size ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid fixed size value: %d offset value out of bounds.",
+			 function,
+			 value_entry );
+
+			return( -1 );
+		}
+		*value_data = &( internal_record->fixed_size_data[ fixed_size_value_offset ] );
+
+		return( 1 );
+	}
+	/* Values that cannot be decoded directly are retrieved from the values array
+	 */
+	if( libcdata_array_get_entry_by_index(
+	     internal_record->values_array,
+	     value_entry,
+	     (intptr_t **) record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d from values array.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	if( libfvalue_value_get_data(
+	     *record_value,
+	     &data,
+	     &data_size,
+	     &encoding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d data.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 || ( data_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_get_data_flags(
+	     *record_value,
+	     &data_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d data flags.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	if( ( data_flags == 0 )
+	 && ( data_size == value_size ) )
+	{
+		*value_data = data;
+	}
+	else
+	{
+		*value_data = NULL;
+	}
+	return( 1 );
+}
+
 /* Retrieves the boolean value of a specific entry
  * Returns 1 if successful, 0 if value is NULL or -1 on error
  */
@@ -1483,6 +2055,7 @@ int libesedb_record_get_value_32bit(
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
 	libfvalue_value_t *record_value                          = NULL;
+	const uint8_t *value_data                                = NULL;
 	static char *function                                    = "libesedb_record_get_value_32bit";
 	uint32_t column_type                                     = 0;
 	int result                                               = 0;
@@ -1500,6 +2073,17 @@ int libesedb_record_get_value_32bit(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
+	if( value_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 32-bit.",
+		 function );
+
+		return( -1 );
+	}
 	if( libesedb_record_get_column_catalog_definition(
 	     internal_record,
 	     value_entry,
@@ -1542,24 +2126,12 @@ int libesedb_record_get_value_32bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
-	     value_entry,
-	     (intptr_t **) &record_value,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
-		 function,
-		 value_entry );
-
-		return( -1 );
-	}
-	result = libfvalue_value_has_data(
-	          record_value,
+	result = libesedb_record_get_fixed_size_value_data(
+	          internal_record,
+	          value_entry,
+	          4,
+	          &record_value,
+	          &value_data,
 	          error );
 
 	if( result == -1 )
@@ -1568,7 +2140,7 @@ int libesedb_record_get_value_32bit(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if value: %d has data.",
+		 "%s: unable to retrieve value: %d data.",
 		 function,
 		 value_entry );
 
@@ -1576,20 +2148,31 @@ int libesedb_record_get_value_32bit(
 	}
 	else if( result != 0 )
 	{
-		if( libfvalue_value_copy_to_32bit(
-		     record_value,
-		     0,
-		     value_32bit,
-		     error ) != 1 )
+		/* Values that cannot be decoded directly are copied by libfvalue
+		 */
+		if( value_data != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy value to 32-bit value.",
-			 function );
+			byte_stream_copy_to_uint32_little_endian(
+			 value_data,
+			 *value_32bit );
+		}
+		else
+		{
+			if( libfvalue_value_copy_to_32bit(
+			     record_value,
+			     0,
+			     value_32bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy value to 32-bit value.",
+				 function );
 
-			return( -1 );
+				return( -1 );
+			}
 		}
 	}
 	return( result );
@@ -1607,6 +2190,7 @@ int libesedb_record_get_value_64bit(
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
 	libfvalue_value_t *record_value                          = NULL;
+	const uint8_t *value_data                                = NULL;
 	static char *function                                    = "libesedb_record_get_value_64bit";
 	uint32_t column_type                                     = 0;
 	int result                                               = 0;
@@ -1624,6 +2208,17 @@ int libesedb_record_get_value_64bit(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
 	if( libesedb_record_get_column_catalog_definition(
 	     internal_record,
 	     value_entry,
@@ -1667,24 +2262,12 @@ int libesedb_record_get_value_64bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
-	     value_entry,
-	     (intptr_t **) &record_value,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
-		 function,
-		 value_entry );
-
-		return( -1 );
-	}
-	result = libfvalue_value_has_data(
-	          record_value,
+	result = libesedb_record_get_fixed_size_value_data(
+	          internal_record,
+	          value_entry,
+	          8,
+	          &record_value,
+	          &value_data,
 	          error );
 
 	if( result == -1 )
@@ -1693,7 +2276,7 @@ int libesedb_record_get_value_64bit(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if value: %d has data.",
+		 "%s: unable to retrieve value: %d data.",
 		 function,
 		 value_entry );
 
@@ -1701,20 +2284,31 @@ int libesedb_record_get_value_64bit(
 	}
 	else if( result != 0 )
 	{
-		if( libfvalue_value_copy_to_64bit(
-		     record_value,
-		     0,
-		     value_64bit,
-		     error ) != 1 )
+		/* Values that cannot be decoded directly are copied by libfvalue
+		 */
+		if( value_data != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy value to 64-bit value.",
-			 function );
+			byte_stream_copy_to_uint64_little_endian(
+			 value_data,
+			 *value_64bit );
+		}
+		else
+		{
+			if( libfvalue_value_copy_to_64bit(
+			     record_value,
+			     0,
+			     value_64bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy value to 64-bit value.",
+				 function );
 
-			return( -1 );
+				return( -1 );
+			}
 		}
 	}
 	return( result );
@@ -1732,6 +2326,7 @@ int libesedb_record_get_value_filetime(
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
 	libfvalue_value_t *record_value                          = NULL;
+	const uint8_t *value_data                                = NULL;
 	static char *function                                    = "libesedb_record_get_value_filetime";
 	uint32_t column_type                                     = 0;
 	int result                                               = 0;
@@ -1749,6 +2344,17 @@ int libesedb_record_get_value_filetime(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
+	if( value_filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value FILETIME.",
+		 function );
+
+		return( -1 );
+	}
 	if( libesedb_record_get_column_catalog_definition(
 	     internal_record,
 	     value_entry,
@@ -1790,24 +2396,12 @@ int libesedb_record_get_value_filetime(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
-	     value_entry,
-	     (intptr_t **) &record_value,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
-		 function,
-		 value_entry );
-
-		return( -1 );
-	}
-	result = libfvalue_value_has_data(
-	          record_value,
+	result = libesedb_record_get_fixed_size_value_data(
+	          internal_record,
+	          value_entry,
+	          8,
+	          &record_value,
+	          &value_data,
 	          error );
 
 	if( result == -1 )
@@ -1816,7 +2410,7 @@ int libesedb_record_get_value_filetime(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if value: %d has data.",
+		 "%s: unable to retrieve value: %d data.",
 		 function,
 		 value_entry );
 
@@ -1824,22 +2418,31 @@ int libesedb_record_get_value_filetime(
 	}
 	else if( result != 0 )
 	{
-		/* Copy the filetime to a 64-bit value
+		/* Values that cannot be decoded directly are copied by libfvalue
 		 */
-		if( libfvalue_value_copy_to_64bit(
-		     record_value,
-		     0,
-		     value_filetime,
-		     error ) != 1 )
+		if( value_data != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy value to 64-bit value.",
-			 function );
+			byte_stream_copy_to_uint64_little_endian(
+			 value_data,
+			 *value_filetime );
+		}
+		else
+		{
+			if( libfvalue_value_copy_to_64bit(
+			     record_value,
+			     0,
+			     value_filetime,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy value to 64-bit value.",
+				 function );
 
-			return( -1 );
+				return( -1 );
+			}
 		}
 	}
 	return( result );
@@ -1854,9 +2457,12 @@ int libesedb_record_get_value_floating_point_32bit(
      float *value_floating_point_32bit,
      libcerror_error_t **error )
 {
+	byte_stream_float32_t value_float32;
+
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
 	libfvalue_value_t *record_value                          = NULL;
+	const uint8_t *value_data                                = NULL;
 	static char *function                                    = "libesedb_record_get_value_floating_point_32bit";
 	uint32_t column_type                                     = 0;
 	int result                                               = 0;
@@ -1874,6 +2480,17 @@ int libesedb_record_get_value_floating_point_32bit(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
+	if( value_floating_point_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value floating point 32-bit.",
+		 function );
+
+		return( -1 );
+	}
 	if( libesedb_record_get_column_catalog_definition(
 	     internal_record,
 	     value_entry,
@@ -1915,24 +2532,12 @@ int libesedb_record_get_value_floating_point_32bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
-	     value_entry,
-	     (intptr_t **) &record_value,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
-		 function,
-		 value_entry );
-
-		return( -1 );
-	}
-	result = libfvalue_value_has_data(
-	          record_value,
+	result = libesedb_record_get_fixed_size_value_data(
+	          internal_record,
+	          value_entry,
+	          4,
+	          &record_value,
+	          &value_data,
 	          error );
 
 	if( result == -1 )
@@ -1941,7 +2546,7 @@ int libesedb_record_get_value_floating_point_32bit(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if value: %d has data.",
+		 "%s: unable to retrieve value: %d data.",
 		 function,
 		 value_entry );
 
@@ -1949,20 +2554,33 @@ int libesedb_record_get_value_floating_point_32bit(
 	}
 	else if( result != 0 )
 	{
-		if( libfvalue_value_copy_to_float(
-		     record_value,
-		     0,
-		     value_floating_point_32bit,
-		     error ) != 1 )
+		/* Values that cannot be decoded directly are copied by libfvalue
+		 */
+		if( value_data != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy value to single precision floating point value.",
-			 function );
+			byte_stream_copy_to_uint32_little_endian(
+			 value_data,
+			 value_float32.integer );
+
+			*value_floating_point_32bit = value_float32.floating_point;
+		}
+		else
+		{
+			if( libfvalue_value_copy_to_float(
+			     record_value,
+			     0,
+			     value_floating_point_32bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy value to single precision floating point value.",
+				 function );
 
-			return( -1 );
+				return( -1 );
+			}
 		}
 	}
 	return( result );
@@ -1977,9 +2595,12 @@ int libesedb_record_get_value_floating_point_64bit(
      double *value_floating_point_64bit,
      libcerror_error_t **error )
 {
+	byte_stream_float64_t value_float64;
+
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
 	libfvalue_value_t *record_value                          = NULL;
+	const uint8_t *value_data                                = NULL;
 	static char *function                                    = "libesedb_record_get_value_floating_point_64bit";
 	uint32_t column_type                                     = 0;
 	int result                                               = 0;
@@ -1997,6 +2618,17 @@ int libesedb_record_get_value_floating_point_64bit(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
+	if( value_floating_point_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value floating point 64-bit.",
+		 function );
+
+		return( -1 );
+	}
 	if( libesedb_record_get_column_catalog_definition(
 	     internal_record,
 	     value_entry,
@@ -2038,24 +2670,12 @@ int libesedb_record_get_value_floating_point_64bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
-	     value_entry,
-	     (intptr_t **) &record_value,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
-		 function,
-		 value_entry );
-
-		return( -1 );
-	}
-	result = libfvalue_value_has_data(
-	          record_value,
+	result = libesedb_record_get_fixed_size_value_data(
+	          internal_record,
+	          value_entry,
+	          8,
+	          &record_value,
+	          &value_data,
 	          error );
 
 	if( result == -1 )
@@ -2064,7 +2684,7 @@ int libesedb_record_get_value_floating_point_64bit(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if value: %d has data.",
+		 "%s: unable to retrieve value: %d data.",
 		 function,
 		 value_entry );
 
@@ -2072,20 +2692,33 @@ int libesedb_record_get_value_floating_point_64bit(
 	}
 	else if( result != 0 )
 	{
-		if( libfvalue_value_copy_to_double(
-		     record_value,
-		     0,
-		     value_floating_point_64bit,
-		     error ) != 1 )
+		/* Values that cannot be decoded directly are copied by libfvalue
+		 */
+		if( value_data != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy value to double precision floating point value.",
-			 function );
+			byte_stream_copy_to_uint64_little_endian(
+			 value_data,
+			 value_float64.integer );
 
-			return( -1 );
+			*value_floating_point_64bit = value_float64.floating_point;
+		}
+		else
+		{
+			if( libfvalue_value_copy_to_double(
+			     record_value,
+			     0,
+			     value_floating_point_64bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy value to double precision floating point value.",
+				 function );
+
+				return( -1 );
+			}
 		}
 	}
 	return( result );
@@ -2104,7 +2737,9 @@ int libesedb_record_get_value_utf8_string_size(
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
 	libfvalue_value_t *record_value                          = NULL;
+	const uint8_t *decompressed_data                         = NULL;
 	static char *function                                    = "libesedb_record_get_value_utf8_string_size";
+	size_t decompressed_data_size                            = 0;
 	uint32_t column_type                                     = 0;
 	int result                                               = 0;
 
@@ -2179,11 +2814,30 @@ int libesedb_record_get_value_utf8_string_size(
 
 		return( -1 );
 	}
-	result = libesedb_record_value_get_utf8_string_size(
+	result = libesedb_record_get_decompressed_value_data(
+	          internal_record,
+	          value_entry,
 	          record_value,
-	          utf8_string_size,
+	          &decompressed_data,
+	          &decompressed_data_size,
 	          error );
 
+	if( result == 1 )
+	{
+		result = libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+		          decompressed_data,
+		          decompressed_data_size,
+		          utf8_string_size,
+		          error );
+	}
+	else if( result == 0 )
+	{
+		result = libesedb_record_value_get_utf8_string_size(
+		          record_value,
+		          utf8_string_size,
+		          error );
+	}
+
 	if( result == -1 )
 	{
 		libcerror_error_set(
@@ -2214,7 +2868,10 @@ int libesedb_record_get_value_utf8_string(
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
 	libfvalue_value_t *record_value                          = NULL;
+	const uint8_t *decompressed_data                         = NULL;
 	static char *function                                    = "libesedb_record_get_value_utf8_string";
+	size_t decompressed_data_size                            = 0;
+	size_t utf8_string_index                                 = 0;
 	uint32_t column_type                                     = 0;
 	int result                                               = 0;
 
@@ -2289,12 +2946,33 @@ int libesedb_record_get_value_utf8_string(
 
 		return( -1 );
 	}
-	result = libesedb_record_value_get_utf8_string(
+	result = libesedb_record_get_decompressed_value_data(
+	          internal_record,
+	          value_entry,
 	          record_value,
-	          utf8_string,
-	          utf8_string_size,
+	          &decompressed_data,
+	          &decompressed_data_size,
 	          error );
 
+	if( result == 1 )
+	{
+		result = libesedb_compression_copy_to_utf8_string_from_uncompressed_data(
+		          decompressed_data,
+		          decompressed_data_size,
+		          utf8_string,
+		          utf8_string_size,
+		          &utf8_string_index,
+		          error );
+	}
+	else if( result == 0 )
+	{
+		result = libesedb_record_value_get_utf8_string(
+		          record_value,
+		          utf8_string,
+		          utf8_string_size,
+		          error );
+	}
+
 	if( result == -1 )
 	{
 		libcerror_error_set(
@@ -2323,7 +3001,9 @@ int libesedb_record_get_value_utf16_string_size(
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
 	libfvalue_value_t *record_value                          = NULL;
+	const uint8_t *decompressed_data                         = NULL;
 	static char *function                                    = "libesedb_record_get_value_utf16_string_size";
+	size_t decompressed_data_size                            = 0;
 	uint32_t column_type                                     = 0;
 	int result                                               = 0;
 
@@ -2398,11 +3078,30 @@ int libesedb_record_get_value_utf16_string_size(
 
 		return( -1 );
 	}
-	result = libesedb_record_value_get_utf16_string_size(
+	result = libesedb_record_get_decompressed_value_data(
+	          internal_record,
+	          value_entry,
 	          record_value,
-	          utf16_string_size,
+	          &decompressed_data,
+	          &decompressed_data_size,
 	          error );
 
+	if( result == 1 )
+	{
+		result = libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+		          decompressed_data,
+		          decompressed_data_size,
+		          utf16_string_size,
+		          error );
+	}
+	else if( result == 0 )
+	{
+		result = libesedb_record_value_get_utf16_string_size(
+		          record_value,
+		          utf16_string_size,
+		          error );
+	}
+
 	if( result == -1 )
 	{
 		libcerror_error_set(
@@ -2433,7 +3132,10 @@ int libesedb_record_get_value_utf16_string(
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
 	libfvalue_value_t *record_value                          = NULL;
+	const uint8_t *decompressed_data                         = NULL;
 	static char *function                                    = "libesedb_record_get_value_utf16_string";
+	size_t decompressed_data_size                            = 0;
+	size_t utf16_string_index                                = 0;
 	uint32_t column_type                                     = 0;
 	int result                                               = 0;
 
@@ -2508,12 +3210,33 @@ int libesedb_record_get_value_utf16_string(
 
 		return( -1 );
 	}
-	result = libesedb_record_value_get_utf16_string(
+	result = libesedb_record_get_decompressed_value_data(
+	          internal_record,
+	          value_entry,
 	          record_value,
-	          utf16_string,
-	          utf16_string_size,
+	          &decompressed_data,
+	          &decompressed_data_size,
 	          error );
 
+	if( result == 1 )
+	{
+		result = libesedb_compression_copy_to_utf16_string_from_uncompressed_data(
+		          decompressed_data,
+		          decompressed_data_size,
+		          utf16_string,
+		          utf16_string_size,
+		          &utf16_string_index,
+		          error );
+	}
+	else if( result == 0 )
+	{
+		result = libesedb_record_value_get_utf16_string(
+		          record_value,
+		          utf16_string,
+		          utf16_string_size,
+		          error );
+	}
+
 	if( result == -1 )
 	{
 		libcerror_error_set(
@@ -2999,10 +3722,18 @@ int libesedb_record_is_multi_value(
 
 /* Retrieves the long value data segments list of a specific entry
  * Creates a new data segments list
+ * The column flags are used to determine if the segment data can be Xpress10 compressed
  * Returns 1 if successful, 0 if the item does not contain such value or -1 on error
  */
 int libesedb_record_get_long_value_data_segments_list(
-     libesedb_internal_record_t *internal_record,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libesedb_table_definition_t *table_definition,
+     libfdata_vector_t *long_values_pages_vector,
+     libfcache_cache_t *long_values_pages_cache,
+     libesedb_page_tree_t *long_values_page_tree,
+     libesedb_long_value_cursor_t *long_value_cursor,
+     uint32_t column_flags,
      const uint8_t *long_value_key,
      size_t long_value_key_size,
      libfdata_list_t **data_segments_list,
@@ -3010,21 +3741,47 @@ int libesedb_record_get_long_value_data_segments_list(
 {
 	uint8_t long_value_segment_key[ 12 ];
 
-	libesedb_data_definition_t *data_definition = NULL;
-	libesedb_page_tree_key_t *key               = NULL;
-	libfdata_list_t *safe_data_segments_list    = NULL;
-	static char *function                       = "libesedb_record_get_long_value_data_segments_list";
-	uint32_t long_value_segment_offset          = 0;
-	uint32_t next_long_value_segment_offset     = 0;
-	int result                                  = 0;
+	libesedb_data_definition_t *data_definition           = NULL;
+	libesedb_data_definition_t *next_data_definition      = NULL;
+	libesedb_data_segments_handle_t *data_segments_handle = NULL;
+	libesedb_page_tree_key_t *key                         = NULL;
+	libesedb_page_tree_key_t *leaf_value_key              = NULL;
+	libfdata_list_t *safe_data_segments_list              = NULL;
+	static char *function                                 = "libesedb_record_get_long_value_data_segments_list";
+	uint32_t long_value_segment_offset                    = 0;
+	uint32_t next_long_value_segment_offset               = 0;
+	int compare_result                                    = 0;
+	int result                                            = 0;
 
-	if( internal_record == NULL )
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->table_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table definition - missing table catalog definition.",
 		 function );
 
 		return( -1 );
@@ -3094,12 +3851,24 @@ int libesedb_record_get_long_value_data_segments_list(
 	}
 	key->type = LIBESEDB_KEY_TYPE_LONG_VALUE;
 
-	result = libesedb_page_tree_get_leaf_value_by_key(
-	          internal_record->long_values_page_tree,
-	          internal_record->file_io_handle,
-	          key,
-	          &data_definition,
-	          error );
+	if( long_value_cursor != NULL )
+	{
+		result = libesedb_long_value_cursor_get_leaf_value_by_key(
+		          long_value_cursor,
+		          file_io_handle,
+		          key,
+		          &data_definition,
+		          error );
+	}
+	else
+	{
+		result = libesedb_page_tree_get_leaf_value_by_key(
+		          long_values_page_tree,
+		          file_io_handle,
+		          key,
+		          &data_definition,
+		          error );
+	}
 
 	if( result == -1 )
 	{
@@ -3129,14 +3898,31 @@ int libesedb_record_get_long_value_data_segments_list(
 	{
 		return( 0 );
 	}
+	if( libesedb_data_segments_handle_initialize(
+	     &data_segments_handle,
+	     io_handle->long_value_cache,
+	     table_definition->table_catalog_definition->identifier,
+	     long_value_key,
+	     long_value_key_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data segments handle.",
+		 function );
+
+		goto on_error;
+	}
 	if( libfdata_list_initialize(
 	     &safe_data_segments_list,
-	     NULL,
-	     NULL,
+	     (intptr_t *) data_segments_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_data_segments_handle_free,
 	     NULL,
 	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_data_segment_read_element_data,
 	     NULL,
-	     0,
+	     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3148,11 +3934,16 @@ int libesedb_record_get_long_value_data_segments_list(
 
 		goto on_error;
 	}
+	/* The data segments list takes over management of the data segments handle
+	 */
+	data_segments_handle = NULL;
+
 	if( libesedb_data_definition_read_long_value(
 	     data_definition,
-	     internal_record->file_io_handle,
-	     internal_record->long_values_pages_vector,
-	     internal_record->long_values_pages_cache,
+	     file_io_handle,
+	     io_handle,
+	     long_values_pages_vector,
+	     long_values_pages_cache,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3164,19 +3955,9 @@ int libesedb_record_get_long_value_data_segments_list(
 
 		goto on_error;
 	}
-	if( libesedb_data_definition_free(
-	     &data_definition,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free data definition.",
-		 function );
-
-		goto on_error;
-	}
+	/* The data definition of the long value is retained since the first
+	 * long value segment is the next leaf value in the leaf page chain
+	 */
 	/* Reverse the reversed long value key
 	 */
 	if( long_value_key_size == 4 )
@@ -3246,48 +4027,51 @@ int libesedb_record_get_long_value_data_segments_list(
 		}
 		key->type = LIBESEDB_KEY_TYPE_LONG_VALUE_SEGMENT;
 
-		result = libesedb_page_tree_get_leaf_value_by_key(
-		          internal_record->long_values_page_tree,
-		          internal_record->file_io_handle,
-		          key,
-		          &data_definition,
-		          error );
-
-		if( result == -1 )
+		if( data_definition == NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve leaf value by key.",
-			 function );
+			result = libesedb_page_tree_get_leaf_value_by_key(
+			          long_values_page_tree,
+			          file_io_handle,
+			          key,
+			          &data_definition,
+			          error );
 
-			goto on_error;
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve leaf value by key.",
+				 function );
+
+				goto on_error;
+			}
 		}
-		else if( result != 0 )
+		else
 		{
-			if( libesedb_data_definition_read_long_value_segment(
-			     data_definition,
-			     internal_record->file_io_handle,
-			     internal_record->io_handle,
-			     internal_record->long_values_pages_vector,
-			     internal_record->long_values_pages_cache,
-			     long_value_segment_offset,
-			     safe_data_segments_list,
-			     &next_long_value_segment_offset,
-			     error ) != 1 )
+			/* The segments of a long value are adjacent in key order
+			 * hence the next segment is the next leaf value in the leaf page chain
+			 */
+			result = libesedb_page_tree_get_next_leaf_value(
+			          long_values_page_tree,
+			          file_io_handle,
+			          data_definition,
+			          &leaf_value_key,
+			          &next_data_definition,
+			          error );
+
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read data definition long value segment.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next leaf value.",
 				 function );
 
 				goto on_error;
 			}
-			long_value_segment_offset = next_long_value_segment_offset;
-
 			if( libesedb_data_definition_free(
 			     &data_definition,
 			     error ) != 1 )
@@ -3301,6 +4085,70 @@ int libesedb_record_get_long_value_data_segments_list(
 
 				goto on_error;
 			}
+			data_definition      = next_data_definition;
+			next_data_definition = NULL;
+
+			if( result != 0 )
+			{
+				compare_result = libesedb_page_tree_key_compare(
+				                  key,
+				                  leaf_value_key,
+				                  error );
+
+				if( compare_result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to compare long value segment and leaf value keys.",
+					 function );
+
+					goto on_error;
+				}
+				if( compare_result != LIBFDATA_COMPARE_EQUAL )
+				{
+					result = 0;
+				}
+				if( libesedb_page_tree_key_free(
+				     &leaf_value_key,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free leaf value key.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		if( result != 0 )
+		{
+			if( libesedb_data_definition_read_long_value_segment(
+			     data_definition,
+			     file_io_handle,
+			     io_handle,
+			     long_values_pages_vector,
+			     long_values_pages_cache,
+			     column_flags,
+			     long_value_segment_offset,
+			     safe_data_segments_list,
+			     &next_long_value_segment_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data definition long value segment.",
+				 function );
+
+				goto on_error;
+			}
+			long_value_segment_offset = next_long_value_segment_offset;
 		}
 		if( libesedb_page_tree_key_free(
 		     &key,
@@ -3318,6 +4166,22 @@ int libesedb_record_get_long_value_data_segments_list(
 	}
 	while( result == 1 );
 
+	if( data_definition != NULL )
+	{
+		if( libesedb_data_definition_free(
+		     &data_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data definition.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	*data_segments_list = safe_data_segments_list;
 
 	return( 1 );
@@ -3329,12 +4193,30 @@ on_error:
 		 &safe_data_segments_list,
 		 NULL );
 	}
+	if( data_segments_handle != NULL )
+	{
+		libesedb_data_segments_handle_free(
+		 &data_segments_handle,
+		 NULL );
+	}
 	if( data_definition != NULL )
 	{
 		libesedb_data_definition_free(
 		 &data_definition,
 		 NULL );
 	}
+	if( next_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &next_data_definition,
+		 NULL );
+	}
+	if( leaf_value_key != NULL )
+	{
+		libesedb_page_tree_key_free(
+		 &leaf_value_key,
+		 NULL );
+	}
 	if( key != NULL )
 	{
 		libesedb_page_tree_key_free(
@@ -3507,7 +4389,14 @@ int libesedb_record_get_long_value(
 		goto on_error;
 	}
 	result = libesedb_record_get_long_value_data_segments_list(
-		  internal_record,
+		  internal_record->file_io_handle,
+		  internal_record->io_handle,
+		  internal_record->table_definition,
+		  internal_record->long_values_pages_vector,
+		  internal_record->long_values_pages_cache,
+		  internal_record->long_values_page_tree,
+		  internal_record->long_value_cursor,
+		  column_catalog_definition->flags,
 		  value_data,
 		  value_data_size,
 		  &data_segments_list,
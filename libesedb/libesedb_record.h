@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "libesedb_data_definition.h"
+#include "libesedb_decompression_cache.h"
 #include "libesedb_extern.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
@@ -33,6 +34,7 @@
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_long_value_cursor.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
@@ -85,10 +87,28 @@ struct libesedb_internal_record
 	 */
 	libesedb_page_tree_t *long_values_page_tree;
 
+	/* The long value cursor
+	 */
+	libesedb_long_value_cursor_t *long_value_cursor;
+
 	/* The values array
 	 */
 	libcdata_array_t *values_array;
 
+	/* The fixed size data
+	 * This contains a copy of the data definition header and fixed size values of the record data
+	 */
+	uint8_t *fixed_size_data;
+
+	/* The fixed size data size
+	 */
+	size_t fixed_size_data_size;
+
+	/* The decompression cache
+	 * This contains the decompressed data of LZXPRESS compressed values
+	 */
+	libesedb_decompression_cache_t *decompression_cache;
+
 	/* The (record) flags
 	 */
 	uint8_t flags;
@@ -106,6 +126,7 @@ int libesedb_record_initialize(
      libfcache_cache_t *long_values_pages_cache,
      libesedb_data_definition_t *data_definition,
      libesedb_page_tree_t *long_values_page_tree,
+     libesedb_long_value_cursor_t *long_value_cursor,
      libcerror_error_t **error );
 
 LIBESEDB_EXTERN \
@@ -125,6 +146,14 @@ int libesedb_record_get_column_catalog_definition(
      libesedb_catalog_definition_t **column_catalog_definition,
      libcerror_error_t **error );
 
+int libesedb_record_get_decompressed_value_data(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libfvalue_value_t *record_value,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_record_get_column_identifier(
      libesedb_record_t *record,
@@ -194,6 +223,22 @@ int libesedb_record_get_value_data(
      size_t value_data_size,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_record_get_value_entry_by_column_identifier(
+     libesedb_record_t *record,
+     uint32_t column_identifier,
+     int *value_entry,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_record_get_value_by_column_identifier(
+     libesedb_record_t *record,
+     uint32_t column_identifier,
+     uint8_t **value_data,
+     size_t *value_data_size,
+     uint8_t *value_flags,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_record_get_value_data_flags(
      libesedb_record_t *record,
@@ -201,6 +246,14 @@ int libesedb_record_get_value_data_flags(
      uint8_t *value_data_flags,
      libcerror_error_t **error );
 
+int libesedb_record_get_fixed_size_value_data(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     size_t value_size,
+     libfvalue_value_t **record_value,
+     const uint8_t **value_data,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_record_get_value_boolean(
      libesedb_record_t *record,
@@ -315,7 +368,14 @@ int libesedb_record_is_multi_value(
      libcerror_error_t **error );
 
 int libesedb_record_get_long_value_data_segments_list(
-     libesedb_internal_record_t *internal_record,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libesedb_table_definition_t *table_definition,
+     libfdata_vector_t *long_values_pages_vector,
+     libfcache_cache_t *long_values_pages_cache,
+     libesedb_page_tree_t *long_values_page_tree,
+     libesedb_long_value_cursor_t *long_value_cursor,
+     uint32_t column_flags,
      const uint8_t *long_value_key,
      size_t long_value_key_size,
      libfdata_list_t **data_segments_list,
@@ -31,6 +31,7 @@
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_page.h"
+#include "libesedb_page_store.h"
 #include "libesedb_page_value.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_page_tree_value.h"
@@ -603,13 +604,12 @@ int libesedb_space_tree_read_values_from_page(
 			if( ( child_page_number > 0 )
 			 && ( child_page_number <= space_tree->page_tree->io_handle->last_page_number ) )
 			{
-				if( libfdata_vector_get_element_value_by_index(
-				     space_tree->page_tree->pages_vector,
-				     (intptr_t *) file_io_handle,
-				     (libfdata_cache_t *) child_page_cache,
-				     (int) child_page_number - 1,
-				     (intptr_t **) &child_page,
-				     0,
+				if( libesedb_page_store_get_page_by_number(
+				     space_tree->page_tree->io_handle,
+				     file_io_handle,
+				     child_page_cache,
+				     child_page_number,
+				     &child_page,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -770,13 +770,12 @@ int libesedb_space_tree_read_file_io_handle(
 
 		goto on_error;
 	}
-	if( libfdata_vector_get_element_value_by_index(
-	     space_tree->page_tree->pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) root_page_cache,
-	     (int) space_tree->page_tree->root_page_number - 1,
-	     (intptr_t **) &root_page,
-	     0,
+	if( libesedb_page_store_get_page_by_number(
+	     space_tree->page_tree->io_handle,
+	     file_io_handle,
+	     root_page_cache,
+	     space_tree->page_tree->root_page_number,
+	     &root_page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
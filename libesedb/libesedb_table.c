@@ -23,9 +23,12 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libesedb_arrow.h"
+#include "libesedb_batch.h"
 #include "libesedb_column.h"
 #include "libesedb_data_definition.h"
 #include "libesedb_definitions.h"
+#include "libesedb_filter.h"
 #include "libesedb_index.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
@@ -33,6 +36,7 @@
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_long_value_cursor.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_record.h"
 #include "libesedb_table.h"
@@ -434,6 +438,22 @@ int libesedb_table_free(
 				result = -1;
 			}
 		}
+		if( internal_table->long_value_cursor != NULL )
+		{
+			if( libesedb_long_value_cursor_free(
+			     &( internal_table->long_value_cursor ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free long value cursor.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( internal_table->long_values_page_tree != NULL )
 		{
 			if( libesedb_page_tree_free(
@@ -1288,6 +1308,222 @@ int libesedb_table_get_column(
 	return( 1 );
 }
 
+/* Retrieves the column entry for the UTF-8 encoded column name
+ * The column entry includes the columns of the template table, if any,
+ * and can be used as the value entry of the records of the table
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+int libesedb_table_get_column_index_by_utf8_name(
+     libesedb_table_t *table,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *column_entry,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_get_column_index_by_utf8_name";
+	int definition_index                      = 0;
+	int result                                = 0;
+	int template_table_number_of_columns      = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( column_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->template_table_definition != NULL )
+	{
+		result = libesedb_table_definition_get_column_catalog_definition_index_by_utf8_name(
+		          internal_table->template_table_definition,
+		          utf8_string,
+		          utf8_string_length,
+		          &definition_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition index from template table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			*column_entry = definition_index;
+
+			return( 1 );
+		}
+		if( libesedb_table_definition_get_number_of_column_catalog_definitions(
+		     internal_table->template_table_definition,
+		     &template_table_number_of_columns,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of columns from template table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = libesedb_table_definition_get_column_catalog_definition_index_by_utf8_name(
+	          internal_table->table_definition,
+	          utf8_string,
+	          utf8_string_length,
+	          &definition_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column catalog definition index from table.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*column_entry = template_table_number_of_columns + definition_index;
+	}
+	return( result );
+}
+
+/* Retrieves the column entry for the UTF-16 encoded column name
+ * The column entry includes the columns of the template table, if any,
+ * and can be used as the value entry of the records of the table
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+int libesedb_table_get_column_index_by_utf16_name(
+     libesedb_table_t *table,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int *column_entry,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_get_column_index_by_utf16_name";
+	int definition_index                      = 0;
+	int result                                = 0;
+	int template_table_number_of_columns      = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( column_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->template_table_definition != NULL )
+	{
+		result = libesedb_table_definition_get_column_catalog_definition_index_by_utf16_name(
+		          internal_table->template_table_definition,
+		          utf16_string,
+		          utf16_string_length,
+		          &definition_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition index from template table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			*column_entry = definition_index;
+
+			return( 1 );
+		}
+		if( libesedb_table_definition_get_number_of_column_catalog_definitions(
+		     internal_table->template_table_definition,
+		     &template_table_number_of_columns,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of columns from template table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = libesedb_table_definition_get_column_catalog_definition_index_by_utf16_name(
+	          internal_table->table_definition,
+	          utf16_string,
+	          utf16_string_length,
+	          &definition_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column catalog definition index from table.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*column_entry = template_table_number_of_columns + definition_index;
+	}
+	return( result );
+}
+
 /* Retrieves the number of indexes
  * Returns 1 if successful or -1 on error
  */
@@ -1538,6 +1774,7 @@ int libesedb_table_get_record(
 	     internal_table->long_values_pages_cache,
 	     record_data_definition,
 	     internal_table->long_values_page_tree,
+	     internal_table->long_value_cursor,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1562,3 +1799,621 @@ on_error:
 	return( -1 );
 }
 
+/* Enables sequential long value access
+ * When the records are retrieved in order the long values they reference are
+ * mostly stored in the same order in the long values page tree, hence they can
+ * be read by following the leaf page chain instead of descending the tree for
+ * every long value. Up to maximum_number_of_buffered_values long values that
+ * are skipped are retained so that records that reference long values out of
+ * order do not require a descent either.
+ * Only records retrieved after this function is called use sequential access
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_enable_sequential_long_values(
+     libesedb_table_t *table,
+     int maximum_number_of_buffered_values,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_enable_sequential_long_values";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( internal_table->long_value_cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid table - long value cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* A table without long values has no long values page tree
+	 */
+	if( internal_table->long_values_page_tree == NULL )
+	{
+		return( 1 );
+	}
+	if( libesedb_long_value_cursor_initialize(
+	     &( internal_table->long_value_cursor ),
+	     internal_table->long_values_page_tree,
+	     maximum_number_of_buffered_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create long value cursor.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the next record that matches the filter
+ * The filter is evaluated against the record data before the record is created,
+ * starting at the start record entry
+ * Returns 1 if successful, 0 if no matching record was found or -1 on error
+ */
+int libesedb_table_get_next_record_by_filter(
+     libesedb_table_t *table,
+     libesedb_filter_t *filter,
+     int start_record_entry,
+     int *record_entry,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *record_data_definition = NULL;
+	libesedb_internal_table_t *internal_table          = NULL;
+	uint8_t *record_data                               = NULL;
+	static char *function                              = "libesedb_table_get_next_record_by_filter";
+	size_t record_data_size                            = 0;
+	int number_of_records                              = 0;
+	int result                                         = 0;
+	int safe_record_entry                              = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( start_record_entry < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid start record entry value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_filter_bind(
+	     (libesedb_internal_filter_t *) filter,
+	     internal_table->table_definition,
+	     internal_table->template_table_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to bind filter to table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_get_number_of_leaf_values(
+	     internal_table->table_page_tree,
+	     internal_table->file_io_handle,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of leaf values from table page tree.",
+		 function );
+
+		goto on_error;
+	}
+	for( safe_record_entry = start_record_entry;
+	     safe_record_entry < number_of_records;
+	     safe_record_entry++ )
+	{
+		if( libesedb_page_tree_get_leaf_value_by_index(
+		     internal_table->table_page_tree,
+		     internal_table->file_io_handle,
+		     safe_record_entry,
+		     &record_data_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf value: %d from table values tree.",
+			 function,
+			 safe_record_entry );
+
+			goto on_error;
+		}
+		/* The record data references the cached page and is only used
+		 * before another page is read
+		 */
+		if( libesedb_data_definition_read_data(
+		     record_data_definition,
+		     internal_table->file_io_handle,
+		     internal_table->io_handle,
+		     internal_table->pages_vector,
+		     internal_table->pages_cache,
+		     &record_data,
+		     &record_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record: %d data.",
+			 function,
+			 safe_record_entry );
+
+			goto on_error;
+		}
+		result = libesedb_filter_evaluate(
+		          (libesedb_internal_filter_t *) filter,
+		          internal_table->io_handle,
+		          record_data,
+		          record_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to evaluate filter on record: %d.",
+			 function,
+			 safe_record_entry );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libesedb_record_initialize(
+			     record,
+			     internal_table->file_io_handle,
+			     internal_table->io_handle,
+			     internal_table->table_definition,
+			     internal_table->template_table_definition,
+			     internal_table->pages_vector,
+			     internal_table->pages_cache,
+			     internal_table->long_values_pages_vector,
+			     internal_table->long_values_pages_cache,
+			     record_data_definition,
+			     internal_table->long_values_page_tree,
+			     internal_table->long_value_cursor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create record: %d.",
+				 function,
+				 safe_record_entry );
+
+				goto on_error;
+			}
+			*record_entry = safe_record_entry;
+
+			return( 1 );
+		}
+		if( libesedb_data_definition_free(
+		     &record_data_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record: %d data definition.",
+			 function,
+			 safe_record_entry );
+
+			goto on_error;
+		}
+	}
+	return( 0 );
+
+on_error:
+	if( record_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &record_data_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a batch of records into a columnar batch
+ * If column entries is NULL all the columns are read
+ * The batch column buffers are sized for number of records and are reused
+ * by subsequent reads with the same columns
+ * Returns 1 if successful, 0 if no records are available at the start record entry or -1 on error
+ */
+int libesedb_table_read_batch(
+     libesedb_table_t *table,
+     int start_record_entry,
+     int number_of_records,
+     const int *column_entries,
+     int number_of_column_entries,
+     libesedb_batch_t *batch,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *next_record_data_definition = NULL;
+	libesedb_data_definition_t *record_data_definition      = NULL;
+	libesedb_internal_table_t *internal_table               = NULL;
+	libesedb_page_tree_key_t *leaf_value_key                = NULL;
+	uint8_t *record_data                                    = NULL;
+	static char *function                                   = "libesedb_table_read_batch";
+	size_t record_data_size                                 = 0;
+	int last_record_entry                                   = 0;
+	int record_entry                                        = 0;
+	int result                                              = 0;
+	int table_number_of_records                             = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( start_record_entry < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid start record entry value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of records value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_batch_set_columns(
+	     (libesedb_internal_batch_t *) batch,
+	     internal_table->table_definition,
+	     internal_table->template_table_definition,
+	     column_entries,
+	     number_of_column_entries,
+	     number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set batch columns.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_get_number_of_leaf_values(
+	     internal_table->table_page_tree,
+	     internal_table->file_io_handle,
+	     &table_number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of leaf values from table page tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( start_record_entry >= table_number_of_records )
+	{
+		return( 0 );
+	}
+	if( number_of_records > ( table_number_of_records - start_record_entry ) )
+	{
+		last_record_entry = table_number_of_records;
+	}
+	else
+	{
+		last_record_entry = start_record_entry + number_of_records;
+	}
+	/* Only the first record is looked up from the root page, the other records
+	 * are read by following the leaf pages
+	 */
+	if( libesedb_page_tree_get_leaf_value_by_index(
+	     internal_table->table_page_tree,
+	     internal_table->file_io_handle,
+	     start_record_entry,
+	     &record_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value: %d from table values tree.",
+		 function,
+		 start_record_entry );
+
+		goto on_error;
+	}
+	record_entry = start_record_entry;
+
+	while( record_data_definition != NULL )
+	{
+		/* The record data references the cached page and is only used
+		 * before another page of the table is read
+		 */
+		if( libesedb_data_definition_read_data(
+		     record_data_definition,
+		     internal_table->file_io_handle,
+		     internal_table->io_handle,
+		     internal_table->pages_vector,
+		     internal_table->pages_cache,
+		     &record_data,
+		     &record_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record: %d data.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+		if( libesedb_batch_append_record_data(
+		     (libesedb_internal_batch_t *) batch,
+		     internal_table,
+		     record_data,
+		     record_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append record: %d to batch.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+		record_entry++;
+
+		if( record_entry < last_record_entry )
+		{
+			result = libesedb_page_tree_get_next_leaf_value(
+			          internal_table->table_page_tree,
+			          internal_table->file_io_handle,
+			          record_data_definition,
+			          &leaf_value_key,
+			          &next_record_data_definition,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve leaf value: %d from table values tree.",
+				 function,
+				 record_entry );
+
+				goto on_error;
+			}
+			if( leaf_value_key != NULL )
+			{
+				if( libesedb_page_tree_key_free(
+				     &leaf_value_key,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free leaf value key.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		if( libesedb_data_definition_free(
+		     &record_data_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record: %d data definition.",
+			 function,
+			 record_entry - 1 );
+
+			goto on_error;
+		}
+		record_data_definition      = next_record_data_definition;
+		next_record_data_definition = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( leaf_value_key != NULL )
+	{
+		libesedb_page_tree_key_free(
+		 &leaf_value_key,
+		 NULL );
+	}
+	if( next_record_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &next_record_data_definition,
+		 NULL );
+	}
+	if( record_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &record_data_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves an Apache Arrow C stream of the records
+ * If column entries is NULL all the columns are exported
+ * Every array of the stream contains at most maximum number of records records
+ * The table must remain available until the stream is released
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_arrow_array_stream(
+     libesedb_table_t *table,
+     const int *column_entries,
+     int number_of_column_entries,
+     int maximum_number_of_records,
+     struct ArrowArrayStream *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_table_get_arrow_array_stream";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_arrow_stream_initialize(
+	     stream,
+	     table,
+	     column_entries,
+	     number_of_column_entries,
+	     maximum_number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
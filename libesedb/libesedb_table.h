@@ -31,6 +31,7 @@
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_long_value_cursor.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
@@ -39,6 +40,8 @@
 extern "C" {
 #endif
 
+struct ArrowArrayStream;
+
 typedef struct libesedb_internal_table libesedb_internal_table_t;
 
 struct libesedb_internal_table
@@ -82,6 +85,10 @@ struct libesedb_internal_table
 	/* The long values page tree
 	 */
 	libesedb_page_tree_t *long_values_page_tree;
+
+	/* The long value cursor
+	 */
+	libesedb_long_value_cursor_t *long_value_cursor;
 };
 
 int libesedb_table_initialize(
@@ -170,6 +177,22 @@ int libesedb_table_get_column(
      uint8_t flags,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_table_get_column_index_by_utf8_name(
+     libesedb_table_t *table,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *column_entry,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_column_index_by_utf16_name(
+     libesedb_table_t *table,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int *column_entry,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_table_get_number_of_indexes(
      libesedb_table_t *table,
@@ -196,6 +219,40 @@ int libesedb_table_get_record(
      libesedb_record_t **record,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_table_enable_sequential_long_values(
+     libesedb_table_t *table,
+     int maximum_number_of_buffered_values,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_next_record_by_filter(
+     libesedb_table_t *table,
+     libesedb_filter_t *filter,
+     int start_record_entry,
+     int *record_entry,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_read_batch(
+     libesedb_table_t *table,
+     int start_record_entry,
+     int number_of_records,
+     const int *column_entries,
+     int number_of_column_entries,
+     libesedb_batch_t *batch,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_arrow_array_stream(
+     libesedb_table_t *table,
+     const int *column_entries,
+     int number_of_column_entries,
+     int maximum_number_of_records,
+     struct ArrowArrayStream *stream,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -28,6 +28,8 @@
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
+#include "libesedb_libuna.h"
+#include "libesedb_name_hash_table.h"
 #include "libesedb_table_definition.h"
 
 /* Creates a table definition
@@ -268,6 +270,26 @@ int libesedb_table_definition_free(
 
 			result = -1;
 		}
+		if( ( *table_definition )->column_name_index != NULL )
+		{
+			memory_free(
+			 ( *table_definition )->column_name_index );
+		}
+		if( ( *table_definition )->column_identifier_index != NULL )
+		{
+			memory_free(
+			 ( *table_definition )->column_identifier_index );
+		}
+		if( ( *table_definition )->fixed_size_value_offsets != NULL )
+		{
+			memory_free(
+			 ( *table_definition )->fixed_size_value_offsets );
+		}
+		if( ( *table_definition )->leaf_page_descriptors != NULL )
+		{
+			memory_free(
+			 ( *table_definition )->leaf_page_descriptors );
+		}
 		memory_free(
 		 *table_definition );
 
@@ -483,8 +505,11 @@ int libesedb_table_definition_append_column_catalog_definition(
      libesedb_catalog_definition_t *column_catalog_definition,
      libcerror_error_t **error )
 {
+	void *reallocation    = NULL;
 	static char *function = "libesedb_table_definition_append_column_catalog_definition";
 	int entry_index       = 0;
+	int number_of_entries = 0;
+	int number_of_slots   = 0;
 
 	if( table_definition == NULL )
 	{
@@ -520,6 +545,62 @@ int libesedb_table_definition_append_column_catalog_definition(
 
 		return( -1 );
 	}
+	if( libcdata_array_get_number_of_entries(
+	     table_definition->column_catalog_definition_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from column catalog definition array.",
+		 function );
+
+		return( -1 );
+	}
+	/* The column indexes are kept at most half full so that the probe sequences remain short,
+	 * they are resized before the append so that the insert below cannot fail
+	 */
+	if( number_of_entries >= ( table_definition->number_of_column_index_slots / 2 ) )
+	{
+		number_of_slots = table_definition->number_of_column_index_slots * 2;
+
+		if( number_of_slots < 16 )
+		{
+			number_of_slots = 16;
+		}
+		if( libesedb_table_definition_resize_column_indexes(
+		     table_definition,
+		     number_of_slots,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize column indexes.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                table_definition->fixed_size_value_offsets,
+		                sizeof( uint32_t ) * ( number_of_slots / 2 ) );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize fixed size value offsets.",
+			 function );
+
+			return( -1 );
+		}
+		table_definition->fixed_size_value_offsets = (uint32_t *) reallocation;
+	}
 	if( libcdata_array_append_entry(
 	     table_definition->column_catalog_definition_array,
 	     &entry_index,
@@ -535,7 +616,909 @@ int libesedb_table_definition_append_column_catalog_definition(
 
 		return( -1 );
 	}
+	if( libesedb_table_definition_insert_column_index(
+	     table_definition,
+	     column_catalog_definition,
+	     entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert column catalog definition: %d into column indexes.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	/* The fixed size values are stored in order of the column catalog definitions
+	 * the size is not increased beyond the maximum offset, which is handled as out of bounds
+	 */
+	table_definition->fixed_size_value_offsets[ entry_index ] = table_definition->fixed_size_values_size;
+
+	if( ( column_catalog_definition->identifier <= 127 )
+	 && ( table_definition->fixed_size_values_size <= (uint32_t) UINT16_MAX ) )
+	{
+		if( column_catalog_definition->size > (uint32_t) UINT16_MAX )
+		{
+			table_definition->fixed_size_values_size = (uint32_t) UINT16_MAX + 1;
+		}
+		else
+		{
+			table_definition->fixed_size_values_size += column_catalog_definition->size;
+		}
+	}
+	return( 1 );
+}
+
+/* Determines the length of an ASCII (column) name
+ * The name is terminated by the end of the buffer or an end-of-string character
+ * Returns the length of the name or (size_t) -1 if the name contains non-ASCII characters
+ */
+size_t libesedb_table_definition_get_ascii_name_length(
+        const uint8_t *name,
+        size_t name_size )
+{
+	size_t name_index = 0;
+
+	if( name == NULL )
+	{
+		return( (size_t) -1 );
+	}
+	for( name_index = 0;
+	     name_index < name_size;
+	     name_index++ )
+	{
+		if( name[ name_index ] == 0 )
+		{
+			break;
+		}
+		if( name[ name_index ] >= 0x80 )
+		{
+			return( (size_t) -1 );
+		}
+	}
+	return( name_index );
+}
+
+/* Inserts a column catalog definition into the column indexes
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_definition_insert_column_index(
+     libesedb_table_definition_t *table_definition,
+     libesedb_catalog_definition_t *column_catalog_definition,
+     int definition_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_table_definition_insert_column_index";
+	size_t name_length    = 0;
+	uint32_t hash         = 0;
+	uint32_t slot_mask    = 0;
+
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( table_definition->column_name_index == NULL )
+	 || ( table_definition->column_identifier_index == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table definition - missing column indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( definition_index < 0 )
+	 || ( definition_index >= ( table_definition->number_of_column_index_slots / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid definition index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	slot_mask = (uint32_t) table_definition->number_of_column_index_slots - 1;
+
+	/* Earlier definitions precede later definitions in a probe sequence
+	 * hence a lookup returns the first definition with a specific name or identifier
+	 */
+	hash = column_catalog_definition->identifier * 0x9e3779b1UL;
+
+	while( table_definition->column_identifier_index[ hash & slot_mask ] != 0 )
+	{
+		hash++;
+	}
+	table_definition->column_identifier_index[ hash & slot_mask ] = definition_index + 1;
+
+	if( column_catalog_definition->name == NULL )
+	{
+		return( 1 );
+	}
+	name_length = libesedb_table_definition_get_ascii_name_length(
+	               column_catalog_definition->name,
+	               column_catalog_definition->name_size );
+
+	if( name_length == (size_t) -1 )
+	{
+		table_definition->has_non_ascii_column_names = 1;
+	}
+	else
+	{
+		if( libesedb_name_hash_table_calculate_hash_from_byte_stream(
+		     column_catalog_definition->name,
+		     name_length,
+		     0,
+		     &hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate name hash of column catalog definition: %d.",
+			 function,
+			 definition_index );
+
+			return( -1 );
+		}
+		while( table_definition->column_name_index[ hash & slot_mask ] != 0 )
+		{
+			hash++;
+		}
+		table_definition->column_name_index[ hash & slot_mask ] = definition_index + 1;
+	}
+	return( 1 );
+}
+
+/* Resizes the column indexes
+ * The number of slots must be a power of 2
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_definition_resize_column_indexes(
+     libesedb_table_definition_t *table_definition,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	static char *function                                    = "libesedb_table_definition_resize_column_indexes";
+	size_t index_size                                        = 0;
+	int *column_identifier_index                             = NULL;
+	int *column_name_index                                   = NULL;
+	int definition_index                                     = 0;
+	int number_of_definitions                                = 0;
+
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_slots <= 0 )
+	 || ( ( number_of_slots & ( number_of_slots - 1 ) ) != 0 )
+	 || ( (size_t) number_of_slots > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of slots value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     table_definition->column_catalog_definition_array,
+	     &number_of_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from column catalog definition array.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_definitions >= ( number_of_slots / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of slots value too small.",
+		 function );
+
+		return( -1 );
+	}
+	index_size = sizeof( int ) * (size_t) number_of_slots;
+
+	column_name_index = (int *) memory_allocate(
+	                             index_size );
+
+	if( column_name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create column name index.",
+		 function );
+
+		goto on_error;
+	}
+	column_identifier_index = (int *) memory_allocate(
+	                                   index_size );
+
+	if( column_identifier_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create column identifier index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     column_name_index,
+	     0,
+	     index_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear column name index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     column_identifier_index,
+	     0,
+	     index_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear column identifier index.",
+		 function );
+
+		goto on_error;
+	}
+	if( table_definition->column_name_index != NULL )
+	{
+		memory_free(
+		 table_definition->column_name_index );
+	}
+	if( table_definition->column_identifier_index != NULL )
+	{
+		memory_free(
+		 table_definition->column_identifier_index );
+	}
+	table_definition->column_name_index            = column_name_index;
+	table_definition->column_identifier_index      = column_identifier_index;
+	table_definition->number_of_column_index_slots = number_of_slots;
+	table_definition->has_non_ascii_column_names   = 0;
+
+	for( definition_index = 0;
+	     definition_index < number_of_definitions;
+	     definition_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     table_definition->column_catalog_definition_array,
+		     definition_index,
+		     (intptr_t **) &column_catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition: %d.",
+			 function,
+			 definition_index );
+
+			return( -1 );
+		}
+		if( libesedb_table_definition_insert_column_index(
+		     table_definition,
+		     column_catalog_definition,
+		     definition_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert column catalog definition: %d into column indexes.",
+			 function,
+			 definition_index );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
+
+on_error:
+	if( column_identifier_index != NULL )
+	{
+		memory_free(
+		 column_identifier_index );
+	}
+	if( column_name_index != NULL )
+	{
+		memory_free(
+		 column_name_index );
+	}
+	return( -1 );
+}
+
+/* Retrieves the index of the column catalog definition for an ASCII name
+ * Returns 1 if successful, 0 if no such column catalog definition or -1 on error
+ */
+int libesedb_table_definition_get_column_catalog_definition_index_by_ascii_name(
+     libesedb_table_definition_t *table_definition,
+     const uint8_t *name,
+     size_t name_length,
+     int *definition_index,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	static char *function                                    = "libesedb_table_definition_get_column_catalog_definition_index_by_ascii_name";
+	size_t column_name_length                                = 0;
+	uint32_t hash                                            = 0;
+	uint32_t slot_mask                                       = 0;
+	int slot_value                                           = 0;
+
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( definition_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid definition index.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->column_name_index == NULL )
+	{
+		return( 0 );
+	}
+	slot_mask = (uint32_t) table_definition->number_of_column_index_slots - 1;
+
+	if( libesedb_name_hash_table_calculate_hash_from_byte_stream(
+	     name,
+	     name_length,
+	     0,
+	     &hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate name hash.",
+		 function );
+
+		return( -1 );
+	}
+	/* The index is at most half full hence the probe sequence always ends in an empty slot
+	 */
+	slot_value = table_definition->column_name_index[ hash & slot_mask ];
+
+	while( slot_value != 0 )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     table_definition->column_catalog_definition_array,
+		     slot_value - 1,
+		     (intptr_t **) &column_catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition: %d.",
+			 function,
+			 slot_value - 1 );
+
+			return( -1 );
+		}
+		column_name_length = libesedb_table_definition_get_ascii_name_length(
+		                      column_catalog_definition->name,
+		                      column_catalog_definition->name_size );
+
+		if( column_name_length == name_length )
+		{
+			if( memory_compare(
+			     column_catalog_definition->name,
+			     name,
+			     name_length ) == 0 )
+			{
+				*definition_index = slot_value - 1;
+
+				return( 1 );
+			}
+		}
+		hash++;
+
+		slot_value = table_definition->column_name_index[ hash & slot_mask ];
+	}
+	return( 0 );
+}
+
+/* Retrieves the index of the column catalog definition for an UTF-8 encoded name
+ * Returns 1 if successful, 0 if no such column catalog definition or -1 on error
+ */
+int libesedb_table_definition_get_column_catalog_definition_index_by_utf8_name(
+     libesedb_table_definition_t *table_definition,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *definition_index,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	static char *function                                    = "libesedb_table_definition_get_column_catalog_definition_index_by_utf8_name";
+	size_t name_length                                       = 0;
+	int entry_index                                          = 0;
+	int number_of_definitions                                = 0;
+	int result                                               = 0;
+
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( definition_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid definition index.",
+		 function );
+
+		return( -1 );
+	}
+	name_length = libesedb_table_definition_get_ascii_name_length(
+	               utf8_string,
+	               utf8_string_length );
+
+	/* An ASCII string can only match an ASCII name which are stored in the column name index
+	 */
+	if( name_length != (size_t) -1 )
+	{
+		result = libesedb_table_definition_get_column_catalog_definition_index_by_ascii_name(
+		          table_definition,
+		          utf8_string,
+		          name_length,
+		          definition_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition index from column name index.",
+			 function );
+
+			return( -1 );
+		}
+		return( result );
+	}
+	if( table_definition->has_non_ascii_column_names == 0 )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     table_definition->column_catalog_definition_array,
+	     &number_of_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from column catalog definition array.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_definitions;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     table_definition->column_catalog_definition_array,
+		     entry_index,
+		     (intptr_t **) &column_catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( column_catalog_definition->name == NULL )
+		{
+			continue;
+		}
+		result = libesedb_catalog_definition_compare_name_with_utf8_string(
+		          column_catalog_definition,
+		          utf8_string,
+		          utf8_string_length,
+		          0,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare UTF-8 string with column catalog definition: %d name.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		else if( result == LIBUNA_COMPARE_EQUAL )
+		{
+			*definition_index = entry_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the index of the column catalog definition for an UTF-16 encoded name
+ * Returns 1 if successful, 0 if no such column catalog definition or -1 on error
+ */
+int libesedb_table_definition_get_column_catalog_definition_index_by_utf16_name(
+     libesedb_table_definition_t *table_definition,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int *definition_index,
+     libcerror_error_t **error )
+{
+	uint8_t name[ 256 ];
+
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	static char *function                                    = "libesedb_table_definition_get_column_catalog_definition_index_by_utf16_name";
+	size_t name_length                                       = 0;
+	int entry_index                                          = 0;
+	int number_of_definitions                                = 0;
+	int result                                               = 0;
+
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( definition_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid definition index.",
+		 function );
+
+		return( -1 );
+	}
+	/* An ASCII string can only match an ASCII name which are stored in the column name index
+	 * column names are at most 64 characters hence the fixed size buffer suffices
+	 */
+	for( name_length = 0;
+	     name_length < utf16_string_length;
+	     name_length++ )
+	{
+		if( ( utf16_string[ name_length ] == 0 )
+		 || ( utf16_string[ name_length ] >= 0x80 )
+		 || ( name_length >= sizeof( name ) ) )
+		{
+			break;
+		}
+		name[ name_length ] = (uint8_t) utf16_string[ name_length ];
+	}
+	if( ( name_length == utf16_string_length )
+	 || ( utf16_string[ name_length ] == 0 ) )
+	{
+		result = libesedb_table_definition_get_column_catalog_definition_index_by_ascii_name(
+		          table_definition,
+		          name,
+		          name_length,
+		          definition_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition index from column name index.",
+			 function );
+
+			return( -1 );
+		}
+		return( result );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     table_definition->column_catalog_definition_array,
+	     &number_of_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from column catalog definition array.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_definitions;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     table_definition->column_catalog_definition_array,
+		     entry_index,
+		     (intptr_t **) &column_catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( column_catalog_definition->name == NULL )
+		{
+			continue;
+		}
+		result = libesedb_catalog_definition_compare_name_with_utf16_string(
+		          column_catalog_definition,
+		          utf16_string,
+		          utf16_string_length,
+		          0,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare UTF-16 string with column catalog definition: %d name.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		else if( result == LIBUNA_COMPARE_EQUAL )
+		{
+			*definition_index = entry_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the index of the column catalog definition for a column identifier
+ * Returns 1 if successful, 0 if no such column catalog definition or -1 on error
+ */
+int libesedb_table_definition_get_column_catalog_definition_index_by_identifier(
+     libesedb_table_definition_t *table_definition,
+     uint32_t column_identifier,
+     int *definition_index,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	static char *function                                    = "libesedb_table_definition_get_column_catalog_definition_index_by_identifier";
+	uint32_t hash                                            = 0;
+	uint32_t slot_mask                                       = 0;
+	int slot_value                                           = 0;
+
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( definition_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid definition index.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->column_identifier_index == NULL )
+	{
+		return( 0 );
+	}
+	slot_mask = (uint32_t) table_definition->number_of_column_index_slots - 1;
+
+	hash = column_identifier * 0x9e3779b1UL;
+
+	slot_value = table_definition->column_identifier_index[ hash & slot_mask ];
+
+	while( slot_value != 0 )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     table_definition->column_catalog_definition_array,
+		     slot_value - 1,
+		     (intptr_t **) &column_catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition: %d.",
+			 function,
+			 slot_value - 1 );
+
+			return( -1 );
+		}
+		if( column_catalog_definition->identifier == column_identifier )
+		{
+			*definition_index = slot_value - 1;
+
+			return( 1 );
+		}
+		hash++;
+
+		slot_value = table_definition->column_identifier_index[ hash & slot_mask ];
+	}
+	return( 0 );
 }
 
 /* Retrieves the number of index catalog definitions
@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "libesedb_catalog_definition.h"
+#include "libesedb_leaf_page_descriptor.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 
@@ -56,6 +57,52 @@ struct libesedb_table_definition
 	/* The index catalog definition array
 	 */
 	libcdata_array_t *index_catalog_definition_array;
+
+	/* The column name hash index
+	 * every slot contains the column catalog definition index + 1 or 0 if empty
+	 */
+	int *column_name_index;
+
+	/* The column identifier hash index
+	 * every slot contains the column catalog definition index + 1 or 0 if empty
+	 */
+	int *column_identifier_index;
+
+	/* The number of slots in the column hash indexes
+	 */
+	int number_of_column_index_slots;
+
+	/* The fixed size value offsets
+	 * every entry contains the size of the fixed size values that precede the column catalog definition
+	 */
+	uint32_t *fixed_size_value_offsets;
+
+	/* The size of the fixed size values of the column catalog definitions
+	 */
+	uint32_t fixed_size_values_size;
+
+	/* Value to indicate a column name contains non-ASCII characters
+	 * these names are not stored in the column name hash index
+	 */
+	uint8_t has_non_ascii_column_names;
+
+	/* The catalog leaf page number that contains the table catalog definition
+	 * this value is 0 if the other catalog definitions of the table have been read
+	 */
+	uint32_t catalog_leaf_page_number;
+
+	/* The catalog page value index of the table catalog definition
+	 */
+	uint16_t catalog_page_value_index;
+
+	/* The leaf page descriptors of the table page tree
+	 * these are only set when the table definition is read from or written to a catalog cache
+	 */
+	libesedb_leaf_page_descriptor_t *leaf_page_descriptors;
+
+	/* The number of leaf page descriptors
+	 */
+	int number_of_leaf_page_descriptors;
 };
 
 int libesedb_table_definition_initialize(
@@ -93,6 +140,48 @@ int libesedb_table_definition_append_column_catalog_definition(
      libesedb_catalog_definition_t *column_catalog_definition,
      libcerror_error_t **error );
 
+size_t libesedb_table_definition_get_ascii_name_length(
+        const uint8_t *name,
+        size_t name_size );
+
+int libesedb_table_definition_insert_column_index(
+     libesedb_table_definition_t *table_definition,
+     libesedb_catalog_definition_t *column_catalog_definition,
+     int definition_index,
+     libcerror_error_t **error );
+
+int libesedb_table_definition_resize_column_indexes(
+     libesedb_table_definition_t *table_definition,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libesedb_table_definition_get_column_catalog_definition_index_by_ascii_name(
+     libesedb_table_definition_t *table_definition,
+     const uint8_t *name,
+     size_t name_length,
+     int *definition_index,
+     libcerror_error_t **error );
+
+int libesedb_table_definition_get_column_catalog_definition_index_by_utf8_name(
+     libesedb_table_definition_t *table_definition,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *definition_index,
+     libcerror_error_t **error );
+
+int libesedb_table_definition_get_column_catalog_definition_index_by_utf16_name(
+     libesedb_table_definition_t *table_definition,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int *definition_index,
+     libcerror_error_t **error );
+
+int libesedb_table_definition_get_column_catalog_definition_index_by_identifier(
+     libesedb_table_definition_t *table_definition,
+     uint32_t column_identifier,
+     int *definition_index,
+     libcerror_error_t **error );
+
 int libesedb_table_definition_get_number_of_index_catalog_definitions(
      libesedb_table_definition_t *table_definition,
      int *number_of_definitions,
@@ -94,6 +94,11 @@ AC_DEFUN([AX_ESEDBTOOLS_CHECK_LOCAL],
       [1])
   ])
 
+  dnl Headers and functions included in esedbtools/blob_store.c
+  AC_CHECK_HEADERS([errno.h fcntl.h sys/sendfile.h])
+
+  AC_CHECK_FUNCS([copy_file_range pread sendfile])
+
   AX_TOOLS_CHECK_ENABLE_MINGW_BINMODE
 ])
 
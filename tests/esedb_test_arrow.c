@@ -0,0 +1,675 @@
+/*
+ * Library Apache Arrow C data interface functions test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_arrow.h"
+#include "../libesedb/libesedb_batch.h"
+#include "../libesedb/libesedb_definitions.h"
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_arrow_get_format function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_arrow_get_format(
+     void )
+{
+	const char *format = NULL;
+	int result         = 0;
+
+	/* Test regular cases
+	 */
+	format = libesedb_arrow_get_format(
+	          LIBESEDB_BATCH_VALUE_FORMAT_INTEGER_64BIT,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "format",
+	 format );
+
+	result = memory_compare(
+	          format,
+	          "l",
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	format = libesedb_arrow_get_format(
+	          LIBESEDB_BATCH_VALUE_FORMAT_INTEGER_64BIT,
+	          LIBESEDB_COLUMN_TYPE_BOOLEAN );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "format",
+	 format );
+
+	result = memory_compare(
+	          format,
+	          "b",
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	format = libesedb_arrow_get_format(
+	          LIBESEDB_BATCH_VALUE_FORMAT_FILETIME,
+	          LIBESEDB_COLUMN_TYPE_DATE_TIME );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "format",
+	 format );
+
+	result = memory_compare(
+	          format,
+	          "tsu:UTC",
+	          8 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	format = libesedb_arrow_get_format(
+	          LIBESEDB_BATCH_VALUE_FORMAT_GUID,
+	          LIBESEDB_COLUMN_TYPE_GUID );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "format",
+	 format );
+
+	result = memory_compare(
+	          format,
+	          "w:16",
+	          5 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	format = libesedb_arrow_get_format(
+	          LIBESEDB_BATCH_VALUE_FORMAT_UTF8_STRING,
+	          LIBESEDB_COLUMN_TYPE_LARGE_TEXT );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "format",
+	 format );
+
+	result = memory_compare(
+	          format,
+	          "u",
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	format = libesedb_arrow_get_format(
+	          0,
+	          LIBESEDB_COLUMN_TYPE_NULL );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "format",
+	 format );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libesedb_arrow_get_null_count function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_arrow_get_null_count(
+     void )
+{
+	uint8_t validity_bitmap[ 2 ] = { 0xf5, 0x01 };
+	int64_t null_count           = 0;
+
+	/* Test regular cases
+	 */
+	null_count = libesedb_arrow_get_null_count(
+	              validity_bitmap,
+	              9 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "null_count",
+	 null_count,
+	 (int64_t) 2 );
+
+	null_count = libesedb_arrow_get_null_count(
+	              validity_bitmap,
+	              4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "null_count",
+	 null_count,
+	 (int64_t) 1 );
+
+	/* Test error cases
+	 */
+	null_count = libesedb_arrow_get_null_count(
+	              NULL,
+	              9 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "null_count",
+	 null_count,
+	 (int64_t) 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libesedb_arrow_schema_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_arrow_schema_initialize(
+     void )
+{
+	struct ArrowSchema schema;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_arrow_schema_initialize(
+	          &schema,
+	          "+l",
+	          "column",
+	          7,
+	          ARROW_FLAG_NULLABLE,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "schema.release",
+	 schema.release );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "schema.n_children",
+	 schema.n_children,
+	 (int64_t) 1 );
+
+	result = memory_compare(
+	          schema.name,
+	          "column",
+	          7 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_arrow_schema_initialize(
+	          schema.children[ 0 ],
+	          "l",
+	          "item",
+	          5,
+	          0,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	libesedb_arrow_schema_release(
+	 &schema );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "schema.release",
+	 schema.release );
+
+	/* Test error cases
+	 */
+	result = libesedb_arrow_schema_initialize(
+	          NULL,
+	          "l",
+	          "column",
+	          7,
+	          0,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_arrow_schema_initialize(
+	          &schema,
+	          NULL,
+	          "column",
+	          7,
+	          0,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_arrow_schema_initialize(
+	          &schema,
+	          "l",
+	          "column",
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_arrow_schema_initialize(
+	          &schema,
+	          "l",
+	          "column",
+	          7,
+	          0,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_arrow_array_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_arrow_array_initialize(
+     void )
+{
+	struct ArrowArray array;
+
+	libcerror_error_t *error                    = NULL;
+	libesedb_arrow_shared_batch_t *shared_batch = NULL;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	array.release = NULL;
+
+	shared_batch = memory_allocate_structure(
+	                libesedb_arrow_shared_batch_t );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "shared_batch",
+	 shared_batch );
+
+	shared_batch->batch           = NULL;
+	shared_batch->reference_count = 0;
+
+	result = libesedb_batch_initialize(
+	          &( shared_batch->batch ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_arrow_array_initialize(
+	          &array,
+	          shared_batch,
+	          0,
+	          1,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "shared_batch->reference_count",
+	 shared_batch->reference_count,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "array.n_children",
+	 array.n_children,
+	 (int64_t) 2 );
+
+	/* Test error cases
+	 */
+	result = libesedb_arrow_array_initialize(
+	          NULL,
+	          shared_batch,
+	          0,
+	          1,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_arrow_array_initialize(
+	          &array,
+	          NULL,
+	          0,
+	          1,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The release of the last array referencing the shared batch also frees the shared batch
+	 */
+	libesedb_arrow_array_release(
+	 &array );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "array.release",
+	 array.release );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( array.release != NULL )
+	{
+		libesedb_arrow_array_release(
+		 &array );
+	}
+	else if( shared_batch != NULL )
+	{
+		if( shared_batch->batch != NULL )
+		{
+			libesedb_batch_free(
+			 &( shared_batch->batch ),
+			 NULL );
+		}
+		memory_free(
+		 shared_batch );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_arrow_stream_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_arrow_stream_initialize(
+     void )
+{
+	struct ArrowArrayStream stream;
+
+	libcerror_error_t *error = NULL;
+	int column_entries[ 1 ]  = { 0 };
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_arrow_stream_initialize(
+	          NULL,
+	          (libesedb_table_t *) 0x12345678UL,
+	          NULL,
+	          0,
+	          1024,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_arrow_stream_initialize(
+	          &stream,
+	          NULL,
+	          NULL,
+	          0,
+	          1024,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_arrow_stream_initialize(
+	          &stream,
+	          (libesedb_table_t *) 0x12345678UL,
+	          column_entries,
+	          0,
+	          1024,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_arrow_stream_initialize(
+	          &stream,
+	          (libesedb_table_t *) 0x12345678UL,
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_arrow_get_format",
+	 esedb_test_arrow_get_format );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_arrow_get_null_count",
+	 esedb_test_arrow_get_null_count );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_arrow_schema_initialize",
+	 esedb_test_arrow_schema_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_arrow_array_initialize",
+	 esedb_test_arrow_array_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_arrow_stream_initialize",
+	 esedb_test_arrow_stream_initialize );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1155 @@
+/*
+ * Library batch type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_batch.h"
+#include "../libesedb/libesedb_definitions.h"
+
+/* Tests the libesedb_batch_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_batch_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libesedb_batch_t *batch         = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libesedb_batch_initialize(
+	          &batch,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "batch",
+	 batch );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_batch_free(
+	          &batch,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "batch",
+	 batch );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_batch_initialize(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	batch = (libesedb_batch_t *) 0x12345678UL;
+
+	result = libesedb_batch_initialize(
+	          &batch,
+	          &error );
+
+	batch = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_batch_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_batch_initialize(
+		          &batch,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( batch != NULL )
+			{
+				libesedb_batch_free(
+				 &batch,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "batch",
+			 batch );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_batch_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_batch_initialize(
+		          &batch,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( batch != NULL )
+			{
+				libesedb_batch_free(
+				 &batch,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "batch",
+			 batch );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch != NULL )
+	{
+		libesedb_batch_free(
+		 &batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_batch_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_batch_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_batch_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_batch_get_number_of_records function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_batch_get_number_of_records(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libesedb_batch_t *batch  = NULL;
+	int number_of_records    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_batch_initialize(
+	          &batch,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "batch",
+	 batch );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_batch_get_number_of_records(
+	          batch,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_batch_get_number_of_records(
+	          NULL,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_batch_get_number_of_records(
+	          batch,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_batch_free(
+	          &batch,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "batch",
+	 batch );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch != NULL )
+	{
+		libesedb_batch_free(
+		 &batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_batch_get_column_values function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_batch_get_column_values(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libesedb_batch_t *batch  = NULL;
+	const uint8_t *values    = NULL;
+	size_t values_size       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_batch_initialize(
+	          &batch,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "batch",
+	 batch );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_batch_get_column_values(
+	          NULL,
+	          0,
+	          &values,
+	          &values_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* An empty batch has no columns
+	 */
+	result = libesedb_batch_get_column_values(
+	          batch,
+	          0,
+	          &values,
+	          &values_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_batch_get_column_values(
+	          batch,
+	          0,
+	          NULL,
+	          &values_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_batch_free(
+	          &batch,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "batch",
+	 batch );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch != NULL )
+	{
+		libesedb_batch_free(
+		 &batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_batch_get_value_format function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_batch_get_value_format(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t value_size        = 0;
+	int result               = 0;
+	int value_format         = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_batch_get_value_format(
+	          LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED,
+	          &value_format,
+	          &value_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "value_format",
+	 value_format,
+	 LIBESEDB_BATCH_VALUE_FORMAT_INTEGER_64BIT );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_size",
+	 value_size,
+	 (size_t) 8 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_batch_get_value_format(
+	          LIBESEDB_COLUMN_TYPE_GUID,
+	          &value_format,
+	          &value_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "value_format",
+	 value_format,
+	 LIBESEDB_BATCH_VALUE_FORMAT_GUID );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_size",
+	 value_size,
+	 (size_t) 16 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_batch_get_value_format(
+	          LIBESEDB_COLUMN_TYPE_LARGE_TEXT,
+	          &value_format,
+	          &value_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "value_format",
+	 value_format,
+	 LIBESEDB_BATCH_VALUE_FORMAT_UTF8_STRING );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_size",
+	 value_size,
+	 (size_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_batch_get_value_format(
+	          0xffffffffUL,
+	          &value_format,
+	          &value_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_batch_get_value_format(
+	          LIBESEDB_COLUMN_TYPE_BOOLEAN,
+	          NULL,
+	          &value_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_batch_get_value_format(
+	          LIBESEDB_COLUMN_TYPE_BOOLEAN,
+	          &value_format,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_batch_column_copy_fixed_size_value function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_batch_column_copy_fixed_size_value(
+     void )
+{
+	uint8_t value_data[ 4 ]              = { 0xfe, 0xff, 0xff, 0xff };
+	uint8_t values[ 16 ];
+
+	libesedb_batch_column_t batch_column;
+
+	libcerror_error_t *error             = NULL;
+	int64_t value_64bit                  = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &batch_column,
+	 0,
+	 sizeof( libesedb_batch_column_t ) );
+
+	batch_column.column_type  = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED;
+	batch_column.value_format = LIBESEDB_BATCH_VALUE_FORMAT_INTEGER_64BIT;
+	batch_column.value_size   = 8;
+	batch_column.values       = values;
+
+	/* Test regular cases
+	 */
+	result = libesedb_batch_column_copy_fixed_size_value(
+	          &batch_column,
+	          1,
+	          value_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_copy(
+	 &value_64bit,
+	 &( values[ 8 ] ),
+	 sizeof( int64_t ) );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "value_64bit",
+	 value_64bit,
+	 (int64_t) -2 );
+
+	batch_column.column_type = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED;
+
+	result = libesedb_batch_column_copy_fixed_size_value(
+	          &batch_column,
+	          0,
+	          value_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_copy(
+	 &value_64bit,
+	 values,
+	 sizeof( int64_t ) );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "value_64bit",
+	 value_64bit,
+	 (int64_t) 0xfffffffeUL );
+
+	/* Test error cases
+	 */
+	result = libesedb_batch_column_copy_fixed_size_value(
+	          NULL,
+	          0,
+	          value_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_batch_column_copy_fixed_size_value(
+	          &batch_column,
+	          0,
+	          NULL,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_batch_column_copy_fixed_size_value(
+	          &batch_column,
+	          0,
+	          value_data,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_batch_column_append_multi_value function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_batch_column_append_multi_value(
+     void )
+{
+	uint8_t value_data[ 12 ] = {
+		0x04, 0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff };
+	uint8_t values[ 32 ];
+
+	libesedb_batch_column_t batch_column;
+
+	libcerror_error_t *error = NULL;
+	int64_t value_64bit      = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &batch_column,
+	 0,
+	 sizeof( libesedb_batch_column_t ) );
+
+	batch_column.column_type                = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED;
+	batch_column.value_format               = LIBESEDB_BATCH_VALUE_FORMAT_INTEGER_64BIT;
+	batch_column.value_size                 = 8;
+	batch_column.values                     = values;
+	batch_column.maximum_number_of_elements = 4;
+
+	/* Test regular cases
+	 */
+	result = libesedb_batch_column_append_multi_value(
+	          &batch_column,
+	          0,
+	          value_data,
+	          12,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "batch_column.number_of_elements",
+	 batch_column.number_of_elements,
+	 2 );
+
+	memory_copy(
+	 &value_64bit,
+	 values,
+	 sizeof( int64_t ) );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "value_64bit",
+	 value_64bit,
+	 (int64_t) 1 );
+
+	memory_copy(
+	 &value_64bit,
+	 &( values[ 8 ] ),
+	 sizeof( int64_t ) );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "value_64bit",
+	 value_64bit,
+	 (int64_t) -2 );
+
+	/* Test error cases
+	 */
+	result = libesedb_batch_column_append_multi_value(
+	          NULL,
+	          0,
+	          value_data,
+	          12,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_batch_column_append_multi_value(
+	          &batch_column,
+	          0,
+	          NULL,
+	          12,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the value offsets exceed the value data
+	 */
+	result = libesedb_batch_column_append_multi_value(
+	          &batch_column,
+	          0,
+	          value_data,
+	          6,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_batch_column_resize_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_batch_column_resize_data(
+     void )
+{
+	libesedb_batch_column_t batch_column;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &batch_column,
+	 0,
+	 sizeof( libesedb_batch_column_t ) );
+
+	/* Test regular cases
+	 */
+	result = libesedb_batch_column_resize_data(
+	          &batch_column,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "batch_column.data",
+	 batch_column.data );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "batch_column.allocated_data_size",
+	 batch_column.allocated_data_size,
+	 (size_t) 4096 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_batch_column_resize_data(
+	          &batch_column,
+	          5000,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "batch_column.allocated_data_size",
+	 batch_column.allocated_data_size,
+	 (size_t) 8192 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_batch_column_resize_data(
+	          NULL,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_batch_column_resize_data(
+	          &batch_column,
+	          (size_t) INT_MAX + 1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 batch_column.data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch_column.data != NULL )
+	{
+		memory_free(
+		 batch_column.data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_batch_initialize",
+	 esedb_test_batch_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_batch_free",
+	 esedb_test_batch_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_batch_get_number_of_records",
+	 esedb_test_batch_get_number_of_records );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_batch_get_column_values",
+	 esedb_test_batch_get_column_values );
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_batch_get_value_format",
+	 esedb_test_batch_get_value_format );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_batch_column_copy_fixed_size_value",
+	 esedb_test_batch_column_copy_fixed_size_value );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_batch_column_resize_data",
+	 esedb_test_batch_column_resize_data );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_batch_column_append_multi_value",
+	 esedb_test_batch_column_append_multi_value );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -37,7 +38,10 @@
 #include "esedb_test_unused.h"
 
 #include "../libesedb/libesedb_catalog.h"
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_definitions.h"
 #include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_table_definition.h"
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
@@ -680,6 +684,7 @@ int esedb_test_catalog_get_table_definition_by_name(
 	          catalog,
 	          (uint8_t *) name,
 	          4,
+	          0,
 	          &table_definition,
 	          &error );
 
@@ -698,6 +703,7 @@ int esedb_test_catalog_get_table_definition_by_name(
 	          NULL,
 	          (uint8_t *) name,
 	          4,
+	          0,
 	          &table_definition,
 	          &error );
 
@@ -721,6 +727,7 @@ int esedb_test_catalog_get_table_definition_by_name(
 	          catalog,
 	          (uint8_t *) name,
 	          4,
+	          0,
 	          &table_definition,
 	          &error );
 
@@ -742,6 +749,7 @@ int esedb_test_catalog_get_table_definition_by_name(
 	          catalog,
 	          NULL,
 	          4,
+	          0,
 	          &table_definition,
 	          &error );
 
@@ -761,6 +769,7 @@ int esedb_test_catalog_get_table_definition_by_name(
 	          catalog,
 	          (uint8_t *) name,
 	          (size_t) SSIZE_MAX + 1,
+	          0,
 	          &table_definition,
 	          &error );
 
@@ -780,6 +789,7 @@ int esedb_test_catalog_get_table_definition_by_name(
 	          catalog,
 	          (uint8_t *) name,
 	          4,
+	          0,
 	          NULL,
 	          &error );
 
@@ -825,6 +835,7 @@ int esedb_test_catalog_get_table_definition_by_utf8_name(
 	          catalog,
 	          utf8_name,
 	          4,
+	          0,
 	          &table_definition,
 	          &error );
 
@@ -843,6 +854,7 @@ int esedb_test_catalog_get_table_definition_by_utf8_name(
 	          NULL,
 	          utf8_name,
 	          4,
+	          0,
 	          &table_definition,
 	          &error );
 
@@ -866,6 +878,7 @@ int esedb_test_catalog_get_table_definition_by_utf8_name(
 	          catalog,
 	          utf8_name,
 	          4,
+	          0,
 	          &table_definition,
 	          &error );
 
@@ -887,6 +900,7 @@ int esedb_test_catalog_get_table_definition_by_utf8_name(
 	          catalog,
 	          NULL,
 	          4,
+	          0,
 	          &table_definition,
 	          &error );
 
@@ -906,6 +920,7 @@ int esedb_test_catalog_get_table_definition_by_utf8_name(
 	          catalog,
 	          utf8_name,
 	          (size_t) SSIZE_MAX + 1,
+	          0,
 	          &table_definition,
 	          &error );
 
@@ -925,6 +940,7 @@ int esedb_test_catalog_get_table_definition_by_utf8_name(
 	          catalog,
 	          utf8_name,
 	          4,
+	          0,
 	          NULL,
 	          &error );
 
@@ -970,6 +986,7 @@ int esedb_test_catalog_get_table_definition_by_utf16_name(
 	          catalog,
 	          utf16_name,
 	          4,
+	          0,
 	          &table_definition,
 	          &error );
 
@@ -988,6 +1005,7 @@ int esedb_test_catalog_get_table_definition_by_utf16_name(
 	          NULL,
 	          utf16_name,
 	          4,
+	          0,
 	          &table_definition,
 	          &error );
 
@@ -1011,6 +1029,7 @@ int esedb_test_catalog_get_table_definition_by_utf16_name(
 	          catalog,
 	          utf16_name,
 	          4,
+	          0,
 	          &table_definition,
 	          &error );
 
@@ -1032,6 +1051,7 @@ int esedb_test_catalog_get_table_definition_by_utf16_name(
 	          catalog,
 	          NULL,
 	          4,
+	          0,
 	          &table_definition,
 	          &error );
 
@@ -1051,6 +1071,7 @@ int esedb_test_catalog_get_table_definition_by_utf16_name(
 	          catalog,
 	          utf16_name,
 	          (size_t) SSIZE_MAX + 1,
+	          0,
 	          &table_definition,
 	          &error );
 
@@ -1070,6 +1091,310 @@ int esedb_test_catalog_get_table_definition_by_utf16_name(
 	          catalog,
 	          utf16_name,
 	          4,
+	          0,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_build_table_name_hash_tables function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_build_table_name_hash_tables(
+     libesedb_catalog_t *catalog )
+{
+	uint8_t utf8_name[ 11 ]                                 = { 'm', 's', 'y', 's', 'o', 'b', 'j', 'e', 'c', 't', 's' };
+	uint16_t utf16_name[ 11 ]                               = { 'M', 'S', 'Y', 'S', 'O', 'B', 'J', 'E', 'C', 'T', 'S' };
+
+	libcerror_error_t *error                                = NULL;
+	libesedb_catalog_definition_t *table_catalog_definition = NULL;
+	libesedb_table_definition_t *lookup_table_definition    = NULL;
+	libesedb_table_definition_t *table_definition           = NULL;
+	int entry_index                                         = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_catalog_definition_initialize(
+	          &table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_catalog_definition",
+	 table_catalog_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	table_catalog_definition->type = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+
+	table_catalog_definition->name = (uint8_t *) memory_allocate(
+	                                              sizeof( uint8_t ) * 11 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_catalog_definition->name",
+	 table_catalog_definition->name );
+
+	table_catalog_definition->name_size = 11;
+
+	if( memory_copy(
+	     table_catalog_definition->name,
+	     "MSysObjects",
+	     11 ) == NULL )
+	{
+		goto on_error;
+	}
+
+	result = libesedb_table_definition_initialize(
+	          &table_definition,
+	          table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	table_catalog_definition = NULL;
+
+	result = libcdata_array_append_entry(
+	          catalog->table_definition_array,
+	          &entry_index,
+	          (intptr_t *) table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	table_definition = NULL;
+
+	/* Test regular cases
+	 */
+	result = libesedb_catalog_build_table_name_hash_tables(
+	          catalog,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog->table_name_hash_table",
+	 catalog->table_name_hash_table );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog->case_folded_table_name_hash_table",
+	 catalog->case_folded_table_name_hash_table );
+
+	result = libesedb_catalog_get_table_definition_by_name(
+	          catalog,
+	          (uint8_t *) "MSysObjects",
+	          11,
+	          0,
+	          &lookup_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "lookup_table_definition",
+	 lookup_table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	lookup_table_definition = NULL;
+
+	result = libesedb_catalog_get_table_definition_by_name(
+	          catalog,
+	          (uint8_t *) "MSYSOBJECTS",
+	          11,
+	          0,
+	          &lookup_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_table_definition_by_name(
+	          catalog,
+	          (uint8_t *) "MSYSOBJECTS",
+	          11,
+	          1,
+	          &lookup_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "lookup_table_definition",
+	 lookup_table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	lookup_table_definition = NULL;
+
+	result = libesedb_catalog_get_table_definition_by_utf8_name(
+	          catalog,
+	          utf8_name,
+	          11,
+	          0,
+	          &lookup_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_table_definition_by_utf8_name(
+	          catalog,
+	          utf8_name,
+	          11,
+	          1,
+	          &lookup_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "lookup_table_definition",
+	 lookup_table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	lookup_table_definition = NULL;
+
+	result = libesedb_catalog_get_table_definition_by_utf8_name(
+	          catalog,
+	          utf8_name,
+	          10,
+	          1,
+	          &lookup_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_table_definition_by_utf16_name(
+	          catalog,
+	          utf16_name,
+	          11,
+	          0,
+	          &lookup_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_table_definition_by_utf16_name(
+	          catalog,
+	          utf16_name,
+	          11,
+	          1,
+	          &lookup_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "lookup_table_definition",
+	 lookup_table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	lookup_table_definition = NULL;
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_build_table_name_hash_tables(
 	          NULL,
 	          &error );
 
@@ -1093,6 +1418,18 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	if( table_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &table_catalog_definition,
+		 NULL );
+	}
 	return( 0 );
 }
 
@@ -1213,6 +1550,11 @@ int main(
 	 esedb_test_catalog_get_table_definition_by_utf16_name,
 	 catalog );
 
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_catalog_build_table_name_hash_tables",
+	 esedb_test_catalog_build_table_name_hash_tables,
+	 catalog );
+
 	/* Clean up
 	 */
 	result = libesedb_catalog_free(
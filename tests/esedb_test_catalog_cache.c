@@ -0,0 +1,759 @@
+/*
+ * Library catalog_cache type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_catalog_cache.h"
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_leaf_page_descriptor.h"
+#include "../libesedb/libesedb_table_definition.h"
+
+/* Catalog definition: MSysObjects with name
+ */
+uint8_t esedb_test_catalog_cache_value_data1[ 45 ] = {
+	0x08, 0x80, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x14, 0x00, 0x00, 0x00, 0xff, 0x00,
+	0x0b, 0x00, 0x4d, 0x53, 0x79, 0x73, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x73 };
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_catalog_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libesedb_catalog_cache_t *catalog_cache = NULL;
+	int result                              = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests         = 1;
+	int number_of_memset_fail_tests         = 1;
+	int test_number                         = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libesedb_catalog_cache_initialize(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_free(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_cache_initialize(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	catalog_cache = (libesedb_catalog_cache_t *) 0x12345678UL;
+
+	result = libesedb_catalog_cache_initialize(
+	          &catalog_cache,
+	          &error );
+
+	catalog_cache = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_catalog_cache_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_catalog_cache_initialize(
+		          &catalog_cache,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( catalog_cache != NULL )
+			{
+				libesedb_catalog_cache_free(
+				 &catalog_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "catalog_cache",
+			 catalog_cache );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_catalog_cache_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_catalog_cache_initialize(
+		          &catalog_cache,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( catalog_cache != NULL )
+			{
+				libesedb_catalog_cache_free(
+				 &catalog_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "catalog_cache",
+			 catalog_cache );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( catalog_cache != NULL )
+	{
+		libesedb_catalog_cache_free(
+		 &catalog_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_cache_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_cache_append_table_definition and libesedb_catalog_cache_get_next_table_definition functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_cache_append_table_definition(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libesedb_catalog_cache_t *catalog_cache            = NULL;
+	libesedb_catalog_definition_t *catalog_definition  = NULL;
+	libesedb_table_definition_t *read_table_definition = NULL;
+	libesedb_table_definition_t *table_definition      = NULL;
+	size_t data_offset                                 = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_catalog_cache_initialize(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_initialize(
+	          &catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_read_data(
+	          catalog_definition,
+	          esedb_test_catalog_cache_value_data1,
+	          45,
+	          LIBESEDB_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_initialize(
+	          &table_definition,
+	          catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	catalog_definition = NULL;
+
+	table_definition->leaf_page_descriptors = (libesedb_leaf_page_descriptor_t *) memory_allocate(
+	                                                                               sizeof( libesedb_leaf_page_descriptor_t ) * 2 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition->leaf_page_descriptors",
+	 table_definition->leaf_page_descriptors );
+
+	table_definition->leaf_page_descriptors[ 0 ].page_number            = 5;
+	table_definition->leaf_page_descriptors[ 0 ].first_leaf_value_index = 0;
+	table_definition->leaf_page_descriptors[ 0 ].last_leaf_value_index  = 9;
+	table_definition->leaf_page_descriptors[ 1 ].page_number            = 7;
+	table_definition->leaf_page_descriptors[ 1 ].first_leaf_value_index = 10;
+	table_definition->leaf_page_descriptors[ 1 ].last_leaf_value_index  = 12;
+	table_definition->number_of_leaf_page_descriptors                   = 2;
+
+	/* Test regular cases
+	 */
+	result = libesedb_catalog_cache_append_table_definition(
+	          catalog_cache,
+	          table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "catalog_cache->number_of_table_definitions",
+	 catalog_cache->number_of_table_definitions,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "catalog_cache->data_size",
+	 catalog_cache->data_size,
+	 (size_t) 83 );
+
+	result = libesedb_catalog_cache_get_next_table_definition(
+	          catalog_cache,
+	          &data_offset,
+	          &read_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "read_table_definition",
+	 read_table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 83 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "read_table_definition->table_catalog_definition->identifier",
+	 read_table_definition->table_catalog_definition->identifier,
+	 table_definition->table_catalog_definition->identifier );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "read_table_definition->table_catalog_definition->father_data_page_number",
+	 read_table_definition->table_catalog_definition->father_data_page_number,
+	 table_definition->table_catalog_definition->father_data_page_number );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "read_table_definition->table_catalog_definition->name_size",
+	 read_table_definition->table_catalog_definition->name_size,
+	 (size_t) 11 );
+
+	result = memory_compare(
+	          read_table_definition->table_catalog_definition->name,
+	          "MSysObjects",
+	          11 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "read_table_definition->long_value_catalog_definition",
+	 read_table_definition->long_value_catalog_definition );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "read_table_definition->number_of_leaf_page_descriptors",
+	 read_table_definition->number_of_leaf_page_descriptors,
+	 2 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "read_table_definition->leaf_page_descriptors",
+	 read_table_definition->leaf_page_descriptors );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "read_table_definition->leaf_page_descriptors[ 1 ].page_number",
+	 read_table_definition->leaf_page_descriptors[ 1 ].page_number,
+	 7 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "read_table_definition->leaf_page_descriptors[ 1 ].first_leaf_value_index",
+	 read_table_definition->leaf_page_descriptors[ 1 ].first_leaf_value_index,
+	 10 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "read_table_definition->leaf_page_descriptors[ 1 ].last_leaf_value_index",
+	 read_table_definition->leaf_page_descriptors[ 1 ].last_leaf_value_index,
+	 12 );
+
+	result = libesedb_table_definition_free(
+	          &read_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_get_next_table_definition(
+	          catalog_cache,
+	          &data_offset,
+	          &read_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_cache_append_table_definition(
+	          NULL,
+	          table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_cache_append_table_definition(
+	          catalog_cache,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data_offset = 0;
+
+	result = libesedb_catalog_cache_get_next_table_definition(
+	          NULL,
+	          &data_offset,
+	          &read_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_cache_get_next_table_definition(
+	          catalog_cache,
+	          NULL,
+	          &read_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_cache_get_next_table_definition(
+	          catalog_cache,
+	          &data_offset,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test get next table definition with truncated data
+	 */
+	catalog_cache->data_size -= 1;
+
+	result = libesedb_catalog_cache_get_next_table_definition(
+	          catalog_cache,
+	          &data_offset,
+	          &read_table_definition,
+	          &error );
+
+	catalog_cache->data_size += 1;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "read_table_definition",
+	 read_table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test get next table definition with an invalid leaf page descriptor
+	 */
+	catalog_cache->data[ 67 ] = 0;
+
+	result = libesedb_catalog_cache_get_next_table_definition(
+	          catalog_cache,
+	          &data_offset,
+	          &read_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "read_table_definition",
+	 read_table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_table_definition_free(
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_free(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &read_table_definition,
+		 NULL );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	if( catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &catalog_definition,
+		 NULL );
+	}
+	if( catalog_cache != NULL )
+	{
+		libesedb_catalog_cache_free(
+		 &catalog_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_cache_initialize",
+	 esedb_test_catalog_cache_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_cache_free",
+	 esedb_test_catalog_cache_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_cache_append_table_definition",
+	 esedb_test_catalog_cache_append_table_definition );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -289,6 +289,143 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_catalog_definition_read_type function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_definition_read_type(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint16_t type            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_catalog_definition_read_type(
+	          esedb_test_catalog_definition_data1,
+	          45,
+	          &type,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "type",
+	 type,
+	 (uint16_t) 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_read_type(
+	          esedb_test_catalog_definition_data2,
+	          97,
+	          &type,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "type",
+	 type,
+	 (uint16_t) 2 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_definition_read_type(
+	          NULL,
+	          45,
+	          &type,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_definition_read_type(
+	          esedb_test_catalog_definition_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &type,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_definition_read_type(
+	          esedb_test_catalog_definition_data1,
+	          8,
+	          &type,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_definition_read_type(
+	          esedb_test_catalog_definition_data1,
+	          45,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libesedb_catalog_definition_read_data function
  * Returns 1 if successful or 0 if not
  */
@@ -1592,6 +1729,10 @@ int main(
 	 "libesedb_catalog_definition_free",
 	 esedb_test_catalog_definition_free );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_definition_read_type",
+	 esedb_test_catalog_definition_read_type );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_catalog_definition_read_data",
 	 esedb_test_catalog_definition_read_data );
@@ -64,6 +64,21 @@ uint16_t esedb_test_compression_7bit_uncompressed_utf16_string[ 56 ] = {
 	0x20, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x29, 0x00
 };
 
+/* The UTF-16 little-endian sequence: A \u0441 \u4e2d compressed in 7-bit
+ * including leading byte 0x00
+ */
+uint8_t esedb_test_compression_7bit_unicode_compressed_data[ 8 ] = {
+	0x00, 0x41, 0x40, 0x90, 0xd0, 0x72, 0x02, 0x00
+};
+
+uint8_t esedb_test_compression_7bit_unicode_uncompressed_utf8_string[ 7 ] = {
+	0x41, 0xd1, 0x81, 0xe4, 0xb8, 0xad, 0x00
+};
+
+uint16_t esedb_test_compression_7bit_unicode_uncompressed_utf16_string[ 4 ] = {
+	0x0041, 0x0441, 0x4e2d, 0x0000
+};
+
 /* The sequence: abcdefghijklmnopqrstuvwxyz compressed in LZXpress
  * including leading byte 0x18 and uncompressed data size 0x001a
  */
@@ -72,6 +87,26 @@ uint8_t esedb_test_compression_lzxpress_compressed_data[ 33 ] = {
 	0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
 	0x7a };
 
+/* Xpress9 compressed data that is not supported
+ */
+uint8_t esedb_test_compression_xpress9_compressed_data[ 8 ] = {
+	0x28, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Xpress10 compressed data that is not supported
+ */
+uint8_t esedb_test_compression_xpress10_compressed_data[ 8 ] = {
+	0x30, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* The sequence: abc as an UTF-16 little-endian stream
+ */
+uint8_t esedb_test_compression_uncompressed_utf16_stream[ 6 ] = {
+	0x61, 0x00, 0x62, 0x00, 0x63, 0x00 };
+
+/* The sequence: abc as an UTF-8 stream
+ */
+uint8_t esedb_test_compression_uncompressed_utf8_stream[ 3 ] = {
+	0x61, 0x62, 0x63 };
+
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
 /* Tests the libesedb_compression_7bit_decompress_get_size function
@@ -394,22 +429,19 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_compression_lzxpress_decompress_get_size function
+/* Tests the libesedb_compression_7bit_kernel_is_supported function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_compression_lzxpress_decompress_get_size(
+int esedb_test_compression_7bit_kernel_is_supported(
      void )
 {
-	libcerror_error_t *error      = NULL;
-	size_t uncompressed_data_size = 0;
-	int result                    = 0;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libesedb_compression_lzxpress_decompress_get_size(
-	          esedb_test_compression_lzxpress_compressed_data,
-	          33,
-	          &uncompressed_data_size,
+	result = libesedb_compression_7bit_kernel_is_supported(
+	          LIBESEDB_COMPRESSION_7BIT_KERNEL_SCALAR,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -417,57 +449,40 @@ int esedb_test_compression_lzxpress_decompress_get_size(
 	 result,
 	 1 );
 
-	ESEDB_TEST_ASSERT_EQUAL_SIZE(
-	 "uncompressed_data_size",
-	 uncompressed_data_size,
-	 (size_t) 26 );
-
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libesedb_compression_lzxpress_decompress_get_size(
-	          NULL,
-	          33,
-	          &uncompressed_data_size,
+	result = libesedb_compression_7bit_kernel_is_supported(
+	          LIBESEDB_COMPRESSION_7BIT_KERNEL_SSSE3,
 	          &error );
 
-	ESEDB_TEST_ASSERT_EQUAL_INT(
+	ESEDB_TEST_ASSERT_NOT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libesedb_compression_lzxpress_decompress_get_size(
-	          esedb_test_compression_lzxpress_compressed_data,
-	          (size_t) SSIZE_MAX + 1,
-	          &uncompressed_data_size,
+	result = libesedb_compression_7bit_kernel_is_supported(
+	          LIBESEDB_COMPRESSION_7BIT_KERNEL_AVX2,
 	          &error );
 
-	ESEDB_TEST_ASSERT_EQUAL_INT(
+	ESEDB_TEST_ASSERT_NOT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libesedb_compression_lzxpress_decompress_get_size(
-	          esedb_test_compression_lzxpress_compressed_data,
-	          0,
-	          &uncompressed_data_size,
+	/* Test error cases
+	 */
+	result = libesedb_compression_7bit_kernel_is_supported(
+	          -1,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -482,10 +497,193 @@ int esedb_test_compression_lzxpress_decompress_get_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_lzxpress_decompress_get_size(
-	          esedb_test_compression_lzxpress_compressed_data,
-	          33,
-	          NULL,
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_7bit_get_kernel function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_7bit_get_kernel(
+     void )
+{
+	int kernel = 0;
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	kernel = libesedb_compression_7bit_get_kernel();
+
+	result = libesedb_compression_7bit_kernel_is_supported(
+	          kernel,
+	          NULL );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_7bit_decompress_with_kernel function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_7bit_decompress_with_kernel(
+     void )
+{
+	uint8_t compressed_data[ 1025 ];
+	uint8_t expected_data[ 1170 ];
+	uint8_t uncompressed_data[ 1170 ];
+
+	libcerror_error_t *error       = NULL;
+	size_t compressed_data_size    = 0;
+	size_t uncompressed_data_index = 0;
+	size_t uncompressed_data_size  = 0;
+	uint32_t random_value          = 0x12345678UL;
+	int iterator                   = 0;
+	int kernel                     = 0;
+	int result                     = 0;
+
+	for( kernel = LIBESEDB_COMPRESSION_7BIT_KERNEL_SCALAR;
+	     kernel <= LIBESEDB_COMPRESSION_7BIT_KERNEL_AVX2;
+	     kernel++ )
+	{
+		result = libesedb_compression_7bit_kernel_is_supported(
+		          kernel,
+		          NULL );
+
+		if( result != 1 )
+		{
+			continue;
+		}
+		/* Test regular cases
+		 */
+		result = libesedb_compression_7bit_decompress_with_kernel(
+		          esedb_test_compression_7bit_compressed_data,
+		          50,
+		          uncompressed_data,
+		          64,
+		          kernel,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          esedb_test_compression_7bit_uncompressed_data,
+		          56 );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test random data of every size up to 1024 compressed bytes
+		 * against the result of the scalar kernel
+		 */
+		for( compressed_data_size = 2;
+		     compressed_data_size <= 1025;
+		     compressed_data_size++ )
+		{
+			compressed_data[ 0 ] = 0x10;
+
+			for( iterator = 1;
+			     iterator < (int) compressed_data_size;
+			     iterator++ )
+			{
+				random_value = ( random_value * 1103515245UL ) + 12345UL;
+
+				compressed_data[ iterator ] = (uint8_t) ( random_value >> 16 );
+			}
+			/* Clear the remainder bits
+			 */
+			if( ( ( compressed_data_size - 1 ) % 7 ) != 0 )
+			{
+				compressed_data[ compressed_data_size - 1 ] &= 0xff >> ( ( compressed_data_size - 1 ) % 7 );
+			}
+			uncompressed_data_size = ( ( compressed_data_size - 1 ) * 8 ) / 7;
+
+			result = libesedb_compression_7bit_decompress_with_kernel(
+			          compressed_data,
+			          compressed_data_size,
+			          expected_data,
+			          uncompressed_data_size,
+			          LIBESEDB_COMPRESSION_7BIT_KERNEL_SCALAR,
+			          &error );
+
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libesedb_compression_7bit_decompress_with_kernel(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          kernel,
+			          &error );
+
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          uncompressed_data,
+			          expected_data,
+			          uncompressed_data_size );
+
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			for( uncompressed_data_index = 0;
+			     uncompressed_data_index < uncompressed_data_size;
+			     uncompressed_data_index++ )
+			{
+				ESEDB_TEST_ASSERT_LESS_THAN_UINT8(
+				 "uncompressed_data[ uncompressed_data_index ]",
+				 uncompressed_data[ uncompressed_data_index ],
+				 (uint8_t) 0x80 );
+			}
+		}
+	}
+	/* Test error cases
+	 */
+	result = libesedb_compression_7bit_decompress_with_kernel(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          uncompressed_data,
+	          64,
+	          -1,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -500,10 +698,12 @@ int esedb_test_compression_lzxpress_decompress_get_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_lzxpress_decompress_get_size(
-	          esedb_test_compression_7bit_compressed_data,
+	result = libesedb_compression_7bit_decompress_with_kernel(
+	          NULL,
 	          50,
-	          &uncompressed_data_size,
+	          uncompressed_data,
+	          64,
+	          LIBESEDB_COMPRESSION_7BIT_KERNEL_SCALAR,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -529,24 +729,26 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_compression_lzxpress_decompress function
+/* Tests the libesedb_compression_7bit_decompress_to_utf8_string function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_compression_lzxpress_decompress(
+int esedb_test_compression_7bit_decompress_to_utf8_string(
      void )
 {
-	uint8_t uncompressed_data[ 64 ];
+	uint8_t utf8_string[ 64 ];
 
 	libcerror_error_t *error = NULL;
+	size_t utf8_string_index = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libesedb_compression_lzxpress_decompress(
-	          esedb_test_compression_lzxpress_compressed_data,
-	          33,
-	          uncompressed_data,
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          utf8_string,
 	          64,
+	          &utf8_string_index,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -554,68 +756,31 @@ int esedb_test_compression_lzxpress_decompress(
 	 result,
 	 1 );
 
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 56 );
+
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	result = memory_compare(
-	          uncompressed_data,
-	          (uint8_t *) "abcdefghijklmnopqrstuvwxyz",
-	          26 );
+	          utf8_string,
+	          esedb_test_compression_7bit_uncompressed_utf8_string,
+	          sizeof( uint8_t ) * 56 );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 0 );
 
-	/* Test error cases
-	 */
-	result = libesedb_compression_lzxpress_decompress(
-	          NULL,
-	          33,
-	          uncompressed_data,
-	          64,
-	          &error );
-
-	ESEDB_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	ESEDB_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libesedb_compression_decompress_get_size function
- * Returns 1 if successful or 0 if not
- */
-int esedb_test_compression_decompress_get_size(
-     void )
-{
-	libcerror_error_t *error      = NULL;
-	size_t uncompressed_data_size = 0;
-	int result                    = 0;
-
-	/* Test regular cases
-	 */
-	result = libesedb_compression_decompress_get_size(
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
 	          esedb_test_compression_7bit_compressed_data,
 	          50,
-	          &uncompressed_data_size,
+	          NULL,
+	          0,
+	          &utf8_string_index,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -624,18 +789,20 @@ int esedb_test_compression_decompress_get_size(
 	 1 );
 
 	ESEDB_TEST_ASSERT_EQUAL_SIZE(
-	 "uncompressed_data_size",
-	 uncompressed_data_size,
+	 "utf8_string_index",
+	 utf8_string_index,
 	 (size_t) 56 );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libesedb_compression_decompress_get_size(
-	          esedb_test_compression_lzxpress_compressed_data,
-	          33,
-	          &uncompressed_data_size,
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
+	          esedb_test_compression_7bit_unicode_compressed_data,
+	          8,
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -644,20 +811,32 @@ int esedb_test_compression_decompress_get_size(
 	 1 );
 
 	ESEDB_TEST_ASSERT_EQUAL_SIZE(
-	 "uncompressed_data_size",
-	 uncompressed_data_size,
-	 (size_t) 26 );
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 7 );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	result = memory_compare(
+	          utf8_string,
+	          esedb_test_compression_7bit_unicode_uncompressed_utf8_string,
+	          sizeof( uint8_t ) * 7 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
-	result = libesedb_compression_decompress_get_size(
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
 	          NULL,
 	          50,
-	          &uncompressed_data_size,
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -672,10 +851,12 @@ int esedb_test_compression_decompress_get_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_decompress_get_size(
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
 	          esedb_test_compression_7bit_compressed_data,
 	          (size_t) SSIZE_MAX + 1,
-	          &uncompressed_data_size,
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -690,10 +871,12 @@ int esedb_test_compression_decompress_get_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_decompress_get_size(
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
 	          esedb_test_compression_7bit_compressed_data,
 	          0,
-	          &uncompressed_data_size,
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -708,10 +891,12 @@ int esedb_test_compression_decompress_get_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_decompress_get_size(
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
 	          esedb_test_compression_7bit_compressed_data,
-	          50,
-	          NULL,
+	          1,
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -726,35 +911,1935 @@ int esedb_test_compression_decompress_get_size(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf8_string_index,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-/* Tests the libesedb_compression_decompress function
- * Returns 1 if successful or 0 if not
- */
-int esedb_test_compression_decompress(
-     void )
-{
-	uint8_t uncompressed_data[ 64 ];
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          utf8_string,
+	          4,
+	          &utf8_string_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          utf8_string,
+	          64,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
+	          esedb_test_compression_lzxpress_compressed_data,
+	          33,
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_7bit_decompress_to_utf16_string function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_7bit_decompress_to_utf16_string(
+     void )
+{
+	uint16_t utf16_string[ 64 ];
+
+	libcerror_error_t *error  = NULL;
+	size_t utf16_string_index = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_7bit_decompress_to_utf16_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          utf16_string,
+	          64,
+	          &utf16_string_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_index",
+	 utf16_string_index,
+	 (size_t) 56 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf16_string,
+	          esedb_test_compression_7bit_uncompressed_utf16_string,
+	          sizeof( uint16_t ) * 56 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_compression_7bit_decompress_to_utf16_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          NULL,
+	          0,
+	          &utf16_string_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_index",
+	 utf16_string_index,
+	 (size_t) 56 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_compression_7bit_decompress_to_utf16_string(
+	          esedb_test_compression_7bit_unicode_compressed_data,
+	          8,
+	          utf16_string,
+	          64,
+	          &utf16_string_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_index",
+	 utf16_string_index,
+	 (size_t) 4 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf16_string,
+	          esedb_test_compression_7bit_unicode_uncompressed_utf16_string,
+	          sizeof( uint16_t ) * 4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_7bit_decompress_to_utf16_string(
+	          NULL,
+	          50,
+	          utf16_string,
+	          64,
+	          &utf16_string_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress_to_utf16_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          utf16_string,
+	          64,
+	          &utf16_string_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress_to_utf16_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          0,
+	          utf16_string,
+	          64,
+	          &utf16_string_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress_to_utf16_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          1,
+	          utf16_string,
+	          64,
+	          &utf16_string_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress_to_utf16_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          utf16_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf16_string_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress_to_utf16_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          utf16_string,
+	          4,
+	          &utf16_string_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress_to_utf16_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          utf16_string,
+	          64,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress_to_utf16_string(
+	          esedb_test_compression_lzxpress_compressed_data,
+	          33,
+	          utf16_string,
+	          64,
+	          &utf16_string_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_lzxpress_decompress_get_size function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_lzxpress_decompress_get_size(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_lzxpress_decompress_get_size(
+	          esedb_test_compression_lzxpress_compressed_data,
+	          33,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 26 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_lzxpress_decompress_get_size(
+	          NULL,
+	          33,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_lzxpress_decompress_get_size(
+	          esedb_test_compression_lzxpress_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_lzxpress_decompress_get_size(
+	          esedb_test_compression_lzxpress_compressed_data,
+	          0,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_lzxpress_decompress_get_size(
+	          esedb_test_compression_lzxpress_compressed_data,
+	          33,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_lzxpress_decompress_get_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_lzxpress_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_lzxpress_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_lzxpress_decompress(
+	          esedb_test_compression_lzxpress_compressed_data,
+	          33,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          (uint8_t *) "abcdefghijklmnopqrstuvwxyz",
+	          26 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_lzxpress_decompress(
+	          NULL,
+	          33,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_decompress_get_size function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_decompress_get_size(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_decompress_get_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 56 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_compression_decompress_get_size(
+	          esedb_test_compression_lzxpress_compressed_data,
+	          33,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 26 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_decompress_get_size(
+	          esedb_test_compression_xpress9_compressed_data,
+	          8,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_decompress_get_size(
+	          esedb_test_compression_xpress10_compressed_data,
+	          8,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_decompress_get_size(
+	          NULL,
+	          50,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_decompress_get_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_decompress_get_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          0,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_decompress_get_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_decompress(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_compression_decompress(
+	          esedb_test_compression_lzxpress_compressed_data,
+	          33,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          (uint8_t *) "abcdefghijklmnopqrstuvwxyz",
+	          26 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_decompress(
+	          esedb_test_compression_xpress9_compressed_data,
+	          8,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_decompress(
+	          esedb_test_compression_xpress10_compressed_data,
+	          8,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_decompress(
+	          NULL,
+	          50,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_decompress(
+	          esedb_test_compression_7bit_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_decompress(
+	          esedb_test_compression_7bit_compressed_data,
+	          0,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_decompress(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          NULL,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_get_utf8_string_size_from_uncompressed_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_get_utf8_string_size_from_uncompressed_data(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	/* An even size is treated as an UTF-16 little-endian stream
+	 */
+	result = libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+	          esedb_test_compression_uncompressed_utf16_stream,
+	          6,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 4 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* An odd size is treated as an UTF-8 stream
+	 */
+	result = libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+	          esedb_test_compression_uncompressed_utf8_stream,
+	          3,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 4 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+	          NULL,
+	          6,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+	          esedb_test_compression_uncompressed_utf16_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_copy_to_utf8_string_from_uncompressed_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_copy_to_utf8_string_from_uncompressed_data(
+     void )
+{
+	uint8_t utf8_string[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	/* An even size is treated as an UTF-16 little-endian stream
+	 */
+	result = libesedb_compression_copy_to_utf8_string_from_uncompressed_data(
+	          esedb_test_compression_uncompressed_utf16_stream,
+	          6,
+	          utf8_string,
+	          16,
+	          &utf8_string_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 4 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "utf8_string[ 0 ]",
+	 (int) utf8_string[ 0 ],
+	 (int) 'a' );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "utf8_string[ 1 ]",
+	 (int) utf8_string[ 1 ],
+	 (int) 'b' );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "utf8_string[ 2 ]",
+	 (int) utf8_string[ 2 ],
+	 (int) 'c' );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "utf8_string[ 3 ]",
+	 (int) utf8_string[ 3 ],
+	 (int) 0 );
+
+	/* An odd size is treated as an UTF-8 stream
+	 */
+	result = libesedb_compression_copy_to_utf8_string_from_uncompressed_data(
+	          esedb_test_compression_uncompressed_utf8_stream,
+	          3,
+	          utf8_string,
+	          16,
+	          &utf8_string_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 4 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "utf8_string[ 0 ]",
+	 (int) utf8_string[ 0 ],
+	 (int) 'a' );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "utf8_string[ 1 ]",
+	 (int) utf8_string[ 1 ],
+	 (int) 'b' );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "utf8_string[ 2 ]",
+	 (int) utf8_string[ 2 ],
+	 (int) 'c' );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "utf8_string[ 3 ]",
+	 (int) utf8_string[ 3 ],
+	 (int) 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_copy_to_utf8_string_from_uncompressed_data(
+	          NULL,
+	          6,
+	          utf8_string,
+	          16,
+	          &utf8_string_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_copy_to_utf8_string_from_uncompressed_data(
+	          esedb_test_compression_uncompressed_utf16_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          utf8_string,
+	          16,
+	          &utf8_string_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_copy_to_utf8_string_from_uncompressed_data(
+	          esedb_test_compression_uncompressed_utf16_stream,
+	          6,
+	          utf8_string,
+	          16,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_copy_to_utf8_string_from_uncompressed_data(
+	          esedb_test_compression_uncompressed_utf8_stream,
+	          3,
+	          utf8_string,
+	          2,
+	          &utf8_string_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_get_utf8_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_get_utf8_string_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_get_utf8_string_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 56 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+/* TODO add test with LZXPRESS compressed string */
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_get_utf8_string_size(
+	          NULL,
+	          50,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_get_utf8_string_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_get_utf8_string_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_get_utf8_string_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_get_utf8_string_maximum_size function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_get_utf8_string_maximum_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_get_utf8_string_maximum_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 57 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_compression_get_utf8_string_maximum_size(
+	          esedb_test_compression_7bit_unicode_compressed_data,
+	          8,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 13 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_compression_get_utf8_string_maximum_size(
+	          esedb_test_compression_lzxpress_compressed_data,
+	          33,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 79 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_get_utf8_string_maximum_size(
+	          NULL,
+	          50,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_get_utf8_string_maximum_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_get_utf8_string_maximum_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_get_utf8_string_maximum_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_copy_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_copy_to_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_copy_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          utf8_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          esedb_test_compression_7bit_uncompressed_utf8_string,
+	          sizeof( uint8_t ) * 56 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+/* TODO add test with LZXPRESS compressed string */
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_copy_to_utf8_string(
+	          NULL,
+	          50,
+	          utf8_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_copy_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          utf8_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_copy_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          0,
+	          utf8_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_copy_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          NULL,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_copy_to_utf8_string_with_index function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_copy_to_utf8_string_with_index(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_copy_to_utf8_string_with_index(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 56 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          esedb_test_compression_7bit_uncompressed_utf8_string,
+	          sizeof( uint8_t ) * 56 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+/* TODO add test with LZXPRESS compressed string */
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_copy_to_utf8_string_with_index(
+	          NULL,
+	          50,
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_copy_to_utf8_string_with_index(
+	          esedb_test_compression_7bit_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_copy_to_utf8_string_with_index(
+	          esedb_test_compression_7bit_compressed_data,
+	          0,
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_copy_to_utf8_string_with_index(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          NULL,
+	          64,
+	          &utf8_string_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_copy_to_utf8_string_with_index(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          utf8_string,
+	          64,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_get_utf16_string_size_from_uncompressed_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_get_utf16_string_size_from_uncompressed_data(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf16_string_size = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	/* An even size is treated as an UTF-16 little-endian stream
+	 */
+	result = libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+	          esedb_test_compression_uncompressed_utf16_stream,
+	          6,
+	          &utf16_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 4 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* An odd size is treated as an UTF-8 stream
+	 */
+	result = libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+	          esedb_test_compression_uncompressed_utf8_stream,
+	          3,
+	          &utf16_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 4 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+	          NULL,
+	          6,
+	          &utf16_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+	          esedb_test_compression_uncompressed_utf16_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf16_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_copy_to_utf16_string_from_uncompressed_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_copy_to_utf16_string_from_uncompressed_data(
+     void )
+{
+	uint16_t utf16_string[ 16 ];
+
+	libcerror_error_t *error  = NULL;
+	size_t utf16_string_index = 0;
+	int result                = 0;
 
 	/* Test regular cases
 	 */
-	result = libesedb_compression_decompress(
-	          esedb_test_compression_7bit_compressed_data,
-	          50,
-	          uncompressed_data,
-	          64,
+	/* An even size is treated as an UTF-16 little-endian stream
+	 */
+	result = libesedb_compression_copy_to_utf16_string_from_uncompressed_data(
+	          esedb_test_compression_uncompressed_utf16_stream,
+	          6,
+	          utf16_string,
+	          16,
+	          &utf16_string_index,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -762,25 +2847,43 @@ int esedb_test_compression_decompress(
 	 result,
 	 1 );
 
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_index",
+	 utf16_string_index,
+	 (size_t) 4 );
+
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = memory_compare(
-	          uncompressed_data,
-	          esedb_test_compression_7bit_uncompressed_data,
-	          56 );
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "utf16_string[ 0 ]",
+	 (int) utf16_string[ 0 ],
+	 (int) 'a' );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+	 "utf16_string[ 1 ]",
+	 (int) utf16_string[ 1 ],
+	 (int) 'b' );
 
-	result = libesedb_compression_decompress(
-	          esedb_test_compression_lzxpress_compressed_data,
-	          33,
-	          uncompressed_data,
-	          64,
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "utf16_string[ 2 ]",
+	 (int) utf16_string[ 2 ],
+	 (int) 'c' );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "utf16_string[ 3 ]",
+	 (int) utf16_string[ 3 ],
+	 (int) 0 );
+
+	/* An odd size is treated as an UTF-8 stream
+	 */
+	result = libesedb_compression_copy_to_utf16_string_from_uncompressed_data(
+	          esedb_test_compression_uncompressed_utf8_stream,
+	          3,
+	          utf16_string,
+	          16,
+	          &utf16_string_index,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -788,27 +2891,43 @@ int esedb_test_compression_decompress(
 	 result,
 	 1 );
 
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_index",
+	 utf16_string_index,
+	 (size_t) 4 );
+
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = memory_compare(
-	          uncompressed_data,
-	          (uint8_t *) "abcdefghijklmnopqrstuvwxyz",
-	          26 );
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "utf16_string[ 0 ]",
+	 (int) utf16_string[ 0 ],
+	 (int) 'a' );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+	 "utf16_string[ 1 ]",
+	 (int) utf16_string[ 1 ],
+	 (int) 'b' );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "utf16_string[ 2 ]",
+	 (int) utf16_string[ 2 ],
+	 (int) 'c' );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "utf16_string[ 3 ]",
+	 (int) utf16_string[ 3 ],
+	 (int) 0 );
 
 	/* Test error cases
 	 */
-	result = libesedb_compression_decompress(
+	result = libesedb_compression_copy_to_utf16_string_from_uncompressed_data(
 	          NULL,
-	          50,
-	          uncompressed_data,
-	          64,
+	          6,
+	          utf16_string,
+	          16,
+	          &utf16_string_index,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -823,11 +2942,12 @@ int esedb_test_compression_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_decompress(
-	          esedb_test_compression_7bit_compressed_data,
+	result = libesedb_compression_copy_to_utf16_string_from_uncompressed_data(
+	          esedb_test_compression_uncompressed_utf16_stream,
 	          (size_t) SSIZE_MAX + 1,
-	          uncompressed_data,
-	          64,
+	          utf16_string,
+	          16,
+	          &utf16_string_index,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -842,11 +2962,12 @@ int esedb_test_compression_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_decompress(
-	          esedb_test_compression_7bit_compressed_data,
-	          0,
-	          uncompressed_data,
-	          64,
+	result = libesedb_compression_copy_to_utf16_string_from_uncompressed_data(
+	          esedb_test_compression_uncompressed_utf16_stream,
+	          6,
+	          utf16_string,
+	          16,
+	          NULL,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -861,11 +2982,12 @@ int esedb_test_compression_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_decompress(
-	          esedb_test_compression_7bit_compressed_data,
-	          50,
-	          NULL,
-	          64,
+	result = libesedb_compression_copy_to_utf16_string_from_uncompressed_data(
+	          esedb_test_compression_uncompressed_utf8_stream,
+	          3,
+	          utf16_string,
+	          2,
+	          &utf16_string_index,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -891,22 +3013,22 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_compression_get_utf8_string_size function
+/* Tests the libesedb_compression_get_utf16_string_size function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_compression_get_utf8_string_size(
+int esedb_test_compression_get_utf16_string_size(
      void )
 {
 	libcerror_error_t *error = NULL;
-	size_t utf8_string_size  = 0;
+	size_t utf16_string_size = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libesedb_compression_get_utf8_string_size(
+	result = libesedb_compression_get_utf16_string_size(
 	          esedb_test_compression_7bit_compressed_data,
 	          50,
-	          &utf8_string_size,
+	          &utf16_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -915,8 +3037,8 @@ int esedb_test_compression_get_utf8_string_size(
 	 1 );
 
 	ESEDB_TEST_ASSERT_EQUAL_SIZE(
-	 "utf8_string_size",
-	 utf8_string_size,
+	 "utf16_string_size",
+	 utf16_string_size,
 	 (size_t) 56 );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
@@ -927,10 +3049,10 @@ int esedb_test_compression_get_utf8_string_size(
 
 	/* Test error cases
 	 */
-	result = libesedb_compression_get_utf8_string_size(
+	result = libesedb_compression_get_utf16_string_size(
 	          NULL,
 	          50,
-	          &utf8_string_size,
+	          &utf16_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -945,10 +3067,10 @@ int esedb_test_compression_get_utf8_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_get_utf8_string_size(
+	result = libesedb_compression_get_utf16_string_size(
 	          esedb_test_compression_7bit_compressed_data,
 	          (size_t) SSIZE_MAX + 1,
-	          &utf8_string_size,
+	          &utf16_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -963,10 +3085,10 @@ int esedb_test_compression_get_utf8_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_get_utf8_string_size(
+	result = libesedb_compression_get_utf16_string_size(
 	          esedb_test_compression_7bit_compressed_data,
 	          0,
-	          &utf8_string_size,
+	          &utf16_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -981,7 +3103,7 @@ int esedb_test_compression_get_utf8_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_get_utf8_string_size(
+	result = libesedb_compression_get_utf16_string_size(
 	          esedb_test_compression_7bit_compressed_data,
 	          50,
 	          NULL,
@@ -1010,24 +3132,22 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_compression_copy_to_utf8_string function
+/* Tests the libesedb_compression_get_utf16_string_maximum_size function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_compression_copy_to_utf8_string(
+int esedb_test_compression_get_utf16_string_maximum_size(
      void )
 {
-	uint8_t utf8_string[ 64 ];
-
 	libcerror_error_t *error = NULL;
+	size_t utf16_string_size = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libesedb_compression_copy_to_utf8_string(
+	result = libesedb_compression_get_utf16_string_maximum_size(
 	          esedb_test_compression_7bit_compressed_data,
 	          50,
-	          utf8_string,
-	          64,
+	          &utf16_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1035,29 +3155,61 @@ int esedb_test_compression_copy_to_utf8_string(
 	 result,
 	 1 );
 
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 57 );
+
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = memory_compare(
-	          utf8_string,
-	          esedb_test_compression_7bit_uncompressed_utf8_string,
-	          sizeof( uint8_t ) * 56 );
+	result = libesedb_compression_get_utf16_string_maximum_size(
+	          esedb_test_compression_7bit_unicode_compressed_data,
+	          8,
+	          &utf16_string_size,
+	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
-/* TODO add test with LZXPRESS compressed string */
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 5 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_compression_get_utf16_string_maximum_size(
+	          esedb_test_compression_lzxpress_compressed_data,
+	          33,
+	          &utf16_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 27 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	result = libesedb_compression_copy_to_utf8_string(
+	result = libesedb_compression_get_utf16_string_maximum_size(
 	          NULL,
 	          50,
-	          utf8_string,
-	          64,
+	          &utf16_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1072,11 +3224,10 @@ int esedb_test_compression_copy_to_utf8_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_copy_to_utf8_string(
+	result = libesedb_compression_get_utf16_string_maximum_size(
 	          esedb_test_compression_7bit_compressed_data,
 	          (size_t) SSIZE_MAX + 1,
-	          utf8_string,
-	          64,
+	          &utf16_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1091,11 +3242,10 @@ int esedb_test_compression_copy_to_utf8_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_copy_to_utf8_string(
+	result = libesedb_compression_get_utf16_string_maximum_size(
 	          esedb_test_compression_7bit_compressed_data,
 	          0,
-	          utf8_string,
-	          64,
+	          &utf16_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1110,11 +3260,10 @@ int esedb_test_compression_copy_to_utf8_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_copy_to_utf8_string(
+	result = libesedb_compression_get_utf16_string_maximum_size(
 	          esedb_test_compression_7bit_compressed_data,
 	          50,
 	          NULL,
-	          64,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1140,22 +3289,24 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_compression_get_utf16_string_size function
+/* Tests the libesedb_compression_copy_to_utf16_string function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_compression_get_utf16_string_size(
+int esedb_test_compression_copy_to_utf16_string(
      void )
 {
+	uint16_t utf16_string[ 64 ];
+
 	libcerror_error_t *error = NULL;
-	size_t utf16_string_size = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libesedb_compression_get_utf16_string_size(
+	result = libesedb_compression_copy_to_utf16_string(
 	          esedb_test_compression_7bit_compressed_data,
 	          50,
-	          &utf16_string_size,
+	          utf16_string,
+	          64,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1163,23 +3314,29 @@ int esedb_test_compression_get_utf16_string_size(
 	 result,
 	 1 );
 
-	ESEDB_TEST_ASSERT_EQUAL_SIZE(
-	 "utf16_string_size",
-	 utf16_string_size,
-	 (size_t) 56 );
-
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	result = memory_compare(
+	          utf16_string,
+	          esedb_test_compression_7bit_uncompressed_utf16_string,
+	          sizeof( uint16_t ) * 56 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 /* TODO add test with LZXPRESS compressed string */
 
 	/* Test error cases
 	 */
-	result = libesedb_compression_get_utf16_string_size(
+	result = libesedb_compression_copy_to_utf16_string(
 	          NULL,
 	          50,
-	          &utf16_string_size,
+	          utf16_string,
+	          64,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1194,10 +3351,11 @@ int esedb_test_compression_get_utf16_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_get_utf16_string_size(
+	result = libesedb_compression_copy_to_utf16_string(
 	          esedb_test_compression_7bit_compressed_data,
 	          (size_t) SSIZE_MAX + 1,
-	          &utf16_string_size,
+	          utf16_string,
+	          64,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1212,10 +3370,11 @@ int esedb_test_compression_get_utf16_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_get_utf16_string_size(
+	result = libesedb_compression_copy_to_utf16_string(
 	          esedb_test_compression_7bit_compressed_data,
 	          0,
-	          &utf16_string_size,
+	          utf16_string,
+	          64,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1230,10 +3389,11 @@ int esedb_test_compression_get_utf16_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_get_utf16_string_size(
+	result = libesedb_compression_copy_to_utf16_string(
 	          esedb_test_compression_7bit_compressed_data,
 	          50,
 	          NULL,
+	          64,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1259,24 +3419,26 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_compression_copy_to_utf16_string function
+/* Tests the libesedb_compression_copy_to_utf16_string_with_index function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_compression_copy_to_utf16_string(
+int esedb_test_compression_copy_to_utf16_string_with_index(
      void )
 {
 	uint16_t utf16_string[ 64 ];
 
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error  = NULL;
+	size_t utf16_string_index = 0;
+	int result                = 0;
 
 	/* Test regular cases
 	 */
-	result = libesedb_compression_copy_to_utf16_string(
+	result = libesedb_compression_copy_to_utf16_string_with_index(
 	          esedb_test_compression_7bit_compressed_data,
 	          50,
 	          utf16_string,
 	          64,
+	          &utf16_string_index,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1284,6 +3446,11 @@ int esedb_test_compression_copy_to_utf16_string(
 	 result,
 	 1 );
 
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_index",
+	 utf16_string_index,
+	 (size_t) 56 );
+
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
@@ -1302,11 +3469,12 @@ int esedb_test_compression_copy_to_utf16_string(
 
 	/* Test error cases
 	 */
-	result = libesedb_compression_copy_to_utf16_string(
+	result = libesedb_compression_copy_to_utf16_string_with_index(
 	          NULL,
 	          50,
 	          utf16_string,
 	          64,
+	          &utf16_string_index,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1321,11 +3489,12 @@ int esedb_test_compression_copy_to_utf16_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_copy_to_utf16_string(
+	result = libesedb_compression_copy_to_utf16_string_with_index(
 	          esedb_test_compression_7bit_compressed_data,
 	          (size_t) SSIZE_MAX + 1,
 	          utf16_string,
 	          64,
+	          &utf16_string_index,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1340,11 +3509,12 @@ int esedb_test_compression_copy_to_utf16_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_copy_to_utf16_string(
+	result = libesedb_compression_copy_to_utf16_string_with_index(
 	          esedb_test_compression_7bit_compressed_data,
 	          0,
 	          utf16_string,
 	          64,
+	          &utf16_string_index,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1359,11 +3529,32 @@ int esedb_test_compression_copy_to_utf16_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_copy_to_utf16_string(
+	result = libesedb_compression_copy_to_utf16_string_with_index(
 	          esedb_test_compression_7bit_compressed_data,
 	          50,
 	          NULL,
 	          64,
+	          &utf16_string_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_copy_to_utf16_string_with_index(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          utf16_string,
+	          64,
+	          NULL,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1412,10 +3603,30 @@ int main(
 	 "libesedb_compression_7bit_decompress_get_size",
 	 esedb_test_compression_7bit_decompress_get_size );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_7bit_kernel_is_supported",
+	 esedb_test_compression_7bit_kernel_is_supported );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_7bit_get_kernel",
+	 esedb_test_compression_7bit_get_kernel );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_compression_7bit_decompress",
 	 esedb_test_compression_7bit_decompress );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_7bit_decompress_with_kernel",
+	 esedb_test_compression_7bit_decompress_with_kernel );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_7bit_decompress_to_utf8_string",
+	 esedb_test_compression_7bit_decompress_to_utf8_string );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_7bit_decompress_to_utf16_string",
+	 esedb_test_compression_7bit_decompress_to_utf16_string );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_compression_lzxpress_decompress_get_size",
 	 esedb_test_compression_lzxpress_decompress_get_size );
@@ -1432,22 +3643,54 @@ int main(
 	 "libesedb_compression_decompress",
 	 esedb_test_compression_decompress );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_get_utf8_string_size_from_uncompressed_data",
+	 esedb_test_compression_get_utf8_string_size_from_uncompressed_data );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_copy_to_utf8_string_from_uncompressed_data",
+	 esedb_test_compression_copy_to_utf8_string_from_uncompressed_data );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_compression_get_utf8_string_size",
 	 esedb_test_compression_get_utf8_string_size );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_get_utf8_string_maximum_size",
+	 esedb_test_compression_get_utf8_string_maximum_size );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_compression_copy_to_utf8_string",
 	 esedb_test_compression_copy_to_utf8_string );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_copy_to_utf8_string_with_index",
+	 esedb_test_compression_copy_to_utf8_string_with_index );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_get_utf16_string_size_from_uncompressed_data",
+	 esedb_test_compression_get_utf16_string_size_from_uncompressed_data );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_copy_to_utf16_string_from_uncompressed_data",
+	 esedb_test_compression_copy_to_utf16_string_from_uncompressed_data );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_compression_get_utf16_string_size",
 	 esedb_test_compression_get_utf16_string_size );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_get_utf16_string_maximum_size",
+	 esedb_test_compression_get_utf16_string_maximum_size );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_compression_copy_to_utf16_string",
 	 esedb_test_compression_copy_to_utf16_string );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_copy_to_utf16_string_with_index",
+	 esedb_test_compression_copy_to_utf16_string_with_index );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
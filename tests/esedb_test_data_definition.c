@@ -376,6 +376,7 @@ int esedb_test_data_definition_read_long_value(
 	          NULL,
 	          NULL,
 	          NULL,
+	          NULL,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -419,6 +420,7 @@ int esedb_test_data_definition_read_long_value_segment(
 	          NULL,
 	          NULL,
 	          0,
+	          0,
 	          NULL,
 	          NULL,
 	          &error );
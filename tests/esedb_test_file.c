@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -1001,6 +1002,296 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_file_open_memory function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_open_memory(
+     libbfio_handle_t *file_io_handle )
+{
+	libcerror_error_t *error = NULL;
+	libesedb_file_t *file    = NULL;
+	uint8_t *buffer          = NULL;
+	size64_t file_size       = 0;
+	ssize_t read_count       = 0;
+	int number_of_tables     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_size(
+	          file_io_handle,
+	          &file_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_LESS_THAN_UINT64(
+	 "file_size",
+	 file_size,
+	 (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE );
+
+	buffer = (uint8_t *) memory_allocate(
+	                      (size_t) file_size );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              (size_t) file_size,
+	              0,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) file_size );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_initialize(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libesedb_file_open_memory(
+	          file,
+	          buffer,
+	          (size_t) file_size,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_get_number_of_tables(
+	          file,
+	          &number_of_tables,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open when already opened
+	 */
+	result = libesedb_file_open_memory(
+	          file,
+	          buffer,
+	          (size_t) file_size,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_close(
+	          file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_file_open_memory(
+	          NULL,
+	          buffer,
+	          (size_t) file_size,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_open_memory(
+	          file,
+	          NULL,
+	          (size_t) file_size,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_open_memory(
+	          file,
+	          buffer,
+	          0,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_open_memory(
+	          file,
+	          buffer,
+	          (size_t) file_size,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_file_free(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( 0 );
+}
+
 /* Tests the libesedb_file_close function
  * Returns 1 if successful or 0 if not
  */
@@ -1588,6 +1879,11 @@ int main(
 		 esedb_test_file_open_file_io_handle,
 		 source );
 
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_file_open_memory",
+		 esedb_test_file_open_memory,
+		 file_io_handle );
+
 		ESEDB_TEST_RUN(
 		 "libesedb_file_close",
 		 esedb_test_file_close );
@@ -0,0 +1,955 @@
+/*
+ * Library filter type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_filter.h"
+#include "../libesedb/libesedb_io_handle.h"
+
+/* Record data with a fixed size column (identifier 1) containing 42,
+ * a variable size column (identifier 128) containing "abc" and
+ * a tagged column (identifier 256) containing 0x11 0x22
+ */
+uint8_t esedb_test_filter_record_data[ 19 ] = {
+	0x01, 0x80, 0x08, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x61, 0x62, 0x63, 0x00, 0x01, 0x04,
+	0x00, 0x11, 0x22 };
+
+/* Tests the libesedb_filter_initialize_integer function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_filter_initialize_integer(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libesedb_filter_t *filter       = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libesedb_filter_initialize_integer(
+	          &filter,
+	          0,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          42,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "filter",
+	 filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_filter_free(
+	          &filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "filter",
+	 filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_filter_initialize_integer(
+	          NULL,
+	          0,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          42,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	filter = (libesedb_filter_t *) 0x12345678UL;
+
+	result = libesedb_filter_initialize_integer(
+	          &filter,
+	          0,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          42,
+	          &error );
+
+	filter = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_filter_initialize_integer(
+	          &filter,
+	          -1,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          42,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_filter_initialize_integer(
+	          &filter,
+	          0,
+	          LIBESEDB_COMPARISON_OPERATOR_IS_NULL,
+	          42,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_filter_initialize_integer with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_filter_initialize_integer(
+		          &filter,
+		          0,
+		          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+		          42,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( filter != NULL )
+			{
+				libesedb_filter_free(
+				 &filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "filter",
+			 filter );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_filter_initialize_integer with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_filter_initialize_integer(
+		          &filter,
+		          0,
+		          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+		          42,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( filter != NULL )
+			{
+				libesedb_filter_free(
+				 &filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "filter",
+			 filter );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libesedb_filter_free(
+		 &filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_filter_initialize_and function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_filter_initialize_and(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libesedb_filter_t *filter       = NULL;
+	libesedb_filter_t *left_filter  = NULL;
+	libesedb_filter_t *right_filter = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_filter_initialize_integer(
+	          &left_filter,
+	          0,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_filter_initialize_null(
+	          &right_filter,
+	          1,
+	          LIBESEDB_COMPARISON_OPERATOR_IS_NOT_NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_filter_initialize_and(
+	          &filter,
+	          left_filter,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_filter_initialize_and(
+	          &filter,
+	          left_filter,
+	          left_filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_filter_initialize_and(
+	          &filter,
+	          left_filter,
+	          right_filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "filter",
+	 filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The filter now manages the sub filters
+	 */
+	left_filter  = NULL;
+	right_filter = NULL;
+
+	result = libesedb_filter_free(
+	          &filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "filter",
+	 filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libesedb_filter_free(
+		 &filter,
+		 NULL );
+	}
+	if( right_filter != NULL )
+	{
+		libesedb_filter_free(
+		 &right_filter,
+		 NULL );
+	}
+	if( left_filter != NULL )
+	{
+		libesedb_filter_free(
+		 &left_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_filter_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_filter_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_filter_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_filter_get_operator_result function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_filter_get_operator_result(
+     void )
+{
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_filter_get_operator_result(
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_filter_get_operator_result(
+	          LIBESEDB_COMPARISON_OPERATOR_NOT_EQUAL,
+	          0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_filter_get_operator_result(
+	          LIBESEDB_COMPARISON_OPERATOR_LESS,
+	          -1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_filter_get_operator_result(
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER_EQUAL,
+	          -1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_filter_get_operator_result(
+	          LIBESEDB_COMPARISON_OPERATOR_IS_NULL,
+	          0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libesedb_filter_evaluate function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_filter_evaluate(
+     void )
+{
+	libesedb_catalog_definition_t fixed_size_column_catalog_definition;
+	libesedb_catalog_definition_t tagged_column_catalog_definition;
+	libesedb_catalog_definition_t variable_size_column_catalog_definition;
+	libesedb_io_handle_t io_handle;
+
+	uint8_t tagged_value_data[ 2 ]   = { 0x11, 0x22 };
+	uint8_t variable_value_data[ 3 ] = { 'a', 'b', 'd' };
+	libcerror_error_t *error         = NULL;
+	libesedb_filter_t *filter        = NULL;
+	libesedb_filter_t *left_filter   = NULL;
+	libesedb_filter_t *right_filter  = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &io_handle,
+	 0,
+	 sizeof( libesedb_io_handle_t ) );
+
+	io_handle.format_version  = 0x620;
+	io_handle.format_revision = 0x11;
+	io_handle.page_size       = 8192;
+
+	memory_set(
+	 &fixed_size_column_catalog_definition,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) );
+
+	fixed_size_column_catalog_definition.identifier  = 1;
+	fixed_size_column_catalog_definition.column_type = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED;
+	fixed_size_column_catalog_definition.size        = 4;
+
+	memory_set(
+	 &variable_size_column_catalog_definition,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) );
+
+	variable_size_column_catalog_definition.identifier  = 128;
+	variable_size_column_catalog_definition.column_type = LIBESEDB_COLUMN_TYPE_BINARY_DATA;
+
+	memory_set(
+	 &tagged_column_catalog_definition,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) );
+
+	tagged_column_catalog_definition.identifier  = 256;
+	tagged_column_catalog_definition.column_type = LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA;
+
+	result = libesedb_filter_initialize_integer(
+	          &left_filter,
+	          0,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          42,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libesedb_internal_filter_t *) left_filter )->column_catalog_definition = &fixed_size_column_catalog_definition;
+	( (libesedb_internal_filter_t *) left_filter )->fixed_size_value_offset   = 4;
+
+	/* Test evaluate of a fixed size column value
+	 */
+	result = libesedb_filter_evaluate(
+	          (libesedb_internal_filter_t *) left_filter,
+	          &io_handle,
+	          esedb_test_filter_record_data,
+	          19,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_filter_initialize_binary_data(
+	          &right_filter,
+	          1,
+	          LIBESEDB_COMPARISON_OPERATOR_LESS,
+	          variable_value_data,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libesedb_internal_filter_t *) right_filter )->column_catalog_definition = &variable_size_column_catalog_definition;
+
+	/* Test evaluate of a variable size column value
+	 */
+	result = libesedb_filter_evaluate(
+	          (libesedb_internal_filter_t *) right_filter,
+	          &io_handle,
+	          esedb_test_filter_record_data,
+	          19,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_filter_initialize_and(
+	          &filter,
+	          left_filter,
+	          right_filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	left_filter  = NULL;
+	right_filter = NULL;
+
+	/* Test evaluate of an AND filter
+	 */
+	result = libesedb_filter_evaluate(
+	          (libesedb_internal_filter_t *) filter,
+	          &io_handle,
+	          esedb_test_filter_record_data,
+	          19,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_filter_free(
+	          &filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test evaluate of a tagged column value
+	 */
+	result = libesedb_filter_initialize_binary_data(
+	          &filter,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          tagged_value_data,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libesedb_internal_filter_t *) filter )->column_catalog_definition = &tagged_column_catalog_definition;
+
+	result = libesedb_filter_evaluate(
+	          (libesedb_internal_filter_t *) filter,
+	          &io_handle,
+	          esedb_test_filter_record_data,
+	          19,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libesedb_internal_filter_t *) filter )->comparison_operator = LIBESEDB_COMPARISON_OPERATOR_NOT_EQUAL;
+
+	result = libesedb_filter_evaluate(
+	          (libesedb_internal_filter_t *) filter,
+	          &io_handle,
+	          esedb_test_filter_record_data,
+	          19,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test evaluate of a tagged column value that is not set
+	 */
+	tagged_column_catalog_definition.identifier = 257;
+
+	result = libesedb_filter_evaluate(
+	          (libesedb_internal_filter_t *) filter,
+	          &io_handle,
+	          esedb_test_filter_record_data,
+	          19,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libesedb_internal_filter_t *) filter )->comparison_operator = LIBESEDB_COMPARISON_OPERATOR_IS_NULL;
+
+	result = libesedb_filter_evaluate(
+	          (libesedb_internal_filter_t *) filter,
+	          &io_handle,
+	          esedb_test_filter_record_data,
+	          19,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_filter_evaluate(
+	          NULL,
+	          &io_handle,
+	          esedb_test_filter_record_data,
+	          19,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_filter_evaluate(
+	          (libesedb_internal_filter_t *) filter,
+	          &io_handle,
+	          esedb_test_filter_record_data,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_filter_free(
+	          &filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libesedb_filter_free(
+		 &filter,
+		 NULL );
+	}
+	if( right_filter != NULL )
+	{
+		libesedb_filter_free(
+		 &right_filter,
+		 NULL );
+	}
+	if( left_filter != NULL )
+	{
+		libesedb_filter_free(
+		 &left_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_filter_initialize_integer",
+	 esedb_test_filter_initialize_integer );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_filter_initialize_and",
+	 esedb_test_filter_initialize_and );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_filter_free",
+	 esedb_test_filter_free );
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_filter_get_operator_result",
+	 esedb_test_filter_get_operator_result );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_filter_evaluate",
+	 esedb_test_filter_evaluate );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
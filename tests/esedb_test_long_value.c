@@ -21,33 +21,1153 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "esedb_test_functions.h"
+#include "esedb_test_libbfio.h"
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
+#include "esedb_test_libfdata.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_data_segment.h"
+#include "../libesedb/libesedb_definitions.h"
 #include "../libesedb/libesedb_long_value.h"
 
+uint8_t esedb_test_long_value_data1[ 16 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+/* Xpress10 compressed data that is not supported
+ */
+uint8_t esedb_test_long_value_xpress10_data[ 8 ] = {
+	0x30, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Uncompressed data that starts with the Xpress10 leading byte 0x30
+ */
+uint8_t esedb_test_long_value_data2[ 10 ] = {
+	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39 };
+
 /* Tests the libesedb_long_value_free function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_long_value_free(
+int esedb_test_long_value_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_long_value_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_long_value_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_read_buffer(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+
+	/* Test error cases
+	 */
+	read_count = libesedb_long_value_read_buffer(
+	              NULL,
+	              buffer,
+	              16,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_long_value_seek_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_seek_offset(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	off64_t offset           = 0;
+
+	/* Test error cases
+	 */
+	offset = libesedb_long_value_seek_offset(
+	          NULL,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (off64_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_long_value_get_size function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_get_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_long_value_get_size(
+	          NULL,
+	          &size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests reading the data of a long value with multiple data segments
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_read_data_segments(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libbfio_handle_t *long_value_file_io_handle              = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_long_value_t *long_value                        = NULL;
+	libfdata_list_t *data_segments_list                      = NULL;
+	size64_t size                                            = 0;
+	ssize_t read_count                                       = 0;
+	off64_t offset                                           = 0;
+	int element_index                                        = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          esedb_test_long_value_data1,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_initialize(
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_initialize(
+	          &data_segments_list,
+	          NULL,
+	          NULL,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_data_segment_read_element_data,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The data is stored in 3 data segments of 6, 6 and 4 bytes
+	 */
+	result = libfdata_list_append_element(
+	          data_segments_list,
+	          &element_index,
+	          0,
+	          0,
+	          6,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_append_element(
+	          data_segments_list,
+	          &element_index,
+	          0,
+	          6,
+	          6,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_append_element(
+	          data_segments_list,
+	          &element_index,
+	          0,
+	          12,
+	          4,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          NULL,
+	          column_catalog_definition,
+	          data_segments_list,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The long value takes over management of the data segments list
+	 */
+	data_segments_list = NULL;
+
+	/* Test regular cases
+	 */
+	result = libesedb_long_value_get_size(
+	          long_value,
+	          &size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 size,
+	 (uint64_t) 16 );
+
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              buffer,
+	              5,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 5 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          esedb_test_long_value_data1,
+	          5 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Read across data segment boundaries
+	 */
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              buffer,
+	              16,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 11 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( esedb_test_long_value_data1[ 5 ] ),
+	          11 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Read beyond the end of the data
+	 */
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              buffer,
+	              16,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Seek backwards and read
+	 */
+	offset = libesedb_long_value_seek_offset(
+	          long_value,
+	          -13,
+	          SEEK_END,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 3 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              buffer,
+	              8,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( esedb_test_long_value_data1[ 3 ] ),
+	          8 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_long_value_get_offset(
+	          long_value,
+	          &offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 11 );
+
+	/* Read using the Basic File IO (bfio) handle
+	 */
+	result = libesedb_long_value_get_file_io_handle(
+	          long_value,
+	          &long_value_file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          long_value_file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_size(
+	          long_value_file_io_handle,
+	          &size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 size,
+	 (uint64_t) 16 );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              long_value_file_io_handle,
+	              buffer,
+	              7,
+	              4,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 7 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( esedb_test_long_value_data1[ 4 ] ),
+	          7 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libbfio_handle_close(
+	          long_value_file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &long_value_file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_free(
+	          &long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_free(
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( long_value_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &long_value_file_io_handle,
+		 NULL );
+	}
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	if( data_segments_list != NULL )
+	{
+		libfdata_list_free(
+		 &data_segments_list,
+		 NULL );
+	}
+	if( column_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &column_catalog_definition,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_long_value_get_data_segment_file_range function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_get_data_segment_file_range(
+     void )
+{
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_long_value_t *long_value                        = NULL;
+	libfdata_list_t *data_segments_list                      = NULL;
+	size64_t size                                            = 0;
+	off64_t file_offset                                      = 0;
+	int element_index                                        = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          esedb_test_long_value_data1,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_initialize(
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_initialize(
+	          &data_segments_list,
+	          NULL,
+	          NULL,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_data_segment_read_element_data,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_append_element(
+	          data_segments_list,
+	          &element_index,
+	          0,
+	          0,
+	          6,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_append_element(
+	          data_segments_list,
+	          &element_index,
+	          0,
+	          6,
+	          10,
+	          LIBFDATA_RANGE_FLAG_IS_COMPRESSED,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          NULL,
+	          column_catalog_definition,
+	          data_segments_list,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The long value takes over management of the data segments list
+	 */
+	data_segments_list = NULL;
+
+	/* Test regular cases
+	 */
+	result = libesedb_long_value_get_data_segment_file_range(
+	          long_value,
+	          0,
+	          &file_offset,
+	          &size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "file_offset",
+	 file_offset,
+	 (int64_t) 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 size,
+	 (uint64_t) 6 );
+
+	/* Test a compressed data segment, which has no file range that can be copied directly
+	 */
+	file_offset = 0;
+	size        = 0;
+
+	result = libesedb_long_value_get_data_segment_file_range(
+	          long_value,
+	          1,
+	          &file_offset,
+	          &size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "file_offset",
+	 file_offset,
+	 (int64_t) 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 size,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_long_value_get_data_segment_file_range(
+	          NULL,
+	          0,
+	          &file_offset,
+	          &size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_long_value_get_data_segment_file_range(
+	          long_value,
+	          -1,
+	          &file_offset,
+	          &size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_long_value_get_data_segment_file_range(
+	          long_value,
+	          2,
+	          &file_offset,
+	          &size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_long_value_get_data_segment_file_range(
+	          long_value,
+	          0,
+	          NULL,
+	          &size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_long_value_get_data_segment_file_range(
+	          long_value,
+	          0,
+	          &file_offset,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_long_value_free(
+	          &long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_free(
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	if( data_segments_list != NULL )
+	{
+		libfdata_list_free(
+		 &data_segments_list,
+		 NULL );
+	}
+	if( column_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &column_catalog_definition,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests that reading the data of a long value with a Xpress10 compressed data segment fails
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_read_xpress10_data_segment(
      void )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	uint8_t buffer[ 32 ];
 
-	/* Test error cases
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_long_value_t *long_value                        = NULL;
+	libfdata_list_t *data_segments_list                      = NULL;
+	size64_t size                                            = 0;
+	ssize_t read_count                                       = 0;
+	int element_index                                        = 0;
+	int result                                               = 0;
+
+	/* Initialize test
 	 */
-	result = libesedb_long_value_free(
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          esedb_test_long_value_xpress10_data,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_initialize(
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	column_catalog_definition->flags = LIBESEDB_COLUMN_FLAG_IS_COMPRESSED;
+
+	result = libfdata_list_initialize(
+	          &data_segments_list,
 	          NULL,
+	          NULL,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_data_segment_read_element_data,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_append_element(
+	          data_segments_list,
+	          &element_index,
+	          0,
+	          0,
+	          8,
+	          LIBFDATA_RANGE_FLAG_IS_COMPRESSED,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          NULL,
+	          column_catalog_definition,
+	          data_segments_list,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The long value takes over management of the data segments list
+	 */
+	data_segments_list = NULL;
+
+	/* Test error cases
+	 */
+	result = libesedb_long_value_get_size(
+	          long_value,
+	          &size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -62,6 +1182,65 @@ int esedb_test_long_value_free(
 	libcerror_error_free(
 	 &error );
 
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              buffer,
+	              32,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_long_value_free(
+	          &long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_free(
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -70,10 +1249,262 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	if( data_segments_list != NULL )
+	{
+		libfdata_list_free(
+		 &data_segments_list,
+		 NULL );
+	}
+	if( column_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &column_catalog_definition,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+/* Tests reading the data of a long value with an uncompressed data segment that starts with 0x30
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_read_uncompressed_data_segment(
+     void )
+{
+	uint8_t buffer[ 32 ];
+
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_long_value_t *long_value                        = NULL;
+	libfdata_list_t *data_segments_list                      = NULL;
+	size64_t size                                            = 0;
+	ssize_t read_count                                       = 0;
+	int element_index                                        = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          esedb_test_long_value_data2,
+	          10,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_initialize(
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	column_catalog_definition->flags = 0;
+
+	result = libfdata_list_initialize(
+	          &data_segments_list,
+	          NULL,
+	          NULL,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_data_segment_read_element_data,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_append_element(
+	          data_segments_list,
+	          &element_index,
+	          0,
+	          0,
+	          10,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          NULL,
+	          column_catalog_definition,
+	          data_segments_list,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The long value takes over management of the data segments list
+	 */
+	data_segments_list = NULL;
+
+	/* Test regular cases
+	 */
+	result = libesedb_long_value_get_size(
+	          long_value,
+	          &size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 size,
+	 (uint64_t) 10 );
+
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              buffer,
+	              32,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 10 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          esedb_test_long_value_data2,
+	          10 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libesedb_long_value_free(
+	          &long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_free(
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	if( data_segments_list != NULL )
+	{
+		libfdata_list_free(
+		 &data_segments_list,
+		 NULL );
+	}
+	if( column_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &column_catalog_definition,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
 
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
@@ -116,6 +1547,10 @@ int main(
 
 	/* TODO: add tests for libesedb_long_value_get_data_segment */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_long_value_get_data_segment_file_range",
+	 esedb_test_long_value_get_data_segment_file_range );
+
 	/* TODO: add tests for libesedb_long_value_get_utf8_string_size */
 
 	/* TODO: add tests for libesedb_long_value_get_utf8_string */
@@ -124,8 +1559,32 @@ int main(
 
 	/* TODO: add tests for libesedb_long_value_get_utf16_string */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_long_value_read_data_segments",
+	 esedb_test_long_value_read_data_segments );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_long_value_read_xpress10_data_segment",
+	 esedb_test_long_value_read_xpress10_data_segment );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_long_value_read_uncompressed_data_segment",
+	 esedb_test_long_value_read_uncompressed_data_segment );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_long_value_read_buffer",
+	 esedb_test_long_value_read_buffer );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_long_value_seek_offset",
+	 esedb_test_long_value_seek_offset );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_long_value_get_size",
+	 esedb_test_long_value_get_size );
+
 	return( EXIT_SUCCESS );
 
 on_error:
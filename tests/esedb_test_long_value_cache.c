@@ -0,0 +1,686 @@
+/*
+ * Library long_value_cache type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_long_value_cache.h"
+
+uint8_t esedb_test_long_value_cache_data1[ 16 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_long_value_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libesedb_long_value_cache_t *long_value_cache = NULL;
+	int result                                    = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests               = 2;
+	int number_of_memset_fail_tests               = 2;
+	int test_number                               = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libesedb_long_value_cache_initialize(
+	          &long_value_cache,
+	          1024,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "long_value_cache",
+	 long_value_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_cache_free(
+	          &long_value_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "long_value_cache",
+	 long_value_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_long_value_cache_initialize(
+	          NULL,
+	          1024,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	long_value_cache = (libesedb_long_value_cache_t *) 0x12345678UL;
+
+	result = libesedb_long_value_cache_initialize(
+	          &long_value_cache,
+	          1024,
+	          &error );
+
+	long_value_cache = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_long_value_cache_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_long_value_cache_initialize(
+		          &long_value_cache,
+		          1024,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( long_value_cache != NULL )
+			{
+				libesedb_long_value_cache_free(
+				 &long_value_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "long_value_cache",
+			 long_value_cache );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_long_value_cache_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_long_value_cache_initialize(
+		          &long_value_cache,
+		          1024,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( long_value_cache != NULL )
+			{
+				libesedb_long_value_cache_free(
+				 &long_value_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "long_value_cache",
+			 long_value_cache );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( long_value_cache != NULL )
+	{
+		libesedb_long_value_cache_free(
+		 &long_value_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_long_value_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_long_value_cache_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_long_value_cache_get_data and libesedb_long_value_cache_set_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_cache_get_data(
+     void )
+{
+	uint8_t long_value_key[ 4 ]                   = { 0x01, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error                      = NULL;
+	libesedb_long_value_cache_t *long_value_cache = NULL;
+	const uint8_t *data                           = NULL;
+	size64_t cache_size                           = 0;
+	uint64_t number_of_hits                       = 0;
+	uint64_t number_of_misses                     = 0;
+	size_t data_size                              = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_long_value_cache_initialize(
+	          &long_value_cache,
+	          32,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "long_value_cache",
+	 long_value_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_long_value_cache_get_data(
+	          long_value_cache,
+	          2,
+	          long_value_key,
+	          4,
+	          0,
+	          &data,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_cache_set_data(
+	          long_value_cache,
+	          2,
+	          long_value_key,
+	          4,
+	          0,
+	          esedb_test_long_value_cache_data1,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_cache_set_data(
+	          long_value_cache,
+	          2,
+	          long_value_key,
+	          4,
+	          4096,
+	          &( esedb_test_long_value_cache_data1[ 8 ] ),
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_cache_get_data(
+	          long_value_cache,
+	          2,
+	          long_value_key,
+	          4,
+	          0,
+	          &data,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 16 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          esedb_test_long_value_cache_data1,
+	          16 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The same segment offset of another table is not cached
+	 */
+	result = libesedb_long_value_cache_get_data(
+	          long_value_cache,
+	          3,
+	          long_value_key,
+	          4,
+	          0,
+	          &data,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Exceeding the maximum cache size removes the least recently used entry
+	 */
+	result = libesedb_long_value_cache_set_data(
+	          long_value_cache,
+	          2,
+	          long_value_key,
+	          4,
+	          8192,
+	          esedb_test_long_value_cache_data1,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_cache_get_data(
+	          long_value_cache,
+	          2,
+	          long_value_key,
+	          4,
+	          4096,
+	          &data,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_cache_get_data(
+	          long_value_cache,
+	          2,
+	          long_value_key,
+	          4,
+	          0,
+	          &data,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_cache_get_statistics(
+	          long_value_cache,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &cache_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_size",
+	 cache_size,
+	 (uint64_t) 32 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Reducing the maximum cache size removes entries
+	 */
+	result = libesedb_long_value_cache_set_maximum_cache_size(
+	          long_value_cache,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "long_value_cache->number_of_entries",
+	 long_value_cache->number_of_entries,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_long_value_cache_get_data(
+	          NULL,
+	          2,
+	          long_value_key,
+	          4,
+	          0,
+	          &data,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_long_value_cache_get_data(
+	          long_value_cache,
+	          2,
+	          long_value_key,
+	          9,
+	          0,
+	          &data,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_long_value_cache_set_data(
+	          long_value_cache,
+	          2,
+	          long_value_key,
+	          4,
+	          0,
+	          NULL,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_long_value_cache_free(
+	          &long_value_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "long_value_cache",
+	 long_value_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( long_value_cache != NULL )
+	{
+		libesedb_long_value_cache_free(
+		 &long_value_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_long_value_cache_initialize",
+	 esedb_test_long_value_cache_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_long_value_cache_free",
+	 esedb_test_long_value_cache_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_long_value_cache_get_data",
+	 esedb_test_long_value_cache_get_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1095 @@
+/*
+ * Library name_hash_table type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_name_hash_table.h"
+
+uint8_t esedb_test_name_hash_table_byte_stream[ 12 ] = {
+	'M', 'S', 'y', 's', 'O', 'b', 'j', 'e', 'c', 't', 's', 0 };
+
+uint8_t esedb_test_name_hash_table_utf8_string[ 11 ] = {
+	'm', 's', 'y', 's', 'o', 'b', 'j', 'e', 'c', 't', 's' };
+
+uint16_t esedb_test_name_hash_table_utf16_string[ 11 ] = {
+	'M', 'S', 'Y', 'S', 'O', 'B', 'J', 'E', 'C', 'T', 'S' };
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_name_hash_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_name_hash_table_initialize(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libesedb_name_hash_table_t *name_hash_table = NULL;
+	int result                                  = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests             = 3;
+	int number_of_memset_fail_tests             = 3;
+	int test_number                             = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libesedb_name_hash_table_initialize(
+	          &name_hash_table,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "name_hash_table",
+	 name_hash_table );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "name_hash_table->number_of_buckets",
+	 name_hash_table->number_of_buckets,
+	 16 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "name_hash_table->number_of_entries",
+	 name_hash_table->number_of_entries,
+	 4 );
+
+	result = libesedb_name_hash_table_free(
+	          &name_hash_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "name_hash_table",
+	 name_hash_table );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_name_hash_table_initialize(
+	          &name_hash_table,
+	          9,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "name_hash_table->number_of_buckets",
+	 name_hash_table->number_of_buckets,
+	 32 );
+
+	result = libesedb_name_hash_table_free(
+	          &name_hash_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libesedb_name_hash_table_initialize(
+	          NULL,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	name_hash_table = (libesedb_name_hash_table_t *) 0x12345678UL;
+
+	result = libesedb_name_hash_table_initialize(
+	          &name_hash_table,
+	          4,
+	          &error );
+
+	name_hash_table = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_table_initialize(
+	          &name_hash_table,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_name_hash_table_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_name_hash_table_initialize(
+		          &name_hash_table,
+		          4,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( name_hash_table != NULL )
+			{
+				libesedb_name_hash_table_free(
+				 &name_hash_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "name_hash_table",
+			 name_hash_table );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_name_hash_table_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_name_hash_table_initialize(
+		          &name_hash_table,
+		          4,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( name_hash_table != NULL )
+			{
+				libesedb_name_hash_table_free(
+				 &name_hash_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "name_hash_table",
+			 name_hash_table );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_hash_table != NULL )
+	{
+		libesedb_name_hash_table_free(
+		 &name_hash_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_name_hash_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_name_hash_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_name_hash_table_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_name_hash_table_calculate_hash_from_byte_stream,
+ * libesedb_name_hash_table_calculate_hash_from_utf8_string and
+ * libesedb_name_hash_table_calculate_hash_from_utf16_string functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_name_hash_table_calculate_hash(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	uint32_t byte_stream_hash = 0;
+	uint32_t hash             = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_name_hash_table_calculate_hash_from_byte_stream(
+	          esedb_test_name_hash_table_byte_stream,
+	          12,
+	          1,
+	          &byte_stream_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_name_hash_table_calculate_hash_from_byte_stream(
+	          esedb_test_name_hash_table_byte_stream,
+	          11,
+	          1,
+	          &hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 byte_stream_hash );
+
+	result = libesedb_name_hash_table_calculate_hash_from_utf8_string(
+	          esedb_test_name_hash_table_utf8_string,
+	          11,
+	          1,
+	          &hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 byte_stream_hash );
+
+	result = libesedb_name_hash_table_calculate_hash_from_utf16_string(
+	          esedb_test_name_hash_table_utf16_string,
+	          11,
+	          1,
+	          &hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 byte_stream_hash );
+
+	result = libesedb_name_hash_table_calculate_hash_from_utf8_string(
+	          esedb_test_name_hash_table_utf8_string,
+	          10,
+	          1,
+	          &hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "hash",
+	 (int64_t) hash,
+	 (int64_t) byte_stream_hash );
+
+	/* Test case-sensitive hashes
+	 */
+	result = libesedb_name_hash_table_calculate_hash_from_byte_stream(
+	          (uint8_t *) "a",
+	          1,
+	          0,
+	          &hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 (uint32_t) 0xe40c292cUL );
+
+	result = libesedb_name_hash_table_calculate_hash_from_byte_stream(
+	          (uint8_t *) "a",
+	          0,
+	          0,
+	          &hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 (uint32_t) 0x811c9dc5UL );
+
+	result = libesedb_name_hash_table_calculate_hash_from_byte_stream(
+	          esedb_test_name_hash_table_byte_stream,
+	          12,
+	          0,
+	          &hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "hash",
+	 (int64_t) hash,
+	 (int64_t) byte_stream_hash );
+
+	byte_stream_hash = hash;
+
+	result = libesedb_name_hash_table_calculate_hash_from_utf16_string(
+	          esedb_test_name_hash_table_utf16_string,
+	          11,
+	          0,
+	          &hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "hash",
+	 (int64_t) hash,
+	 (int64_t) byte_stream_hash );
+
+	/* Test error cases
+	 */
+	result = libesedb_name_hash_table_calculate_hash_from_byte_stream(
+	          NULL,
+	          12,
+	          0,
+	          &hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_table_calculate_hash_from_byte_stream(
+	          esedb_test_name_hash_table_byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_table_calculate_hash_from_byte_stream(
+	          esedb_test_name_hash_table_byte_stream,
+	          12,
+	          0,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_table_calculate_hash_from_utf8_string(
+	          NULL,
+	          11,
+	          0,
+	          &hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_table_calculate_hash_from_utf8_string(
+	          esedb_test_name_hash_table_utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_table_calculate_hash_from_utf8_string(
+	          esedb_test_name_hash_table_utf8_string,
+	          11,
+	          0,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_table_calculate_hash_from_utf16_string(
+	          NULL,
+	          11,
+	          0,
+	          &hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_table_calculate_hash_from_utf16_string(
+	          esedb_test_name_hash_table_utf16_string,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_table_calculate_hash_from_utf16_string(
+	          esedb_test_name_hash_table_utf16_string,
+	          11,
+	          0,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_name_hash_table_set_entry, libesedb_name_hash_table_get_first_entry_index
+ * and libesedb_name_hash_table_get_next_entry_index functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_name_hash_table_set_entry(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libesedb_name_hash_table_t *name_hash_table = NULL;
+	int entry_index                             = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_name_hash_table_initialize(
+	          &name_hash_table,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_name_hash_table_set_entry(
+	          name_hash_table,
+	          2,
+	          0x00000021UL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_name_hash_table_set_entry(
+	          name_hash_table,
+	          1,
+	          0x00000002UL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_name_hash_table_set_entry(
+	          name_hash_table,
+	          0,
+	          0x00000001UL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_name_hash_table_get_first_entry_index(
+	          name_hash_table,
+	          0x00000001UL,
+	          &entry_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 0 );
+
+	result = libesedb_name_hash_table_get_next_entry_index(
+	          name_hash_table,
+	          entry_index,
+	          &entry_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 2 );
+
+	result = libesedb_name_hash_table_get_next_entry_index(
+	          name_hash_table,
+	          entry_index,
+	          &entry_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_name_hash_table_get_first_entry_index(
+	          name_hash_table,
+	          0x00000003UL,
+	          &entry_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_name_hash_table_set_entry(
+	          NULL,
+	          0,
+	          0x00000001UL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_table_set_entry(
+	          name_hash_table,
+	          -1,
+	          0x00000001UL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_table_set_entry(
+	          name_hash_table,
+	          3,
+	          0x00000001UL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_table_get_first_entry_index(
+	          NULL,
+	          0x00000001UL,
+	          &entry_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_table_get_first_entry_index(
+	          name_hash_table,
+	          0x00000001UL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_table_get_next_entry_index(
+	          NULL,
+	          0,
+	          &entry_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_table_get_next_entry_index(
+	          name_hash_table,
+	          3,
+	          &entry_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_table_get_next_entry_index(
+	          name_hash_table,
+	          0,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_name_hash_table_free(
+	          &name_hash_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "name_hash_table",
+	 name_hash_table );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_hash_table != NULL )
+	{
+		libesedb_name_hash_table_free(
+		 &name_hash_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_name_hash_table_initialize",
+	 esedb_test_name_hash_table_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_name_hash_table_free",
+	 esedb_test_name_hash_table_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_name_hash_table_calculate_hash",
+	 esedb_test_name_hash_table_calculate_hash );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_name_hash_table_set_entry",
+	 esedb_test_name_hash_table_set_entry );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -1,5 +1,5 @@
 /*
- * Library block_tree functions testing program
+ * Library page_buffer_pool type test program
  *
  * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
  *
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,35 +34,33 @@
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
-#include "../libesedb/libesedb_block_descriptor.h"
-#include "../libesedb/libesedb_block_tree.h"
-#include "../libesedb/libesedb_block_tree_node.h"
 #include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_page_buffer_pool.h"
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
-/* Tests the libesedb_block_tree_initialize function
+/* Tests the libesedb_page_buffer_pool_initialize function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_block_tree_initialize(
+int esedb_test_page_buffer_pool_initialize(
      void )
 {
-	libcerror_error_t *error          = NULL;
-	libesedb_block_tree_t *block_tree = NULL;
-	int result                        = 0;
+	libcerror_error_t *error                      = NULL;
+	libesedb_page_buffer_pool_t *page_buffer_pool = NULL;
+	int result                                    = 0;
 
 #if defined( HAVE_ESEDB_TEST_MEMORY )
-	int number_of_malloc_fail_tests   = 2;
-	int number_of_memset_fail_tests   = 1;
-	int test_number                   = 0;
+	int number_of_malloc_fail_tests               = 2;
+	int number_of_memset_fail_tests               = 1;
+	int test_number                               = 0;
 #endif
 
-	/* Test block_tree initialization
+	/* Test regular cases
 	 */
-	result = libesedb_block_tree_initialize(
-	          &block_tree,
-	          0x800000000UL,
-	          0x4000,
+	result = libesedb_page_buffer_pool_initialize(
+	          &page_buffer_pool,
+	          4096,
+	          4,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -70,16 +69,15 @@ int esedb_test_block_tree_initialize(
 	 1 );
 
 	ESEDB_TEST_ASSERT_IS_NOT_NULL(
-	 "block_tree",
-	 block_tree );
+	 "page_buffer_pool",
+	 page_buffer_pool );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libesedb_block_tree_free(
-	          &block_tree,
-	          NULL,
+	result = libesedb_page_buffer_pool_free(
+	          &page_buffer_pool,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -88,8 +86,8 @@ int esedb_test_block_tree_initialize(
 	 1 );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
-	 "block_tree",
-	 block_tree );
+	 "page_buffer_pool",
+	 page_buffer_pool );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -97,10 +95,10 @@ int esedb_test_block_tree_initialize(
 
 	/* Test error cases
 	 */
-	result = libesedb_block_tree_initialize(
+	result = libesedb_page_buffer_pool_initialize(
 	          NULL,
-	          0x800000000UL,
-	          0x4000,
+	          4096,
+	          4,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -115,15 +113,51 @@ int esedb_test_block_tree_initialize(
 	libcerror_error_free(
 	 &error );
 
-	block_tree = (libesedb_block_tree_t *) 0x12345678UL;
+	page_buffer_pool = (libesedb_page_buffer_pool_t *) 0x12345678UL;
 
-	result = libesedb_block_tree_initialize(
-	          &block_tree,
-	          0x800000000UL,
-	          0x4000,
+	result = libesedb_page_buffer_pool_initialize(
+	          &page_buffer_pool,
+	          4096,
+	          4,
 	          &error );
 
-	block_tree = NULL;
+	page_buffer_pool = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_buffer_pool_initialize(
+	          &page_buffer_pool,
+	          0,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_buffer_pool_initialize(
+	          &page_buffer_pool,
+	          4096,
+	          0,
+	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -143,25 +177,24 @@ int esedb_test_block_tree_initialize(
 	     test_number < number_of_malloc_fail_tests;
 	     test_number++ )
 	{
-		/* Test libesedb_block_tree_initialize with malloc failing
+		/* Test libesedb_page_buffer_pool_initialize with malloc failing
 		 */
 		esedb_test_malloc_attempts_before_fail = test_number;
 
-		result = libesedb_block_tree_initialize(
-		          &block_tree,
-		          0x800000000UL,
-		          0x4000,
+		result = libesedb_page_buffer_pool_initialize(
+		          &page_buffer_pool,
+		          4096,
+		          4,
 		          &error );
 
 		if( esedb_test_malloc_attempts_before_fail != -1 )
 		{
 			esedb_test_malloc_attempts_before_fail = -1;
 
-			if( block_tree != NULL )
+			if( page_buffer_pool != NULL )
 			{
-				libesedb_block_tree_free(
-				 &block_tree,
-				 NULL,
+				libesedb_page_buffer_pool_free(
+				 &page_buffer_pool,
 				 NULL );
 			}
 		}
@@ -173,8 +206,8 @@ int esedb_test_block_tree_initialize(
 			 -1 );
 
 			ESEDB_TEST_ASSERT_IS_NULL(
-			 "block_tree",
-			 block_tree );
+			 "page_buffer_pool",
+			 page_buffer_pool );
 
 			ESEDB_TEST_ASSERT_IS_NOT_NULL(
 			 "error",
@@ -188,25 +221,24 @@ int esedb_test_block_tree_initialize(
 	     test_number < number_of_memset_fail_tests;
 	     test_number++ )
 	{
-		/* Test libesedb_block_tree_initialize with memset failing
+		/* Test libesedb_page_buffer_pool_initialize with memset failing
 		 */
 		esedb_test_memset_attempts_before_fail = test_number;
 
-		result = libesedb_block_tree_initialize(
-		          &block_tree,
-		          0x800000000UL,
-		          0x4000,
+		result = libesedb_page_buffer_pool_initialize(
+		          &page_buffer_pool,
+		          4096,
+		          4,
 		          &error );
 
 		if( esedb_test_memset_attempts_before_fail != -1 )
 		{
 			esedb_test_memset_attempts_before_fail = -1;
 
-			if( block_tree != NULL )
+			if( page_buffer_pool != NULL )
 			{
-				libesedb_block_tree_free(
-				 &block_tree,
-				 NULL,
+				libesedb_page_buffer_pool_free(
+				 &page_buffer_pool,
 				 NULL );
 			}
 		}
@@ -218,8 +250,8 @@ int esedb_test_block_tree_initialize(
 			 -1 );
 
 			ESEDB_TEST_ASSERT_IS_NULL(
-			 "block_tree",
-			 block_tree );
+			 "page_buffer_pool",
+			 page_buffer_pool );
 
 			ESEDB_TEST_ASSERT_IS_NOT_NULL(
 			 "error",
@@ -239,20 +271,19 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( block_tree != NULL )
+	if( page_buffer_pool != NULL )
 	{
-		libesedb_block_tree_free(
-		 &block_tree,
-		 NULL,
+		libesedb_page_buffer_pool_free(
+		 &page_buffer_pool,
 		 NULL );
 	}
 	return( 0 );
 }
 
-/* Tests the libesedb_block_tree_free function
+/* Tests the libesedb_page_buffer_pool_free function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_block_tree_free(
+int esedb_test_page_buffer_pool_free(
      void )
 {
 	libcerror_error_t *error = NULL;
@@ -260,8 +291,7 @@ int esedb_test_block_tree_free(
 
 	/* Test error cases
 	 */
-	result = libesedb_block_tree_free(
-	          NULL,
+	result = libesedb_page_buffer_pool_free(
 	          NULL,
 	          &error );
 
@@ -288,24 +318,25 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_block_tree_get_block_descriptor_by_offset function
+/* Tests the libesedb_page_buffer_pool_get_buffer and libesedb_page_buffer_pool_release_buffer functions
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_block_tree_get_block_descriptor_by_offset(
+int esedb_test_page_buffer_pool_get_buffer(
      void )
 {
 	libcerror_error_t *error                      = NULL;
-	libesedb_block_descriptor_t *block_descriptor = NULL;
-	libesedb_block_tree_t *block_tree             = NULL;
-	off64_t block_offset                          = 0;
+	libesedb_page_buffer_pool_t *page_buffer_pool = NULL;
+	uint8_t *buffer1                              = NULL;
+	uint8_t *buffer2                              = NULL;
+	uint8_t *released_buffer                      = NULL;
 	int result                                    = 0;
 
 	/* Initialize test
 	 */
-	result = libesedb_block_tree_initialize(
-	          &block_tree,
-	          0x800000000UL,
-	          0x4000,
+	result = libesedb_page_buffer_pool_initialize(
+	          &page_buffer_pool,
+	          4096,
+	          1,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -314,8 +345,8 @@ int esedb_test_block_tree_get_block_descriptor_by_offset(
 	 1 );
 
 	ESEDB_TEST_ASSERT_IS_NOT_NULL(
-	 "block_tree",
-	 block_tree );
+	 "page_buffer_pool",
+	 page_buffer_pool );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -323,90 +354,64 @@ int esedb_test_block_tree_get_block_descriptor_by_offset(
 
 	/* Test regular cases
 	 */
-	result = libesedb_block_tree_get_block_descriptor_by_offset(
-	          block_tree,
-	          0,
-	          &block_descriptor,
-	          &block_offset,
+	result = libesedb_page_buffer_pool_get_buffer(
+	          page_buffer_pool,
+	          &buffer1,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
-
-	ESEDB_TEST_ASSERT_IS_NULL(
-	 "block_descriptor",
-	 block_descriptor );
+	 1 );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libesedb_block_tree_get_block_descriptor_by_offset(
-	          NULL,
-	          0,
-	          &block_descriptor,
-	          &block_offset,
-	          &error );
-
-	ESEDB_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
 	ESEDB_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+	 "buffer1",
+	 buffer1 );
 
-	libcerror_error_free(
-	 &error );
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "buffer1 alignment",
+	 (int) ( (intptr_t) buffer1 % LIBESEDB_PAGE_BUFFER_POOL_ALIGNMENT ),
+	 0 );
 
-	result = libesedb_block_tree_get_block_descriptor_by_offset(
-	          block_tree,
-	          0,
-	          NULL,
-	          &block_offset,
+	/* Test if the buffer can be written to without overflowing
+	 */
+	memory_set(
+	 buffer1,
+	 0xff,
+	 4096 );
+
+	result = libesedb_page_buffer_pool_get_buffer(
+	          page_buffer_pool,
+	          &buffer2,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libesedb_block_tree_get_block_descriptor_by_offset(
-	          block_tree,
-	          0,
-	          &block_descriptor,
-	          NULL,
-	          &error );
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer2",
+	 buffer2 );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	 "page_buffer_pool->number_of_used_buffers",
+	 page_buffer_pool->number_of_used_buffers,
+	 2 );
 
-	ESEDB_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
+	released_buffer = buffer1;
 
-	/* Clean up
-	 */
-	result = libesedb_block_tree_free(
-	          &block_tree,
-	          NULL,
+	result = libesedb_page_buffer_pool_release_buffer(
+	          page_buffer_pool,
+	          &buffer1,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -414,52 +419,24 @@ int esedb_test_block_tree_get_block_descriptor_by_offset(
 	 result,
 	 1 );
 
-	ESEDB_TEST_ASSERT_IS_NULL(
-	 "block_tree",
-	 block_tree );
-
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( block_tree != NULL )
-	{
-		libesedb_block_tree_free(
-		 &block_tree,
-		 NULL,
-		 NULL );
-	}
-	return( 0 );
-}
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "buffer1",
+	 buffer1 );
 
-/* Tests the libesedb_block_tree_insert_block_descriptor_by_offset function
- * Returns 1 if successful or 0 if not
- */
-int esedb_test_block_tree_insert_block_descriptor_by_offset(
-     void )
-{
-	libcerror_error_t *error                               = NULL;
-	libesedb_block_descriptor_t *block_descriptor          = NULL;
-	libesedb_block_descriptor_t *existing_block_descriptor = NULL;
-	libesedb_block_tree_t *block_tree                      = NULL;
-	libesedb_block_tree_node_t *leaf_block_tree_node       = NULL;
-	int leaf_value_index                                   = 0;
-	int result                                             = 0;
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_buffer_pool->number_of_buffers",
+	 page_buffer_pool->number_of_buffers,
+	 1 );
 
-	/* Initialize test
+	/* Test if the pool is full the buffer is freed
 	 */
-	result = libesedb_block_tree_initialize(
-	          &block_tree,
-	          0x800000000UL,
-	          0x4000,
+	result = libesedb_page_buffer_pool_release_buffer(
+	          page_buffer_pool,
+	          &buffer2,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -467,40 +444,29 @@ int esedb_test_block_tree_insert_block_descriptor_by_offset(
 	 result,
 	 1 );
 
-	ESEDB_TEST_ASSERT_IS_NOT_NULL(
-	 "block_tree",
-	 block_tree );
-
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libesedb_block_descriptor_initialize(
-	          &block_descriptor,
-	          &error );
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "buffer2",
+	 buffer2 );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
+	 "page_buffer_pool->number_of_buffers",
+	 page_buffer_pool->number_of_buffers,
 	 1 );
 
-	ESEDB_TEST_ASSERT_IS_NOT_NULL(
-	 "block_descriptor",
-	 block_descriptor );
-
-	ESEDB_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_buffer_pool->number_of_used_buffers",
+	 page_buffer_pool->number_of_used_buffers,
+	 0 );
 
-	/* Test regular cases
+	/* Test if a released buffer is reused
 	 */
-	result = libesedb_block_tree_insert_block_descriptor_by_offset(
-	          block_tree,
-	          0,
-	          block_descriptor,
-	          &leaf_value_index,
-	          &leaf_block_tree_node,
-	          &existing_block_descriptor,
+	result = libesedb_page_buffer_pool_get_buffer(
+	          page_buffer_pool,
+	          &buffer1,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -508,63 +474,25 @@ int esedb_test_block_tree_insert_block_descriptor_by_offset(
 	 result,
 	 1 );
 
-	ESEDB_TEST_ASSERT_EQUAL_INT(
-	 "leaf_value_index",
-	 leaf_value_index,
-	 0 );
-
-	ESEDB_TEST_ASSERT_IS_NOT_NULL(
-	 "leaf_block_tree_node",
-	 leaf_block_tree_node );
-
-	ESEDB_TEST_ASSERT_IS_NULL(
-	 "existing_block_descriptor",
-	 existing_block_descriptor );
-
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libesedb_block_tree_insert_block_descriptor_by_offset(
-	          block_tree,
-	          0,
-	          NULL,
-	          &leaf_value_index,
-	          &leaf_block_tree_node,
-	          &existing_block_descriptor,
-	          &error );
-
 	ESEDB_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+	 "buffer1 == released_buffer",
+	 (int) ( buffer1 == released_buffer ),
+	 1 );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
-	 "leaf_value_index",
-	 leaf_value_index,
+	 "page_buffer_pool->number_of_buffers",
+	 page_buffer_pool->number_of_buffers,
 	 0 );
 
-	ESEDB_TEST_ASSERT_IS_NOT_NULL(
-	 "leaf_block_tree_node",
-	 leaf_block_tree_node );
-
-	ESEDB_TEST_ASSERT_IS_NOT_NULL(
-	 "existing_block_descriptor",
-	 existing_block_descriptor );
-
-	ESEDB_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	/* Test error cases
 	 */
-	result = libesedb_block_tree_insert_block_descriptor_by_offset(
+	result = libesedb_page_buffer_pool_get_buffer(
 	          NULL,
-	          0,
-	          block_descriptor,
-	          &leaf_value_index,
-	          &leaf_block_tree_node,
-	          &existing_block_descriptor,
+	          &buffer2,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -579,13 +507,9 @@ int esedb_test_block_tree_insert_block_descriptor_by_offset(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_block_tree_insert_block_descriptor_by_offset(
-	          block_tree,
-	          0,
-	          block_descriptor,
+	result = libesedb_page_buffer_pool_get_buffer(
+	          page_buffer_pool,
 	          NULL,
-	          &leaf_block_tree_node,
-	          &existing_block_descriptor,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -600,13 +524,9 @@ int esedb_test_block_tree_insert_block_descriptor_by_offset(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_block_tree_insert_block_descriptor_by_offset(
-	          block_tree,
-	          0,
-	          block_descriptor,
-	          &leaf_value_index,
+	result = libesedb_page_buffer_pool_release_buffer(
 	          NULL,
-	          &existing_block_descriptor,
+	          &buffer1,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -621,12 +541,8 @@ int esedb_test_block_tree_insert_block_descriptor_by_offset(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_block_tree_insert_block_descriptor_by_offset(
-	          block_tree,
-	          0,
-	          block_descriptor,
-	          &leaf_value_index,
-	          &leaf_block_tree_node,
+	result = libesedb_page_buffer_pool_release_buffer(
+	          page_buffer_pool,
 	          NULL,
 	          &error );
 
@@ -642,10 +558,13 @@ int esedb_test_block_tree_insert_block_descriptor_by_offset(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
+	/* Test if a pool that is freed while a buffer is in use is freed
+	 * when the buffer is released
 	 */
-	result = libesedb_block_descriptor_free(
-	          &block_descriptor,
+	released_buffer = (uint8_t *) page_buffer_pool;
+
+	result = libesedb_page_buffer_pool_free(
+	          &page_buffer_pool,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -654,31 +573,57 @@ int esedb_test_block_tree_insert_block_descriptor_by_offset(
 	 1 );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
-	 "block_descriptor",
-	 block_descriptor );
+	 "error",
+	 error );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_buffer_pool",
+	 page_buffer_pool );
+
+	page_buffer_pool = (libesedb_page_buffer_pool_t *) released_buffer;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_buffer_pool->is_detached",
+	 (int) page_buffer_pool->is_detached,
+	 1 );
+
+	result = libesedb_page_buffer_pool_get_buffer(
+	          page_buffer_pool,
+	          &buffer2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libesedb_block_tree_free(
-	          &block_tree,
-	          NULL,
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_buffer_pool_release_buffer(
+	          page_buffer_pool,
+	          &buffer1,
 	          &error );
 
+	page_buffer_pool = NULL;
+
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 1 );
 
-	ESEDB_TEST_ASSERT_IS_NULL(
-	 "block_tree",
-	 block_tree );
-
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "buffer1",
+	 buffer1 );
+
 	return( 1 );
 
 on_error:
@@ -687,17 +632,24 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( block_descriptor != NULL )
+	if( buffer1 != NULL )
+	{
+		libesedb_page_buffer_pool_release_buffer(
+		 page_buffer_pool,
+		 &buffer1,
+		 NULL );
+	}
+	if( buffer2 != NULL )
 	{
-		libesedb_block_descriptor_free(
-		 &block_descriptor,
+		libesedb_page_buffer_pool_release_buffer(
+		 page_buffer_pool,
+		 &buffer2,
 		 NULL );
 	}
-	if( block_tree != NULL )
+	if( page_buffer_pool != NULL )
 	{
-		libesedb_block_tree_free(
-		 &block_tree,
-		 NULL,
+		libesedb_page_buffer_pool_free(
+		 &page_buffer_pool,
 		 NULL );
 	}
 	return( 0 );
@@ -723,30 +675,22 @@ int main(
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
 	ESEDB_TEST_RUN(
-	 "libesedb_block_tree_initialize",
-	 esedb_test_block_tree_initialize );
+	 "libesedb_page_buffer_pool_initialize",
+	 esedb_test_page_buffer_pool_initialize );
 
 	ESEDB_TEST_RUN(
-	 "libesedb_block_tree_free",
-	 esedb_test_block_tree_free );
+	 "libesedb_page_buffer_pool_free",
+	 esedb_test_page_buffer_pool_free );
 
 	ESEDB_TEST_RUN(
-	 "libesedb_block_tree_get_block_descriptor_by_offset",
-	 esedb_test_block_tree_get_block_descriptor_by_offset );
-
-	ESEDB_TEST_RUN(
-	 "libesedb_block_tree_insert_block_descriptor_by_offset",
-	 esedb_test_block_tree_insert_block_descriptor_by_offset );
+	 "libesedb_page_buffer_pool_get_buffer",
+	 esedb_test_page_buffer_pool_get_buffer );
 
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
 
-#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
-
 on_error:
 	return( EXIT_FAILURE );
-
-#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 }
 
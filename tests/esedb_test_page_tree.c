@@ -19,25 +19,114 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <byte_stream.h>
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "esedb_test_functions.h"
+#include "esedb_test_libbfio.h"
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
+#include "esedb_test_libfcache.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_data_definition.h"
+#include "../libesedb/libesedb_definitions.h"
 #include "../libesedb/libesedb_io_handle.h"
 #include "../libesedb/libesedb_page_tree.h"
+#include "../libesedb/libesedb_page_tree_key.h"
+
+/* Empty file header, shadow file header and leaf pages 1 to 3
+ */
+uint8_t esedb_test_page_tree_data[ 5 * 4096 ];
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
+/* Writes a leaf page with a number of values
+ * Every value consists of a local key size, a 2-byte key and 4 bytes of data
+ * A defunct page value index of 0 represents no defunct page value
+ */
+void esedb_test_page_tree_write_leaf_page(
+      uint8_t *page_data,
+      uint32_t previous_page_number,
+      uint32_t next_page_number,
+      uint8_t first_key,
+      uint16_t number_of_values,
+      uint16_t defunct_page_value_index )
+{
+	uint8_t *page_tag_data    = NULL;
+	uint8_t *page_value_data  = NULL;
+	uint16_t page_tag_offset  = 0;
+	uint16_t page_value_index = 0;
+
+	memory_set(
+	 page_data,
+	 0,
+	 4096 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( page_data[ 16 ] ),
+	 previous_page_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( page_data[ 20 ] ),
+	 next_page_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( page_data[ 24 ] ),
+	 1 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( page_data[ 32 ] ),
+	 number_of_values * 8 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( page_data[ 34 ] ),
+	 number_of_values + 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( page_data[ 36 ] ),
+	 LIBESEDB_PAGE_FLAG_IS_LEAF );
+
+	/* The first page tag contains the empty page header
+	 */
+	for( page_value_index = 1;
+	     page_value_index <= number_of_values;
+	     page_value_index++ )
+	{
+		page_value_data = &( page_data[ 40 + ( ( page_value_index - 1 ) * 8 ) ] );
+
+		page_value_data[ 0 ] = 0x02;
+		page_value_data[ 2 ] = 0x7f;
+		page_value_data[ 3 ] = first_key + (uint8_t) ( page_value_index - 1 );
+		page_value_data[ 4 ] = page_value_data[ 3 ];
+
+		page_tag_offset = ( page_value_index - 1 ) * 8;
+
+		if( page_value_index == defunct_page_value_index )
+		{
+			page_tag_offset |= (uint16_t) LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT << 13;
+		}
+		page_tag_data = &( page_data[ 4096 - ( ( page_value_index + 1 ) * 4 ) ] );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 page_tag_data,
+		 8 );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( page_tag_data[ 2 ] ),
+		 page_tag_offset );
+	}
+}
+
 /* Tests the libesedb_page_tree_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -417,6 +506,572 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_page_tree_get_next_leaf_value function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_get_next_leaf_value(
+     void )
+{
+	libbfio_handle_t *file_io_handle                 = NULL;
+	libcerror_error_t *error                         = NULL;
+	libesedb_data_definition_t *data_definition      = NULL;
+	libesedb_data_definition_t *next_data_definition = NULL;
+	libesedb_io_handle_t *io_handle                  = NULL;
+	libesedb_page_tree_key_t *next_leaf_value_key    = NULL;
+	libesedb_page_tree_t *page_tree                  = NULL;
+	libfcache_cache_t *pages_cache                   = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 * page 1 contains 2 values, page 2 contains a defunct and 1 value
+	 * and page 3, the last page in the leaf page chain, contains no values
+	 */
+	esedb_test_page_tree_write_leaf_page(
+	 &( esedb_test_page_tree_data[ 2 * 4096 ] ),
+	 0,
+	 2,
+	 0x01,
+	 2,
+	 0 );
+
+	esedb_test_page_tree_write_leaf_page(
+	 &( esedb_test_page_tree_data[ 3 * 4096 ] ),
+	 1,
+	 3,
+	 0x03,
+	 2,
+	 1 );
+
+	esedb_test_page_tree_write_leaf_page(
+	 &( esedb_test_page_tree_data[ 4 * 4096 ] ),
+	 2,
+	 0,
+	 0x05,
+	 0,
+	 0 );
+
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_revision   = 0x0000000c;
+	io_handle->page_size         = 4096;
+	io_handle->pages_data_offset = 2 * 4096;
+	io_handle->last_page_number  = 3;
+
+	result = libfcache_cache_initialize(
+	          &pages_cache,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "pages_cache",
+	 pages_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          esedb_test_page_tree_data,
+	          5 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_initialize(
+	          &page_tree,
+	          io_handle,
+	          NULL,
+	          pages_cache,
+	          1,
+	          1,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree",
+	 page_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_data_definition_initialize(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	data_definition->page_number      = 1;
+	data_definition->page_value_index = 1;
+
+	/* Test retrieving the next leaf value on the same page
+	 */
+	result = libesedb_page_tree_get_next_leaf_value(
+	          page_tree,
+	          file_io_handle,
+	          data_definition,
+	          &next_leaf_value_key,
+	          &next_data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "next_leaf_value_key",
+	 next_leaf_value_key );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "next_leaf_value_key->data_size",
+	 next_leaf_value_key->data_size,
+	 (size_t) 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "next_leaf_value_key->data[ 1 ]",
+	 next_leaf_value_key->data[ 1 ],
+	 0x02 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "next_data_definition",
+	 next_data_definition );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "next_data_definition->page_number",
+	 next_data_definition->page_number,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "next_data_definition->page_value_index",
+	 next_data_definition->page_value_index,
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "next_data_definition->data_offset",
+	 next_data_definition->data_offset,
+	 40 + 12 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "next_data_definition->data_size",
+	 next_data_definition->data_size,
+	 4 );
+
+	result = libesedb_page_tree_key_free(
+	          &next_leaf_value_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data_definition      = next_data_definition;
+	next_data_definition = NULL;
+
+	/* Test retrieving the next leaf value on the next page
+	 * where the defunct page value is skipped
+	 */
+	result = libesedb_page_tree_get_next_leaf_value(
+	          page_tree,
+	          file_io_handle,
+	          data_definition,
+	          &next_leaf_value_key,
+	          &next_data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "next_leaf_value_key",
+	 next_leaf_value_key );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "next_leaf_value_key->data[ 1 ]",
+	 next_leaf_value_key->data[ 1 ],
+	 0x04 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "next_data_definition",
+	 next_data_definition );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "next_data_definition->page_number",
+	 next_data_definition->page_number,
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "next_data_definition->page_value_index",
+	 next_data_definition->page_value_index,
+	 2 );
+
+	result = libesedb_page_tree_key_free(
+	          &next_leaf_value_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data_definition      = next_data_definition;
+	next_data_definition = NULL;
+
+	/* Test retrieving the next leaf value at the end of the leaf page chain
+	 */
+	result = libesedb_page_tree_get_next_leaf_value(
+	          page_tree,
+	          file_io_handle,
+	          data_definition,
+	          &next_leaf_value_key,
+	          &next_data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "next_leaf_value_key",
+	 next_leaf_value_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "next_data_definition",
+	 next_data_definition );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_get_next_leaf_value(
+	          NULL,
+	          file_io_handle,
+	          data_definition,
+	          &next_leaf_value_key,
+	          &next_data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_next_leaf_value(
+	          page_tree,
+	          file_io_handle,
+	          NULL,
+	          &next_leaf_value_key,
+	          &next_data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_next_leaf_value(
+	          page_tree,
+	          file_io_handle,
+	          data_definition,
+	          NULL,
+	          &next_data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_next_leaf_value(
+	          page_tree,
+	          file_io_handle,
+	          data_definition,
+	          &next_leaf_value_key,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a leaf page chain that references a page beyond the last page
+	 */
+	io_handle->last_page_number = 2;
+
+	result = libesedb_page_tree_get_next_leaf_value(
+	          page_tree,
+	          file_io_handle,
+	          data_definition,
+	          &next_leaf_value_key,
+	          &next_data_definition,
+	          &error );
+
+	io_handle->last_page_number = 3;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_free(
+	          &page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree",
+	 page_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_free(
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( next_leaf_value_key != NULL )
+	{
+		libesedb_page_tree_key_free(
+		 &next_leaf_value_key,
+		 NULL );
+	}
+	if( next_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &next_data_definition,
+		 NULL );
+	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	if( page_tree != NULL )
+	{
+		libesedb_page_tree_free(
+		 &page_tree,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( pages_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &pages_cache,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -464,6 +1119,10 @@ int main(
 
 	/* TODO: add tests for libesedb_page_tree_get_leaf_value_by_key */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_get_next_leaf_value",
+	 esedb_test_page_tree_get_next_leaf_value );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
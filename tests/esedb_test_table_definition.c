@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -348,6 +349,393 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_table_definition_get_ascii_name_length function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_definition_get_ascii_name_length(
+     void )
+{
+	size_t name_length = 0;
+
+	/* Test regular cases
+	 */
+	name_length = libesedb_table_definition_get_ascii_name_length(
+	               (uint8_t *) "Column",
+	               7 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "name_length",
+	 name_length,
+	 (size_t) 6 );
+
+	name_length = libesedb_table_definition_get_ascii_name_length(
+	               (uint8_t *) "Column",
+	               6 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "name_length",
+	 name_length,
+	 (size_t) 6 );
+
+	name_length = libesedb_table_definition_get_ascii_name_length(
+	               (uint8_t *) "Col\xe9",
+	               4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "name_length",
+	 name_length,
+	 (size_t) -1 );
+
+	/* Test error cases
+	 */
+	name_length = libesedb_table_definition_get_ascii_name_length(
+	               NULL,
+	               6 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "name_length",
+	 name_length,
+	 (size_t) -1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libesedb_table_definition_append_column_catalog_definition function
+ * and the column catalog definition index lookup functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_definition_append_column_catalog_definition(
+     void )
+{
+	uint16_t utf16_string[ 9 ] = {
+		'c', 'o', 'l', 'u', 'm', 'n', '1', '7', 0 };
+
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_catalog_definition_t *table_catalog_definition  = NULL;
+	libesedb_table_definition_t *table_definition            = NULL;
+	int definition_index                                     = 0;
+	int number_of_definitions                                = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_catalog_definition_initialize(
+	          &table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	table_catalog_definition->type = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+
+	result = libesedb_table_definition_initialize(
+	          &table_definition,
+	          table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	table_catalog_definition = NULL;
+
+	/* Test regular cases
+	 * more definitions than the initial number of slots are appended to test resizing
+	 */
+	for( number_of_definitions = 0;
+	     number_of_definitions < 20;
+	     number_of_definitions++ )
+	{
+		result = libesedb_catalog_definition_initialize(
+		          &column_catalog_definition,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		column_catalog_definition->type       = LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN;
+		column_catalog_definition->identifier = (uint32_t) ( 256 + number_of_definitions );
+
+		column_catalog_definition->name = (uint8_t *) memory_allocate(
+		                                               sizeof( uint8_t ) * 8 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "column_catalog_definition->name",
+		 column_catalog_definition->name );
+
+		column_catalog_definition->name_size = 8;
+
+		memory_copy(
+		 column_catalog_definition->name,
+		 "column",
+		 6 );
+
+		column_catalog_definition->name[ 6 ] = (uint8_t) ( '0' + ( number_of_definitions / 10 ) );
+		column_catalog_definition->name[ 7 ] = (uint8_t) ( '0' + ( number_of_definitions % 10 ) );
+
+		result = libesedb_table_definition_append_column_catalog_definition(
+		          table_definition,
+		          column_catalog_definition,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		column_catalog_definition = NULL;
+	}
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "table_definition->number_of_column_index_slots",
+	 table_definition->number_of_column_index_slots,
+	 64 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition->fixed_size_value_offsets",
+	 table_definition->fixed_size_value_offsets );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "table_definition->fixed_size_values_size",
+	 table_definition->fixed_size_values_size,
+	 0 );
+
+	result = libesedb_table_definition_get_column_catalog_definition_index_by_utf8_name(
+	          table_definition,
+	          (uint8_t *) "column07",
+	          8,
+	          &definition_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "definition_index",
+	 definition_index,
+	 7 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_get_column_catalog_definition_index_by_utf8_name(
+	          table_definition,
+	          (uint8_t *) "column0",
+	          7,
+	          &definition_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_get_column_catalog_definition_index_by_utf16_name(
+	          table_definition,
+	          utf16_string,
+	          8,
+	          &definition_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "definition_index",
+	 definition_index,
+	 17 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_get_column_catalog_definition_index_by_identifier(
+	          table_definition,
+	          256 + 12,
+	          &definition_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "definition_index",
+	 definition_index,
+	 12 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_get_column_catalog_definition_index_by_identifier(
+	          table_definition,
+	          1,
+	          &definition_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_definition_append_column_catalog_definition(
+	          NULL,
+	          column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_definition_get_column_catalog_definition_index_by_utf8_name(
+	          NULL,
+	          (uint8_t *) "column07",
+	          8,
+	          &definition_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_definition_get_column_catalog_definition_index_by_utf8_name(
+	          table_definition,
+	          (uint8_t *) "column07",
+	          8,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_definition_get_column_catalog_definition_index_by_identifier(
+	          NULL,
+	          256,
+	          &definition_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_table_definition_free(
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( column_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &column_catalog_definition,
+		 NULL );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	if( table_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &table_catalog_definition,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -379,7 +767,13 @@ int main(
 
 	/* TODO: add tests for libesedb_table_definition_set_callback_catalog_definition */
 
-	/* TODO: add tests for libesedb_table_definition_append_column_catalog_definition */
+	ESEDB_TEST_RUN(
+	 "libesedb_table_definition_append_column_catalog_definition",
+	 esedb_test_table_definition_append_column_catalog_definition );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_table_definition_get_ascii_name_length",
+	 esedb_test_table_definition_get_ascii_name_length );
 
 	/* TODO: add tests for libesedb_table_definition_append_index_catalog_definition */
 
@@ -0,0 +1,1756 @@
+/*
+ * Tools blob_store type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "esedb_test_functions.h"
+#include "esedb_test_libbfio.h"
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_libfdata.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../esedbtools/blob_store.h"
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_data_segment.h"
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_long_value.h"
+#endif
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) && !defined( WINAPI ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && defined( HAVE_UNISTD_H )
+#define ESEDB_TEST_TOOLS_BLOB_STORE_HAVE_DIRECTORY	1
+#endif
+
+uint8_t esedb_test_tools_blob_store_data1[ 16 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+/* The hexadecimal SHA-256 of esedb_test_tools_blob_store_data1
+ */
+const char *esedb_test_tools_blob_store_data1_hash_string = \
+	"be45cb2605bf36bebde684841a28f0fd43c69850a3dce5fedba69928ee3a8991";
+
+/* Data of which the second data segment starts with the unsupported Xpress10 leading byte 0x30
+ */
+uint8_t esedb_test_tools_blob_store_data2[ 16 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x30, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Creates a long value of 16 bytes of test data that consists of 2 data segments
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_tools_blob_store_long_value_initialize(
+     libesedb_long_value_t **long_value,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libbfio_handle_t **file_io_handle,
+     uint8_t *data,
+     uint32_t column_flags,
+     libcerror_error_t **error )
+{
+	libfdata_list_t *data_segments_list = NULL;
+	static char *function               = "esedb_test_tools_blob_store_long_value_initialize";
+	int element_index                   = 0;
+
+	if( esedb_test_open_file_io_handle(
+	     file_io_handle,
+	     data,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_catalog_definition_initialize(
+	     column_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create column catalog definition.",
+		 function );
+
+		goto on_error;
+	}
+	( *column_catalog_definition )->flags = column_flags;
+
+	if( libfdata_list_initialize(
+	     &data_segments_list,
+	     NULL,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_data_segment_read_element_data,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data segments list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_list_append_element(
+	     data_segments_list,
+	     &element_index,
+	     0,
+	     0,
+	     10,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append data segment: 0.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_list_append_element(
+	     data_segments_list,
+	     &element_index,
+	     0,
+	     10,
+	     6,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append data segment: 1.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_long_value_initialize(
+	     long_value,
+	     *file_io_handle,
+	     NULL,
+	     *column_catalog_definition,
+	     data_segments_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create long value.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( data_segments_list != NULL )
+	{
+		libfdata_list_free(
+		 &data_segments_list,
+		 NULL );
+	}
+	if( *column_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 column_catalog_definition,
+		 NULL );
+	}
+	if( *file_io_handle != NULL )
+	{
+		esedb_test_close_file_io_handle(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a long value created by esedb_test_tools_blob_store_long_value_initialize
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_tools_blob_store_long_value_free(
+     libesedb_long_value_t **long_value,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	int result = 1;
+
+	if( libesedb_long_value_free(
+	     long_value,
+	     error ) != 1 )
+	{
+		result = -1;
+	}
+	if( libesedb_catalog_definition_free(
+	     column_catalog_definition,
+	     error ) != 1 )
+	{
+		result = -1;
+	}
+	if( esedb_test_close_file_io_handle(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		result = -1;
+	}
+	return( result );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* Tests the blob_store_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_blob_store_initialize(
+     void )
+{
+	blob_store_t *blob_store = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 3;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = blob_store_initialize(
+	          &blob_store,
+	          _SYSTEM_STRING( "blobs" ),
+	          5,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "blob_store",
+	 blob_store );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "blob_store->number_of_blobs",
+	 blob_store->number_of_blobs,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "blob_store->source_file_descriptor",
+	 blob_store->source_file_descriptor,
+	 -1 );
+
+	result = blob_store_free(
+	          &blob_store,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "blob_store",
+	 blob_store );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = blob_store_initialize(
+	          NULL,
+	          _SYSTEM_STRING( "blobs" ),
+	          5,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	blob_store = (blob_store_t *) 0x12345678UL;
+
+	result = blob_store_initialize(
+	          &blob_store,
+	          _SYSTEM_STRING( "blobs" ),
+	          5,
+	          &error );
+
+	blob_store = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = blob_store_initialize(
+	          &blob_store,
+	          NULL,
+	          5,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test blob_store_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = blob_store_initialize(
+		          &blob_store,
+		          _SYSTEM_STRING( "blobs" ),
+		          5,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( blob_store != NULL )
+			{
+				blob_store_free(
+				 &blob_store,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "blob_store",
+			 blob_store );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( blob_store != NULL )
+	{
+		blob_store_free(
+		 &blob_store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the blob_store_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_blob_store_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = blob_store_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the blob_store_get_long_value_hash_string function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_blob_store_get_long_value_hash_string(
+     void )
+{
+	system_character_t hash_string[ BLOB_STORE_HASH_STRING_SIZE ];
+
+	blob_store_t *blob_store                                 = NULL;
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_long_value_t *long_value                        = NULL;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = blob_store_initialize(
+	          &blob_store,
+	          _SYSTEM_STRING( "blobs" ),
+	          5,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_tools_blob_store_long_value_initialize(
+	          &long_value,
+	          &column_catalog_definition,
+	          &file_io_handle,
+	          esedb_test_tools_blob_store_data1,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = blob_store_get_long_value_hash_string(
+	          blob_store,
+	          long_value,
+	          hash_string,
+	          BLOB_STORE_HASH_STRING_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = narrow_string_compare(
+	          hash_string,
+	          esedb_test_tools_blob_store_data1_hash_string,
+	          BLOB_STORE_HASH_STRING_SIZE );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+#endif
+
+	/* Test error cases
+	 */
+	result = blob_store_get_long_value_hash_string(
+	          NULL,
+	          long_value,
+	          hash_string,
+	          BLOB_STORE_HASH_STRING_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = blob_store_get_long_value_hash_string(
+	          blob_store,
+	          NULL,
+	          hash_string,
+	          BLOB_STORE_HASH_STRING_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = blob_store_get_long_value_hash_string(
+	          blob_store,
+	          long_value,
+	          NULL,
+	          BLOB_STORE_HASH_STRING_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = blob_store_get_long_value_hash_string(
+	          blob_store,
+	          long_value,
+	          hash_string,
+	          BLOB_STORE_HASH_STRING_SIZE - 1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_tools_blob_store_long_value_free(
+	          &long_value,
+	          &column_catalog_definition,
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = blob_store_free(
+	          &blob_store,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( long_value != NULL )
+	{
+		esedb_test_tools_blob_store_long_value_free(
+		 &long_value,
+		 &column_catalog_definition,
+		 &file_io_handle,
+		 NULL );
+	}
+	if( blob_store != NULL )
+	{
+		blob_store_free(
+		 &blob_store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+#if defined( ESEDB_TEST_TOOLS_BLOB_STORE_HAVE_DIRECTORY )
+
+/* Tests the blob_store_store_long_value function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_blob_store_store_long_value(
+     void )
+{
+	char blob_path[ 128 ];
+	char blob_store_path[ 32 ];
+	uint8_t blob_data[ 32 ];
+	system_character_t hash_string[ BLOB_STORE_HASH_STRING_SIZE ];
+	system_character_t duplicate_hash_string[ BLOB_STORE_HASH_STRING_SIZE ];
+
+	blob_store_t *blob_store                                 = NULL;
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_long_value_t *long_value                        = NULL;
+	FILE *blob_file_stream                                   = NULL;
+	char *directory_path                                     = NULL;
+	size_t read_count                                        = 0;
+	int blob_path_is_set                                     = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	narrow_string_copy(
+	 blob_store_path,
+	 "esedb_test_blobs_XXXXXX",
+	 24 );
+
+	directory_path = mkdtemp(
+	                  blob_store_path );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_path",
+	 directory_path );
+
+	result = blob_store_initialize(
+	          &blob_store,
+	          blob_store_path,
+	          narrow_string_length(
+	           blob_store_path ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_tools_blob_store_long_value_initialize(
+	          &long_value,
+	          &column_catalog_definition,
+	          &file_io_handle,
+	          esedb_test_tools_blob_store_data1,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test storing a value that is not yet in the blob store
+	 */
+	result = blob_store_store_long_value(
+	          blob_store,
+	          long_value,
+	          hash_string,
+	          BLOB_STORE_HASH_STRING_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "blob_store->number_of_blobs",
+	 blob_store->number_of_blobs,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "blob_store->number_of_duplicates",
+	 blob_store->number_of_duplicates,
+	 0 );
+
+	result = narrow_string_compare(
+	          hash_string,
+	          esedb_test_tools_blob_store_data1_hash_string,
+	          BLOB_STORE_HASH_STRING_SIZE );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test storing the same value again, which should not write another blob
+	 */
+	result = blob_store_store_long_value(
+	          blob_store,
+	          long_value,
+	          duplicate_hash_string,
+	          BLOB_STORE_HASH_STRING_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "blob_store->number_of_blobs",
+	 blob_store->number_of_blobs,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "blob_store->number_of_duplicates",
+	 blob_store->number_of_duplicates,
+	 1 );
+
+	result = narrow_string_compare(
+	          duplicate_hash_string,
+	          hash_string,
+	          BLOB_STORE_HASH_STRING_SIZE );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test if the blob is named after the hash and contains the value data
+	 */
+	result = snprintf(
+	          blob_path,
+	          128,
+	          "%s/%s",
+	          blob_store_path,
+	          hash_string );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 23 + 1 + 64 );
+
+	blob_path_is_set = 1;
+
+	blob_file_stream = file_stream_open(
+	                    blob_path,
+	                    FILE_STREAM_BINARY_OPEN_READ );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "blob_file_stream",
+	 blob_file_stream );
+
+	read_count = file_stream_read(
+	              blob_file_stream,
+	              blob_data,
+	              32 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "read_count",
+	 read_count,
+	 (size_t) 16 );
+
+	result = file_stream_close(
+	          blob_file_stream );
+
+	blob_file_stream = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          blob_data,
+	          esedb_test_tools_blob_store_data1,
+	          16 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = blob_store_store_long_value(
+	          NULL,
+	          long_value,
+	          hash_string,
+	          BLOB_STORE_HASH_STRING_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = blob_store_store_long_value(
+	          blob_store,
+	          NULL,
+	          hash_string,
+	          BLOB_STORE_HASH_STRING_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = unlink(
+	          blob_path );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	blob_path_is_set = 0;
+
+	result = rmdir(
+	          directory_path );
+
+	directory_path = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = esedb_test_tools_blob_store_long_value_free(
+	          &long_value,
+	          &column_catalog_definition,
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = blob_store_free(
+	          &blob_store,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( blob_file_stream != NULL )
+	{
+		file_stream_close(
+		 blob_file_stream );
+	}
+	if( blob_path_is_set != 0 )
+	{
+		unlink(
+		 blob_path );
+	}
+	if( directory_path != NULL )
+	{
+		rmdir(
+		 directory_path );
+	}
+	if( long_value != NULL )
+	{
+		esedb_test_tools_blob_store_long_value_free(
+		 &long_value,
+		 &column_catalog_definition,
+		 &file_io_handle,
+		 NULL );
+	}
+	if( blob_store != NULL )
+	{
+		blob_store_free(
+		 &blob_store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the blob_store_write_long_value function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_blob_store_write_long_value(
+     void )
+{
+	char blob_path[ 128 ];
+	char blob_store_path[ 32 ];
+	char temporary_path[ 128 ];
+
+	blob_store_t *blob_store                                 = NULL;
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_long_value_t *long_value                        = NULL;
+	char *directory_path                                     = NULL;
+	int blob_path_is_set                                     = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	narrow_string_copy(
+	 blob_store_path,
+	 "esedb_test_blobs_XXXXXX",
+	 24 );
+
+	directory_path = mkdtemp(
+	                  blob_store_path );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_path",
+	 directory_path );
+
+	result = blob_store_initialize(
+	          &blob_store,
+	          blob_store_path,
+	          narrow_string_length(
+	           blob_store_path ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = snprintf(
+	          blob_path,
+	          128,
+	          "%s/blob",
+	          blob_store_path );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 23 + 5 );
+
+	result = snprintf(
+	          temporary_path,
+	          128,
+	          "%s/blob.tmp",
+	          blob_store_path );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 23 + 9 );
+
+	result = esedb_test_tools_blob_store_long_value_initialize(
+	          &long_value,
+	          &column_catalog_definition,
+	          &file_io_handle,
+	          esedb_test_tools_blob_store_data1,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = blob_store_write_long_value(
+	          blob_store,
+	          long_value,
+	          blob_path,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	blob_path_is_set = 1;
+
+	/* Test if the temporary file was renamed to the blob file
+	 */
+	result = access(
+	          blob_path,
+	          F_OK );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = access(
+	          temporary_path,
+	          F_OK );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = unlink(
+	          blob_path );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	blob_path_is_set = 0;
+
+	result = esedb_test_tools_blob_store_long_value_free(
+	          &long_value,
+	          &column_catalog_definition,
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = blob_store_write_long_value(
+	          NULL,
+	          long_value,
+	          blob_path,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = blob_store_write_long_value(
+	          blob_store,
+	          long_value,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test blob_store_write_long_value with a long value of which the data cannot be read
+	 */
+	result = esedb_test_tools_blob_store_long_value_initialize(
+	          &long_value,
+	          &column_catalog_definition,
+	          &file_io_handle,
+	          esedb_test_tools_blob_store_data2,
+	          LIBESEDB_COLUMN_FLAG_IS_COMPRESSED,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = blob_store_write_long_value(
+	          blob_store,
+	          long_value,
+	          blob_path,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test if no partially written blob or temporary file remains
+	 */
+	result = access(
+	          blob_path,
+	          F_OK );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = access(
+	          temporary_path,
+	          F_OK );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	/* Clean up
+	 */
+	result = rmdir(
+	          directory_path );
+
+	directory_path = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = esedb_test_tools_blob_store_long_value_free(
+	          &long_value,
+	          &column_catalog_definition,
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = blob_store_free(
+	          &blob_store,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( blob_path_is_set != 0 )
+	{
+		unlink(
+		 blob_path );
+	}
+	if( directory_path != NULL )
+	{
+		rmdir(
+		 directory_path );
+	}
+	if( long_value != NULL )
+	{
+		esedb_test_tools_blob_store_long_value_free(
+		 &long_value,
+		 &column_catalog_definition,
+		 &file_io_handle,
+		 NULL );
+	}
+	if( blob_store != NULL )
+	{
+		blob_store_free(
+		 &blob_store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( ESEDB_TEST_TOOLS_BLOB_STORE_HAVE_DIRECTORY ) */
+
+#if defined( HAVE_BLOB_STORE_FILE_RANGE_COPY ) && defined( ESEDB_TEST_TOOLS_BLOB_STORE_HAVE_DIRECTORY )
+
+/* Tests the blob_store_copy_file_range function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_blob_store_copy_file_range(
+     void )
+{
+	uint8_t destination_data[ 8192 ];
+	uint8_t source_data[ 8192 ];
+	char destination_path[ 32 ];
+	char source_path[ 32 ];
+
+	/* The copy methods to test in order: copy_file_range, sendfile and pread with write
+	 */
+	int use_copy_file_range[ 3 ] = { 1, 0, 0 };
+	int use_sendfile[ 3 ]        = { 1, 1, 0 };
+
+	blob_store_t *blob_store        = NULL;
+	libcerror_error_t *error        = NULL;
+	ssize_t read_count              = 0;
+	size_t data_offset              = 0;
+	int destination_file_descriptor = -1;
+	int method_index                = 0;
+	int result                      = 0;
+	int source_file_descriptor      = -1;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 8192;
+	     data_offset++ )
+	{
+		source_data[ data_offset ] = (uint8_t) ( ( data_offset * 7 ) % 251 );
+	}
+	narrow_string_copy(
+	 source_path,
+	 "esedb_test_source_XXXXXX",
+	 25 );
+
+	source_file_descriptor = mkstemp(
+	                          source_path );
+
+	ESEDB_TEST_ASSERT_NOT_EQUAL_INT(
+	 "source_file_descriptor",
+	 source_file_descriptor,
+	 -1 );
+
+	read_count = write(
+	              source_file_descriptor,
+	              source_data,
+	              8192 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8192 );
+
+	result = blob_store_initialize(
+	          &blob_store,
+	          _SYSTEM_STRING( "blobs" ),
+	          5,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = blob_store_set_source_file_descriptor(
+	          blob_store,
+	          source_file_descriptor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( method_index = 0;
+	     method_index < 3;
+	     method_index++ )
+	{
+		blob_store->use_copy_file_range = use_copy_file_range[ method_index ];
+		blob_store->use_sendfile        = use_sendfile[ method_index ];
+
+		narrow_string_copy(
+		 destination_path,
+		 "esedb_test_blob_XXXXXX",
+		 23 );
+
+		destination_file_descriptor = mkstemp(
+		                               destination_path );
+
+		ESEDB_TEST_ASSERT_NOT_EQUAL_INT(
+		 "destination_file_descriptor",
+		 destination_file_descriptor,
+		 -1 );
+
+		result = blob_store_copy_file_range(
+		          blob_store,
+		          destination_file_descriptor,
+		          100,
+		          5000,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The data is appended at the current offset of the destination file
+		 */
+		result = blob_store_copy_file_range(
+		          blob_store,
+		          destination_file_descriptor,
+		          0,
+		          100,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = pread(
+		              destination_file_descriptor,
+		              destination_data,
+		              8192,
+		              0 );
+
+		ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 5100 );
+
+		result = memory_compare(
+		          destination_data,
+		          &( source_data[ 100 ] ),
+		          5000 );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = memory_compare(
+		          &( destination_data[ 5000 ] ),
+		          source_data,
+		          100 );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = close(
+		          destination_file_descriptor );
+
+		destination_file_descriptor = -1;
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = unlink(
+		          destination_path );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = blob_store_copy_file_range(
+	          NULL,
+	          1,
+	          0,
+	          100,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = blob_store_copy_file_range(
+	          blob_store,
+	          1,
+	          -1,
+	          100,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test copying beyond the end of the source file
+	 */
+	blob_store->use_copy_file_range = 0;
+	blob_store->use_sendfile        = 0;
+
+	narrow_string_copy(
+	 destination_path,
+	 "esedb_test_blob_XXXXXX",
+	 23 );
+
+	destination_file_descriptor = mkstemp(
+	                               destination_path );
+
+	ESEDB_TEST_ASSERT_NOT_EQUAL_INT(
+	 "destination_file_descriptor",
+	 destination_file_descriptor,
+	 -1 );
+
+	result = blob_store_copy_file_range(
+	          blob_store,
+	          destination_file_descriptor,
+	          8000,
+	          1000,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = close(
+	          destination_file_descriptor );
+
+	destination_file_descriptor = -1;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = unlink(
+	          destination_path );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = blob_store_free(
+	          &blob_store,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = close(
+	          source_file_descriptor );
+
+	source_file_descriptor = -1;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = unlink(
+	          source_path );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_file_descriptor != -1 )
+	{
+		close(
+		 destination_file_descriptor );
+		unlink(
+		 destination_path );
+	}
+	if( blob_store != NULL )
+	{
+		blob_store_free(
+		 &blob_store,
+		 NULL );
+	}
+	if( source_file_descriptor != -1 )
+	{
+		close(
+		 source_file_descriptor );
+		unlink(
+		 source_path );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_BLOB_STORE_FILE_RANGE_COPY ) && defined( ESEDB_TEST_TOOLS_BLOB_STORE_HAVE_DIRECTORY ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ESEDB_TEST_RUN(
+	 "blob_store_initialize",
+	 esedb_test_tools_blob_store_initialize );
+
+	ESEDB_TEST_RUN(
+	 "blob_store_free",
+	 esedb_test_tools_blob_store_free );
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "blob_store_get_long_value_hash_string",
+	 esedb_test_tools_blob_store_get_long_value_hash_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+#if defined( HAVE_BLOB_STORE_FILE_RANGE_COPY ) && defined( ESEDB_TEST_TOOLS_BLOB_STORE_HAVE_DIRECTORY )
+
+	ESEDB_TEST_RUN(
+	 "blob_store_copy_file_range",
+	 esedb_test_tools_blob_store_copy_file_range );
+
+#endif /* defined( HAVE_BLOB_STORE_FILE_RANGE_COPY ) && defined( ESEDB_TEST_TOOLS_BLOB_STORE_HAVE_DIRECTORY ) */
+
+#if defined( ESEDB_TEST_TOOLS_BLOB_STORE_HAVE_DIRECTORY )
+
+	ESEDB_TEST_RUN(
+	 "blob_store_write_long_value",
+	 esedb_test_tools_blob_store_write_long_value );
+
+	ESEDB_TEST_RUN(
+	 "blob_store_store_long_value",
+	 esedb_test_tools_blob_store_store_long_value );
+
+#endif /* defined( ESEDB_TEST_TOOLS_BLOB_STORE_HAVE_DIRECTORY ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
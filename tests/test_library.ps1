@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "block_descriptor block_tree block_tree_node catalog catalog_definition checksum column column_type compression data_definition data_segment database error file_header index io_handle leaf_page_descriptor long_value multi_value notify page page_header page_tree page_tree_key page_tree_value page_value record table root_page_header space_tree space_tree_value table_definition"
+$LibraryTests = "arrow batch catalog catalog_cache catalog_definition checksum column column_type compression data_definition data_segment database decompression_cache error file_header filter index io_handle leaf_page_descriptor long_value long_value_cache long_value_cursor multi_value name_hash_table notify page page_bitmap page_buffer_pool page_header page_store page_tree page_tree_key page_tree_value page_value record table root_page_header space_tree space_tree_value table_definition"
 $LibraryTestsWithInput = "file support"
 $OptionSets = "" -split " "
 
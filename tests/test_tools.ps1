@@ -1,6 +1,6 @@
 # Tests tools functions and types.
 
-$ToolsTests = "info_handle output signal windows_search_compression"
+$ToolsTests = "blob_store info_handle output signal windows_search_compression"
 $OptionSets = "" -split " "
 
 . .\test_functions.ps1